@@ -0,0 +1,304 @@
+#include "BatchRenderer.hpp"
+
+// Third Party Libraries
+#include <glm/gtc/type_ptr.hpp>
+
+// Our own modules
+#include "GLStateCache.hpp"
+#include "VertexFormat.hpp"
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cstring>
+
+// Meshes come as x, y, z, r, g, b floats, and are packed into 8 bytes per
+//  vertex on upload
+static const VertexFormat kVertexFormat({ { 0, 3, VertexEncoding::Snorm10_10_10_2 },
+                                          { 1, 3, VertexEncoding::Unorm8 } });
+
+static bool MultiDrawSupported()
+{
+   return GLAD_GL_ARB_multi_draw_indirect && GLAD_GL_ARB_base_instance;
+}
+
+BatchRenderer::BatchRenderer(std::size_t MaxInstances)
+   : mMaxInstances(MaxInstances),
+     mMultiDraw(MultiDrawSupported()),
+     mInstances(MaxInstances * sizeof(glm::mat4))
+{
+   glGenVertexArrays(1, &mVertexArrayObject);
+   GLState().BindVertexArray(mVertexArrayObject);
+
+   glGenBuffers(1, &mVertexBufferObject);
+   GLState().BindBuffer(GL_ARRAY_BUFFER, mVertexBufferObject);
+   kVertexFormat.Apply();
+
+   // The element buffer binding is part of the VAO
+   glGenBuffers(1, &mIndexBufferObject);
+   GLState().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBufferObject);
+
+   // A mat4 attribute takes four locations, one per column. The divisor makes
+   //  them advance once per instance instead of once per vertex. Their
+   //  pointers are set in Render(), since the transforms move every frame.
+   for (GLuint column = 0; column < 4; ++column)
+   {
+      glEnableVertexAttribArray(kTransformLocation + column);
+      glVertexAttribDivisor(kTransformLocation + column, 1);
+   }
+
+   GLState().BindVertexArray(0);
+}
+
+BatchRenderer::~BatchRenderer()
+{
+   glDeleteVertexArrays(1, &mVertexArrayObject);
+   glDeleteBuffers(1, &mVertexBufferObject);
+   glDeleteBuffers(1, &mIndexBufferObject);
+   // Whatever of those was bound is not anymore
+   GLState().Invalidate();
+}
+
+std::size_t BatchRenderer::AddMesh(const std::vector<GLfloat>& Vertices, const std::vector<GLuint>& Indices)
+{
+   // The indices stay relative to the mesh: the base vertex of the draw call
+   //  moves them to where the mesh starts in the shared VBO.
+   Mesh mesh;
+   mesh.IndexCount = static_cast<GLuint>(Indices.size());
+   mesh.FirstIndex = static_cast<GLuint>(mIndices.size());
+   mesh.BaseVertex = static_cast<GLint>(mVertices.size() / kVertexFormat.GetComponentCount());
+   mMeshes.push_back(mesh);
+
+   mVertices.insert(mVertices.end(), Vertices.begin(), Vertices.end());
+   mIndices.insert(mIndices.end(), Indices.begin(), Indices.end());
+   mMeshesDirty = true;
+   return mMeshes.size() - 1;
+}
+
+void BatchRenderer::Submit(std::size_t Mesh, GLuint Program, const glm::mat4& Transform)
+{
+   const std::uint64_t key = (static_cast<std::uint64_t>(Program) << 32) | Mesh;
+   auto found = mBatchIndices.find(key);
+   if (found == mBatchIndices.end())
+   {
+      Batch batch;
+      batch.Program = Program;
+      batch.Mesh = Mesh;
+      mBatches.push_back(std::move(batch));
+      found = mBatchIndices.emplace(key, mBatches.size() - 1).first;
+   }
+   mBatches[found->second].Transforms.push_back(Transform);
+}
+
+void BatchRenderer::RemoveProgram(GLuint Program)
+{
+   mViewProjectionLocations.erase(Program);
+
+   const auto removed = std::remove_if(mBatches.begin(), mBatches.end(), [Program](const Batch& Candidate)
+   {
+      return Candidate.Program == Program;
+   });
+   if (removed == mBatches.end())
+   {
+      return;
+   }
+   mBatches.erase(removed, mBatches.end());
+
+   // The batches that are left moved down, index them again
+   mBatchIndices.clear();
+   for (std::size_t i = 0; i < mBatches.size(); ++i)
+   {
+      const std::uint64_t key = (static_cast<std::uint64_t>(mBatches[i].Program) << 32) | mBatches[i].Mesh;
+      mBatchIndices.emplace(key, i);
+   }
+}
+
+void BatchRenderer::ReserveCommands(std::size_t Count)
+{
+   if (Count <= mIndirectCapacity)
+   {
+      return;
+   }
+
+   // Doubling keeps the reallocations rare while materials get added.
+   //  Nothing stays bound to the old buffer once it is deleted.
+   mIndirectCapacity = std::max(Count, mIndirectCapacity * 2);
+   GLState().BindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+   mIndirect.reset(new StreamBuffer(mIndirectCapacity * sizeof(DrawElementsIndirectCommand)));
+}
+
+GLint BatchRenderer::GetViewProjectionLocation(GLuint Program)
+{
+   auto found = mViewProjectionLocations.find(Program);
+   if (found == mViewProjectionLocations.end())
+   {
+      found = mViewProjectionLocations.emplace(Program, glGetUniformLocation(Program, "u_ViewProjection")).first;
+   }
+   return found->second;
+}
+
+void BatchRenderer::UploadMeshes()
+{
+   const std::vector<GLubyte> packed = kVertexFormat.Pack(mVertices);
+   GLState().BindBuffer(GL_ARRAY_BUFFER, mVertexBufferObject);
+   glBufferData(GL_ARRAY_BUFFER,
+                packed.size(),
+                packed.data(),
+                GL_STATIC_DRAW);
+
+   GLState().BindVertexArray(mVertexArrayObject);
+   glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                mIndices.size() * sizeof(GLuint),
+                mIndices.data(),
+                GL_STATIC_DRAW);
+
+   mMeshesDirty = false;
+}
+
+void BatchRenderer::SetInstanceOffset(std::size_t Offset)
+{
+   GLState().BindBuffer(GL_ARRAY_BUFFER, mInstances.GetBuffer());
+   for (GLuint column = 0; column < 4; ++column)
+   {
+      glVertexAttribPointer(kTransformLocation + column, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4),
+                            (GLvoid*)(Offset + column * sizeof(glm::vec4)));
+   }
+}
+
+void BatchRenderer::Render(const glm::mat4& ViewProjection)
+{
+   if (mMeshesDirty)
+   {
+      UploadMeshes();
+   }
+   mDrawCalls = 0;
+
+   // Group the batches by material, so that each program is bound only once
+   mOrder.clear();
+   for (std::size_t i = 0; i < mBatches.size(); ++i)
+   {
+      if (!mBatches[i].Transforms.empty())
+      {
+         mOrder.push_back(i);
+      }
+   }
+   std::sort(mOrder.begin(), mOrder.end(), [this](std::size_t Left, std::size_t Right)
+   {
+      return mBatches[Left].Program < mBatches[Right].Program;
+   });
+
+   // One command per batch, the instances of each batch following those of
+   //  the previous one in the instance buffer
+   mCommands.clear();
+   std::size_t instanceCount = 0;
+   for (std::size_t index : mOrder)
+   {
+      const Batch& batch = mBatches[index];
+      const std::size_t count = std::min(batch.Transforms.size(), mMaxInstances - instanceCount);
+      const Mesh& mesh = mMeshes[batch.Mesh];
+
+      DrawElementsIndirectCommand command;
+      command.Count = mesh.IndexCount;
+      command.InstanceCount = static_cast<GLuint>(count);
+      command.FirstIndex = mesh.FirstIndex;
+      command.BaseVertex = mesh.BaseVertex;
+      command.BaseInstance = static_cast<GLuint>(instanceCount);
+      mCommands.push_back(command);
+      instanceCount += count;
+   }
+
+   mInstances.BeginFrame();
+   std::size_t instanceOffset = 0;
+   char* transforms = static_cast<char*>(mInstances.Allocate(instanceCount * sizeof(glm::mat4), instanceOffset));
+   if (transforms == nullptr)
+   {
+      // The instances are capped to the frame size, but rather draw nothing
+      //  than write past it
+      mOrder.clear();
+   }
+   for (std::size_t i = 0; i < mOrder.size(); ++i)
+   {
+      std::memcpy(transforms + mCommands[i].BaseInstance * sizeof(glm::mat4),
+                  mBatches[mOrder[i]].Transforms.data(),
+                  mCommands[i].InstanceCount * sizeof(glm::mat4));
+   }
+   mInstances.Flush();
+
+   // Without multi-draw the commands are only read back on the CPU
+   const bool indirect = mMultiDraw && !mCommands.empty();
+   std::size_t commandOffset = 0;
+   if (indirect)
+   {
+      ReserveCommands(mCommands.size());
+      mIndirect->BeginFrame();
+      void* commands = mIndirect->Allocate(mCommands.size() * sizeof(DrawElementsIndirectCommand), commandOffset, 4);
+      if (commands == nullptr)
+      {
+         mOrder.clear();
+      }
+      else
+      {
+         std::memcpy(commands, mCommands.data(), mCommands.size() * sizeof(DrawElementsIndirectCommand));
+      }
+      mIndirect->Flush();
+      GLState().BindBuffer(GL_DRAW_INDIRECT_BUFFER, mIndirect->GetBuffer());
+   }
+
+   GLState().BindVertexArray(mVertexArrayObject);
+   if (indirect)
+   {
+      // The base instance of each command offsets into the frame's transforms
+      SetInstanceOffset(instanceOffset);
+   }
+
+   for (std::size_t first = 0; first < mOrder.size(); )
+   {
+      const GLuint program = mBatches[mOrder[first]].Program;
+      std::size_t last = first + 1;
+      while (last < mOrder.size() && mBatches[mOrder[last]].Program == program)
+      {
+         ++last;
+      }
+
+      GLState().UseProgram(program);
+      glUniformMatrix4fv(GetViewProjectionLocation(program), 1, GL_FALSE,
+                         glm::value_ptr(ViewProjection));
+
+      if (indirect)
+      {
+         // Every mesh of the material in a single call
+         glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT,
+                                     (GLvoid*)(commandOffset + first * sizeof(DrawElementsIndirectCommand)),
+                                     static_cast<GLsizei>(last - first), 0);
+         ++mDrawCalls;
+      }
+      else
+      {
+         // No base instance on 4.1: point the transform attribute at the
+         //  first instance of each batch instead
+         for (std::size_t i = first; i < last; ++i)
+         {
+            const DrawElementsIndirectCommand& command = mCommands[i];
+            SetInstanceOffset(instanceOffset + command.BaseInstance * sizeof(glm::mat4));
+            glDrawElementsInstancedBaseVertex(GL_TRIANGLES, command.Count, GL_UNSIGNED_INT,
+                                              (GLvoid*)(command.FirstIndex * sizeof(GLuint)),
+                                              command.InstanceCount, command.BaseVertex);
+            ++mDrawCalls;
+         }
+      }
+      first = last;
+   }
+
+   // Nothing is unbound: with the state cache, the next frame skips the
+   //  binds that did not change instead
+   if (indirect)
+   {
+      mIndirect->EndFrame();
+   }
+   mInstances.EndFrame();
+
+   // Keep the batches and their capacity, only drop the instances
+   for (Batch& batch : mBatches)
+   {
+      batch.Transforms.clear();
+   }
+}
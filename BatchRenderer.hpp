@@ -0,0 +1,156 @@
+#pragma once
+
+// Third Party Libraries
+#include <glad/glad.h>
+#include <glm/mat4x4.hpp>
+
+// Our own modules
+#include "StreamBuffer.hpp"
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+* BatchRenderer draws many instances of a few meshes with a handful of draw
+*  calls, instead of one draw call (and its state changes) per object.
+*
+* - Every mesh lives in one shared VBO/IBO, behind one VAO, so drawing
+*   another mesh never rebinds anything.
+* - The transforms submitted during a frame are written to a StreamBuffer
+*   and read by the vertex shader as a per-instance attribute
+*   (glVertexAttribDivisor).
+* - Instances are grouped by material (the shader program) and mesh. Each
+*   material is then drawn with a single glMultiDrawElementsIndirect, one
+*   command per mesh. Without GL_ARB_multi_draw_indirect and
+*   GL_ARB_base_instance (neither is core in 4.1), each mesh of a material
+*   gets its own glDrawElementsInstancedBaseVertex instead.
+*
+* Vertex format: position (x, y, z, within -1..1) and color (r, g, b), packed
+*  like in VertexSpecification() (see VertexFormat.hpp). The vertex shader
+*  reads them at locations 0 and 1, the instance transform at location 2
+*  (a mat4, so 2 to 5), and the "u_ViewProjection" uniform.
+*  See shaders/batch_vert.glsl.
+*
+* E.g.
+*  BatchRenderer batch(10000);
+*  std::size_t quad = batch.AddMesh(quadVertices, quadIndices);
+*  // Every frame
+*  batch.Submit(quad, program, transform);  // as many times as needed
+*  batch.Render(viewProjection);
+*/
+class BatchRenderer
+{
+public:
+   // Vertex attribute location of the instance transform
+   static const GLuint kTransformLocation = 2;
+
+   /**
+   * @param MaxInstances Number of instances that can be drawn per Render()
+   */
+   explicit BatchRenderer(std::size_t MaxInstances);
+   ~BatchRenderer();
+
+   BatchRenderer(const BatchRenderer&) = delete;
+   BatchRenderer& operator=(const BatchRenderer&) = delete;
+
+   /**
+   * Adds a mesh to the shared buffers. It is uploaded on the next Render().
+   * @param Vertices x, y, z, r, g, b per vertex
+   * @param Indices Triangle list, indexing Vertices
+   * @return Mesh index for Submit()
+   */
+   std::size_t AddMesh(const std::vector<GLfloat>& Vertices, const std::vector<GLuint>& Indices);
+
+   /**
+   * Queues one instance of a mesh for the next Render().
+   * @param Mesh Index returned by AddMesh()
+   * @param Program Material to draw it with
+   * @param Transform Model matrix of the instance
+   */
+   void Submit(std::size_t Mesh, GLuint Program, const glm::mat4& Transform);
+
+   /**
+   * Forgets a deleted program, e.g. one replaced by ShaderHotReload::Update():
+   *  drops its batches, with the instances queued for it, and its cached
+   *  uniform location.
+   */
+   void RemoveProgram(GLuint Program);
+
+   /**
+   * Draws every instance queued since the last call, then clears the queue.
+   *  Instances past MaxInstances are dropped.
+   * @param ViewProjection Value of the "u_ViewProjection" uniform
+   */
+   void Render(const glm::mat4& ViewProjection);
+
+   /**
+   * @return Number of draw calls issued by the last Render()
+   */
+   int GetDrawCallCount() const { return mDrawCalls; }
+
+private:
+   struct Mesh
+   {
+      GLuint IndexCount;
+      GLuint FirstIndex;
+      GLint BaseVertex;
+   };
+
+   // Instances of one mesh with one material
+   struct Batch
+   {
+      GLuint Program;
+      std::size_t Mesh;
+      std::vector<glm::mat4> Transforms;
+   };
+
+   // Layout of glMultiDrawElementsIndirect's commands
+   struct DrawElementsIndirectCommand
+   {
+      GLuint Count;
+      GLuint InstanceCount;
+      GLuint FirstIndex;
+      GLint BaseVertex;
+      GLuint BaseInstance;
+   };
+
+   void UploadMeshes();
+   void SetInstanceOffset(std::size_t Offset);
+   void ReserveCommands(std::size_t Count);
+   GLint GetViewProjectionLocation(GLuint Program);
+
+   std::size_t mMaxInstances = 0;
+   // glMultiDrawElementsIndirect with a base instance per command is available
+   bool mMultiDraw = false;
+
+   GLuint mVertexArrayObject = 0;
+   GLuint mVertexBufferObject = 0;
+   GLuint mIndexBufferObject = 0;
+   std::vector<GLfloat> mVertices;
+   std::vector<GLuint> mIndices;
+   std::vector<Mesh> mMeshes;
+   bool mMeshesDirty = false;
+
+   // Transforms of the frame, and the indirect commands (multi-draw only).
+   //  There is one command per batch, and batches come and go with the
+   //  programs, so the indirect buffer grows with them.
+   StreamBuffer mInstances;
+   std::unique_ptr<StreamBuffer> mIndirect;
+   std::size_t mIndirectCapacity = 0;
+
+   // Batches live as long as the renderer, so that their vectors keep their
+   //  capacity from one frame to the next
+   std::vector<Batch> mBatches;
+   std::unordered_map<std::uint64_t, std::size_t> mBatchIndices;
+   // Non empty batches sorted by material, and one draw command per batch
+   std::vector<std::size_t> mOrder;
+   std::vector<DrawElementsIndirectCommand> mCommands;
+   // "u_ViewProjection" of each program
+   std::unordered_map<GLuint, GLint> mViewProjectionLocations;
+
+   int mDrawCalls = 0;
+};
@@ -0,0 +1,313 @@
+#include "GLDebug.hpp"
+
+#if GL_DEBUG_CAPTURE
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+// Messages the ring holds (a power of two), and characters kept per message
+static const std::size_t kRingSize = 256;
+static const std::size_t kMessageLength = 240;
+
+// How long the logger sleeps when the ring is empty
+static const std::chrono::milliseconds kLoggerPeriod(10);
+
+struct DebugMessage
+{
+   GLenum Source;
+   GLenum Type;
+   GLuint Id;
+   GLenum Severity;
+   // Last GLCheck() call before the message, if any
+   const char* Call;
+   int Line;
+   char Text[kMessageLength];
+};
+
+/**
+* Bounded queue for several producers (the driver may call the callback from
+*  any thread) and one consumer (the logger), after Dmitry Vyukov's. Each
+*  slot has a sequence number telling whether it is free for the producer
+*  whose turn it is, or filled for the consumer. Producers claim a position
+*  with a compare-exchange; nobody ever waits for a lock.
+*/
+class DebugMessageRing
+{
+public:
+   DebugMessageRing()
+   {
+      for (std::size_t i = 0; i < kRingSize; ++i)
+      {
+         mSlots[i].Sequence.store(i, std::memory_order_relaxed);
+      }
+   }
+
+   // @return false if the ring is full
+   bool Push(const DebugMessage& Message)
+   {
+      std::size_t position = mPush.load(std::memory_order_relaxed);
+      for (;;)
+      {
+         Slot& slot = mSlots[position & (kRingSize - 1)];
+         const std::size_t sequence = slot.Sequence.load(std::memory_order_acquire);
+         const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - position);
+         if (difference == 0)
+         {
+            if (mPush.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+               slot.Message = Message;
+               slot.Sequence.store(position + 1, std::memory_order_release);
+               return true;
+            }
+         }
+         else if (difference < 0)
+         {
+            return false;
+         }
+         else
+         {
+            position = mPush.load(std::memory_order_relaxed);
+         }
+      }
+   }
+
+   // Consumer only. @return false if the ring is empty
+   bool Pop(DebugMessage& Message)
+   {
+      Slot& slot = mSlots[mPop & (kRingSize - 1)];
+      if (slot.Sequence.load(std::memory_order_acquire) != mPop + 1)
+      {
+         return false;
+      }
+      Message = slot.Message;
+      slot.Sequence.store(mPop + kRingSize, std::memory_order_release);
+      ++mPop;
+      return true;
+   }
+
+private:
+   struct Slot
+   {
+      std::atomic<std::size_t> Sequence;
+      DebugMessage Message;
+   };
+
+   Slot mSlots[kRingSize];
+   std::atomic<std::size_t> mPush{0};
+   std::size_t mPop = 0;
+};
+
+static DebugMessageRing gDebugMessages;
+static std::atomic<unsigned> gDebugDropped{0};
+static std::atomic<bool> gDebugCapturing{false};
+static std::atomic<bool> gDebugStop{false};
+static std::thread gDebugLogger;
+
+// Last GLCheck() call site. Written by the render thread, read by the
+//  callback, which may run on another thread, hence the atomics.
+static std::atomic<const char*> gDebugCall{nullptr};
+static std::atomic<int> gDebugLine{0};
+
+static const char* SourceName(GLenum Source)
+{
+   switch (Source)
+   {
+   case GL_DEBUG_SOURCE_API:             return "API";
+   case GL_DEBUG_SOURCE_WINDOW_SYSTEM:   return "Window System";
+   case GL_DEBUG_SOURCE_SHADER_COMPILER: return "Shader Compiler";
+   case GL_DEBUG_SOURCE_THIRD_PARTY:     return "Third Party";
+   case GL_DEBUG_SOURCE_APPLICATION:     return "Application";
+   default:                              return "Other";
+   }
+}
+
+static const char* TypeName(GLenum Type)
+{
+   switch (Type)
+   {
+   case GL_DEBUG_TYPE_ERROR:               return "Error";
+   case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "Deprecated Behavior";
+   case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:  return "Undefined Behavior";
+   case GL_DEBUG_TYPE_PORTABILITY:         return "Portability";
+   case GL_DEBUG_TYPE_PERFORMANCE:         return "Performance";
+   case GL_DEBUG_TYPE_MARKER:              return "Marker";
+   default:                                return "Other";
+   }
+}
+
+static const char* SeverityName(GLenum Severity)
+{
+   switch (Severity)
+   {
+   case GL_DEBUG_SEVERITY_HIGH:   return "High";
+   case GL_DEBUG_SEVERITY_MEDIUM: return "Medium";
+   case GL_DEBUG_SEVERITY_LOW:    return "Low";
+   default:                       return "Notification";
+   }
+}
+
+static void PrintMessage(const DebugMessage& Message)
+{
+   std::cerr << "OpenGL " << TypeName(Message.Type)
+             << " (" << SeverityName(Message.Severity)
+             << ", " << SourceName(Message.Source)
+             << ", id " << Message.Id << "): "
+             << Message.Text;
+   if (Message.Call != nullptr)
+   {
+      std::cerr << "\tAfter: " << Message.Call << "\tLine: " << Message.Line;
+   }
+   std::cerr << std::endl;
+}
+
+/**
+* Called by the driver. Copies the message and returns: no formatting, no
+*  output, no lock.
+*/
+static void APIENTRY DebugCallback(GLenum Source, GLenum Type, GLuint Id, GLenum Severity,
+                                   GLsizei Length, const GLchar* Text, const void* /*UserParam*/)
+{
+   DebugMessage message;
+   message.Source = Source;
+   message.Type = Type;
+   message.Id = Id;
+   message.Severity = Severity;
+   message.Call = gDebugCall.load(std::memory_order_relaxed);
+   message.Line = gDebugLine.load(std::memory_order_relaxed);
+
+   const std::size_t length = Length >= 0 ? static_cast<std::size_t>(Length) : std::strlen(Text);
+   const std::size_t kept = std::min(length, kMessageLength - 1);
+   std::memcpy(message.Text, Text, kept);
+   message.Text[kept] = '\0';
+
+   if (!gDebugMessages.Push(message))
+   {
+      gDebugDropped.fetch_add(1, std::memory_order_relaxed);
+   }
+}
+
+static void RunLogger()
+{
+   DebugMessage message;
+   while (!gDebugStop.load(std::memory_order_acquire))
+   {
+      while (gDebugMessages.Pop(message))
+      {
+         PrintMessage(message);
+      }
+      std::this_thread::sleep_for(kLoggerPeriod);
+   }
+
+   // What came in while we were sleeping
+   while (gDebugMessages.Pop(message))
+   {
+      PrintMessage(message);
+   }
+}
+
+bool StartGLDebugCapture()
+{
+   if (!GLAD_GL_KHR_debug)
+   {
+      std::cerr << "KHR_debug is not supported, GLCheck() polls glGetError()" << std::endl;
+      return false;
+   }
+
+   glEnable(GL_DEBUG_OUTPUT);
+   // Let the driver call us from its own threads: we never block it anyway
+   glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+   glDebugMessageCallback(DebugCallback, nullptr);
+   // Notifications (e.g. "shader compiled") are filtered out by the driver
+   glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);
+
+   gDebugStop = false;
+   gDebugLogger = std::thread(RunLogger);
+   gDebugCapturing = true;
+   return true;
+}
+
+void StopGLDebugCapture()
+{
+   if (!gDebugCapturing)
+   {
+      return;
+   }
+
+   glDebugMessageCallback(nullptr, nullptr);
+   glDisable(GL_DEBUG_OUTPUT);
+   gDebugCapturing = false;
+
+   gDebugStop.store(true, std::memory_order_release);
+   gDebugLogger.join();
+
+   if (gDebugDropped > 0)
+   {
+      std::cerr << "OpenGL debug output: " << gDebugDropped << " messages dropped" << std::endl;
+   }
+}
+
+unsigned GetGLDebugDroppedCount()
+{
+   return gDebugDropped.load(std::memory_order_relaxed);
+}
+
+void GLDebugBeforeCall(const char* Call, int Line)
+{
+   if (gDebugCapturing.load(std::memory_order_relaxed))
+   {
+      gDebugCall.store(Call, std::memory_order_relaxed);
+      gDebugLine.store(Line, std::memory_order_relaxed);
+      return;
+   }
+
+   // No callback: clear the errors of earlier calls
+   while (glGetError() != GL_NO_ERROR) {}
+}
+
+void GLDebugAfterCall(const char* Call, int Line)
+{
+   if (gDebugCapturing.load(std::memory_order_relaxed))
+   {
+      return;
+   }
+
+   while (GLenum error = glGetError())
+   {
+      std::cerr << "OpenGL Error: " << error
+                << "\tLine: " << Line
+                << "\tFunction: " << Call
+                << std::endl;
+   }
+}
+
+#else
+
+bool StartGLDebugCapture()
+{
+   return false;
+}
+
+void StopGLDebugCapture()
+{
+}
+
+unsigned GetGLDebugDroppedCount()
+{
+   return 0;
+}
+
+void GLDebugBeforeCall(const char* /*Call*/, int /*Line*/)
+{
+}
+
+void GLDebugAfterCall(const char* /*Call*/, int /*Line*/)
+{
+}
+
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+
+// Third Party Libraries
+#include <glad/glad.h>
+
+/**
+* Compile-time switch of the OpenGL error checking. On by default, off when
+*  NDEBUG is defined (release builds), where GLCheck(x) is just x and no
+*  debug callback is installed. Define it to 0 or 1 to override.
+*/
+#ifndef GL_DEBUG_CAPTURE
+#  ifdef NDEBUG
+#     define GL_DEBUG_CAPTURE 0
+#  else
+#     define GL_DEBUG_CAPTURE 1
+#  endif
+#endif
+
+/**
+* OpenGL debug output capture.
+* With KHR_debug (core in 4.3, an extension on most 4.1 drivers), the driver
+*  reports errors and warnings itself through glDebugMessageCallback, instead
+*  of us asking with glGetError(), which waits for the driver to catch up
+*  with every call. The callback copies each message into a lock-free ring
+*  buffer and returns right away; a logger thread turns the enums into names
+*  and prints the messages. If the ring is full, messages are dropped and
+*  counted rather than blocking the thread that made the GL call.
+*
+* Without KHR_debug, GLCheck(x) falls back to polling glGetError() around x.
+*/
+
+/**
+* Installs the debug callback on the current context and starts the logger
+*  thread. Call it once, on the render thread, after loading glad.
+* @return false if capture is compiled out or KHR_debug is not supported.
+*/
+bool StartGLDebugCapture();
+
+/**
+* Removes the callback, prints the messages still in the ring and stops the
+*  logger thread. Call it before destroying the context.
+*/
+void StopGLDebugCapture();
+
+/**
+* @return Number of messages dropped because the ring buffer was full.
+*/
+unsigned GetGLDebugDroppedCount();
+
+// Used by GLCheck(x): record the call site, or poll glGetError() without KHR_debug
+void GLDebugBeforeCall(const char* Call, int Line);
+void GLDebugAfterCall(const char* Call, int Line);
+
+/**
+* Wraps an OpenGL call to report its errors along with the call and its line.
+* With KHR_debug the messages are logged asynchronously, so the reported call
+*  is the last GLCheck() before the message, not necessarily its cause.
+* E.g.
+*  GLCheck(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);)
+*/
+#if GL_DEBUG_CAPTURE
+#  define GLCheck(x) GLDebugBeforeCall(#x, __LINE__); x; GLDebugAfterCall(#x, __LINE__);
+#else
+#  define GLCheck(x) x;
+#endif
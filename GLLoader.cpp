@@ -0,0 +1,23 @@
+#include "GLLoader.hpp"
+
+// The core version requested by InitializeProgram() and the headless context
+static const int kMajorVersion = 4;
+static const int kMinorVersion = 1;
+
+// Every extension the application checks, NULL terminated
+static const char* const kExtensions[] =
+{
+   "GL_ARB_base_instance",
+   "GL_ARB_buffer_storage",
+   "GL_ARB_multi_draw_indirect",
+   "GL_ARB_parallel_shader_compile",
+   "GL_ARB_vertex_type_10f_11f_11f_rev",
+   "GL_KHR_debug",
+   "GL_KHR_parallel_shader_compile",
+   nullptr
+};
+
+bool LoadOpenGLFunctions(GLADloadproc Load)
+{
+   return gladLoadGLLoaderScoped(Load, kMajorVersion, kMinorVersion, kExtensions) != 0;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+// Third Party Libraries
+#include <glad/glad.h>
+
+/**
+* Loads the OpenGL functions with glad, scoped to what the application uses:
+*  the 4.1 core functions, and the extensions listed in GLLoader.cpp. A full
+*  gladLoadGLLoader() also looks up the functions of every extension glad was
+*  generated with, and compares every name against the driver's extension
+*  list, which is most of the loading time.
+*
+* Any extension tested with a GLAD_GL_* flag must be listed in GLLoader.cpp,
+*  or its flag reads 0.
+*
+* @param Load Function returning the address of an OpenGL function, e.g.
+*  SDL_GL_GetProcAddress
+* @return true if glad was initialized.
+*/
+bool LoadOpenGLFunctions(GLADloadproc Load);
@@ -0,0 +1,186 @@
+#include "GLStateCache.hpp"
+
+// C++ Standard Libraries
+#include <algorithm>
+
+// Never a valid object name or enable state, so never equal to a real value
+static const GLuint kUnknown = 0xFFFFFFFF;
+
+static const GLenum kBufferTargets[] =
+{
+   GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER,
+   GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+   GL_PIXEL_PACK_BUFFER, GL_PIXEL_UNPACK_BUFFER,
+   GL_UNIFORM_BUFFER, GL_TEXTURE_BUFFER,
+   GL_TRANSFORM_FEEDBACK_BUFFER, GL_DRAW_INDIRECT_BUFFER,
+};
+
+static const GLenum kTextureTargets[] =
+{
+   GL_TEXTURE_1D, GL_TEXTURE_2D, GL_TEXTURE_3D,
+   GL_TEXTURE_CUBE_MAP, GL_TEXTURE_1D_ARRAY, GL_TEXTURE_2D_ARRAY,
+   GL_TEXTURE_RECTANGLE,
+};
+
+static const GLenum kCapabilities[] =
+{
+   GL_DEPTH_TEST, GL_STENCIL_TEST, GL_SCISSOR_TEST, GL_CULL_FACE,
+   GL_BLEND, GL_POLYGON_OFFSET_FILL, GL_MULTISAMPLE, GL_FRAMEBUFFER_SRGB,
+};
+
+/**
+* @return Index of Value in Values, or -1 if it is not there.
+*/
+template <std::size_t Count>
+static int IndexOf(const GLenum (&Values)[Count], GLenum Value)
+{
+   const GLenum* found = std::find(Values, Values + Count, Value);
+   return found == Values + Count ? -1 : static_cast<int>(found - Values);
+}
+
+GLStateCache::GLStateCache()
+{
+   static_assert(sizeof(kBufferTargets) / sizeof(GLenum) == kBufferTargetCount, "Buffer targets");
+   static_assert(sizeof(kTextureTargets) / sizeof(GLenum) == kTextureTargetCount, "Texture targets");
+   static_assert(sizeof(kCapabilities) / sizeof(GLenum) == kCapabilityCount, "Capabilities");
+   Invalidate();
+}
+
+void GLStateCache::Invalidate()
+{
+   mProgram = kUnknown;
+   mVertexArray = kUnknown;
+   std::fill(mBuffers, mBuffers + kBufferTargetCount, kUnknown);
+   mActiveTexture = kUnknown;
+   std::fill(&mTextures[0][0], &mTextures[0][0] + kTextureUnitCount * kTextureTargetCount, kUnknown);
+   std::fill(mCapabilities, mCapabilities + kCapabilityCount, kUnknown);
+   mViewportKnown = false;
+   mClearColorKnown = false;
+}
+
+void GLStateCache::ResetCounters()
+{
+   mIssued = 0;
+   mSkipped = 0;
+}
+
+bool GLStateCache::Changed(GLuint* Current, GLuint Value)
+{
+   if (Current != nullptr && *Current == Value)
+   {
+      ++mSkipped;
+      return false;
+   }
+
+   if (Current != nullptr)
+   {
+      *Current = Value;
+   }
+   ++mIssued;
+   return true;
+}
+
+void GLStateCache::UseProgram(GLuint Program)
+{
+   if (Changed(&mProgram, Program))
+   {
+      glUseProgram(Program);
+   }
+}
+
+void GLStateCache::BindVertexArray(GLuint VertexArray)
+{
+   if (Changed(&mVertexArray, VertexArray))
+   {
+      glBindVertexArray(VertexArray);
+      mBuffers[IndexOf(kBufferTargets, GL_ELEMENT_ARRAY_BUFFER)] = kUnknown;
+   }
+}
+
+void GLStateCache::BindBuffer(GLenum Target, GLuint Buffer)
+{
+   const int target = IndexOf(kBufferTargets, Target);
+   if (Changed(target < 0 ? nullptr : &mBuffers[target], Buffer))
+   {
+      glBindBuffer(Target, Buffer);
+   }
+}
+
+void GLStateCache::BindTexture(GLuint Unit, GLenum Target, GLuint Texture)
+{
+   if (Changed(&mActiveTexture, Unit))
+   {
+      glActiveTexture(GL_TEXTURE0 + Unit);
+   }
+
+   const int target = IndexOf(kTextureTargets, Target);
+   const bool tracked = target >= 0 && Unit < kTextureUnitCount;
+   if (Changed(tracked ? &mTextures[Unit][target] : nullptr, Texture))
+   {
+      glBindTexture(Target, Texture);
+   }
+}
+
+void GLStateCache::SetEnabled(GLenum Capability, bool Enabled)
+{
+   const int capability = IndexOf(kCapabilities, Capability);
+   if (!Changed(capability < 0 ? nullptr : &mCapabilities[capability], Enabled ? 1 : 0))
+   {
+      return;
+   }
+
+   if (Enabled)
+   {
+      glEnable(Capability);
+   }
+   else
+   {
+      glDisable(Capability);
+   }
+}
+
+void GLStateCache::Enable(GLenum Capability)
+{
+   SetEnabled(Capability, true);
+}
+
+void GLStateCache::Disable(GLenum Capability)
+{
+   SetEnabled(Capability, false);
+}
+
+void GLStateCache::Viewport(GLint X, GLint Y, GLsizei Width, GLsizei Height)
+{
+   const GLint viewport[4] = { X, Y, Width, Height };
+   if (mViewportKnown && std::equal(viewport, viewport + 4, mViewport))
+   {
+      ++mSkipped;
+      return;
+   }
+
+   std::copy(viewport, viewport + 4, mViewport);
+   mViewportKnown = true;
+   ++mIssued;
+   glViewport(X, Y, Width, Height);
+}
+
+void GLStateCache::ClearColor(GLfloat Red, GLfloat Green, GLfloat Blue, GLfloat Alpha)
+{
+   const GLfloat color[4] = { Red, Green, Blue, Alpha };
+   if (mClearColorKnown && std::equal(color, color + 4, mClearColor))
+   {
+      ++mSkipped;
+      return;
+   }
+
+   std::copy(color, color + 4, mClearColor);
+   mClearColorKnown = true;
+   ++mIssued;
+   glClearColor(Red, Green, Blue, Alpha);
+}
+
+GLStateCache& GLState()
+{
+   thread_local GLStateCache cache;
+   return cache;
+}
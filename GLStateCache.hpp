@@ -0,0 +1,109 @@
+#pragma once
+
+// Third Party Libraries
+#include <glad/glad.h>
+
+/**
+* GLStateCache keeps a shadow copy of the OpenGL state we set every frame
+*  (program, vertex array, buffer and texture bindings, enables, viewport and
+*  clear color), and only calls the driver when a value actually changes.
+*  Each of those calls costs validation work in the driver even when it sets
+*  what is already there, and a frame sets the same state over and over.
+*
+* The cache only knows what went through it. Everything starts out unknown,
+*  so the first call for each piece of state always reaches the driver. Call
+*  Invalidate() after anything that changes this state behind its back: raw
+*  gl calls, deleting a bound object (which unbinds it), or making another
+*  context current on the thread.
+*
+* OpenGL state belongs to a context, and a context is current on a thread, so
+*  there is one cache per thread, returned by GLState().
+*
+* E.g.
+*  GLState().UseProgram(program);     // issued
+*  GLState().UseProgram(program);     // skipped
+*  GLState().Disable(GL_DEPTH_TEST);  // issued the first time only
+*/
+class GLStateCache
+{
+public:
+   GLStateCache();
+
+   GLStateCache(const GLStateCache&) = delete;
+   GLStateCache& operator=(const GLStateCache&) = delete;
+
+   /**
+   * Forgets all the state: the next call for each piece of state is issued.
+   */
+   void Invalidate();
+
+   void UseProgram(GLuint Program);
+
+   /**
+   * Binding a vertex array also forgets the GL_ELEMENT_ARRAY_BUFFER binding,
+   *  which is part of the vertex array.
+   */
+   void BindVertexArray(GLuint VertexArray);
+
+   /**
+   * Targets other than the usual ones (array, element array, copy, pixel,
+   *  uniform, texture and indirect buffers) are always issued.
+   */
+   void BindBuffer(GLenum Target, GLuint Buffer);
+
+   /**
+   * Selects texture unit Unit (glActiveTexture) and binds Texture to it.
+   *  Units past kTextureUnitCount and unusual targets are always issued.
+   */
+   void BindTexture(GLuint Unit, GLenum Target, GLuint Texture);
+
+   /**
+   * Capabilities other than depth, stencil and scissor tests, face culling,
+   *  blending, polygon offset, multisample and sRGB writes are always issued.
+   */
+   void Enable(GLenum Capability);
+   void Disable(GLenum Capability);
+
+   void Viewport(GLint X, GLint Y, GLsizei Width, GLsizei Height);
+   void ClearColor(GLfloat Red, GLfloat Green, GLfloat Blue, GLfloat Alpha);
+
+   /**
+   * @return Number of calls that reached the driver / were skipped since the
+   *  last ResetCounters(). Reset them at the start of a frame to get per
+   *  frame counts.
+   */
+   int GetIssuedCount() const { return mIssued; }
+   int GetSkippedCount() const { return mSkipped; }
+   void ResetCounters();
+
+   static const int kTextureUnitCount = 16;
+
+private:
+   static const int kBufferTargetCount = 10;
+   static const int kTextureTargetCount = 7;
+   static const int kCapabilityCount = 8;
+
+   // Stores Value in Current and counts the call as issued if they differ,
+   //  or counts it as skipped. Current is nullptr for untracked state.
+   bool Changed(GLuint* Current, GLuint Value);
+   void SetEnabled(GLenum Capability, bool Enabled);
+
+   GLuint mProgram;
+   GLuint mVertexArray;
+   GLuint mBuffers[kBufferTargetCount];
+   GLuint mActiveTexture;
+   GLuint mTextures[kTextureUnitCount][kTextureTargetCount];
+   GLuint mCapabilities[kCapabilityCount];
+   bool mViewportKnown;
+   GLint mViewport[4];
+   bool mClearColorKnown;
+   GLfloat mClearColor[4];
+
+   int mIssued = 0;
+   int mSkipped = 0;
+};
+
+/**
+* @return The state cache of the context current on the calling thread.
+*/
+GLStateCache& GLState();
@@ -0,0 +1,147 @@
+#include "GpuProfiler.hpp"
+
+// C++ Standard Libraries
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+
+GpuProfiler* GpuProfiler::sCurrent = nullptr;
+
+static std::int64_t CpuNanoseconds()
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+GpuProfiler::GpuProfiler()
+{
+   GLint64 gpu = 0;
+   glGetInteger64v(GL_TIMESTAMP, &gpu);
+   mCpuOrigin = CpuNanoseconds();
+   mGpuOrigin = gpu;
+}
+
+GpuProfiler::~GpuProfiler()
+{
+   if (sCurrent == this)
+   {
+      sCurrent = nullptr;
+   }
+
+   for (Frame& frame : mFrames)
+   {
+      glDeleteQueries(static_cast<GLsizei>(frame.Queries.size()), frame.Queries.data());
+   }
+}
+
+int GpuProfiler::NextQuery()
+{
+   Frame& frame = mFrames[mFrame];
+   if (frame.QueryCount == static_cast<int>(frame.Queries.size()))
+   {
+      // The pool grows during the first frames, then stays the same
+      GLuint query = 0;
+      glGenQueries(1, &query);
+      frame.Queries.push_back(query);
+   }
+   return frame.QueryCount++;
+}
+
+int GpuProfiler::BeginScope(const char* Name)
+{
+   Frame& frame = mFrames[mFrame];
+
+   Scope scope;
+   scope.Name = Name;
+   scope.QueryBegin = NextQuery();
+   scope.QueryEnd = -1;
+   glQueryCounter(frame.Queries[scope.QueryBegin], GL_TIMESTAMP);
+   scope.CpuBegin = CpuNanoseconds();
+   scope.CpuEnd = scope.CpuBegin;
+
+   frame.Scopes.push_back(scope);
+   return static_cast<int>(frame.Scopes.size()) - 1;
+}
+
+void GpuProfiler::EndScope(int Index)
+{
+   Frame& frame = mFrames[mFrame];
+   Scope& scope = frame.Scopes[Index];
+   scope.CpuEnd = CpuNanoseconds();
+   scope.QueryEnd = NextQuery();
+   glQueryCounter(frame.Queries[scope.QueryEnd], GL_TIMESTAMP);
+}
+
+void GpuProfiler::Collect(Frame& Recorded)
+{
+   for (const Scope& scope : Recorded.Scopes)
+   {
+      // Normally available long ago; if not, GL_QUERY_RESULT waits for it
+      GLuint64 begin = 0;
+      GLuint64 end = 0;
+      glGetQueryObjectui64v(Recorded.Queries[scope.QueryBegin], GL_QUERY_RESULT, &begin);
+      glGetQueryObjectui64v(Recorded.Queries[scope.QueryEnd], GL_QUERY_RESULT, &end);
+
+      mEvents.push_back(Event{ scope.Name, false, scope.CpuBegin, scope.CpuEnd });
+      mEvents.push_back(Event{ scope.Name, true,
+                               static_cast<std::int64_t>(begin) - mGpuOrigin + mCpuOrigin,
+                               static_cast<std::int64_t>(end) - mGpuOrigin + mCpuOrigin });
+   }
+
+   Recorded.Scopes.clear();
+   Recorded.QueryCount = 0;
+}
+
+void GpuProfiler::BeginFrame()
+{
+   mFrame = (mFrame + 1) % kFrameLatency;
+   if (mPending == kFrameLatency)
+   {
+      // This slot holds the frame recorded kFrameLatency frames ago
+      Collect(mFrames[mFrame]);
+      --mPending;
+   }
+   ++mPending;
+
+   mFrameScope = BeginScope("Frame");
+}
+
+void GpuProfiler::EndFrame()
+{
+   EndScope(mFrameScope);
+}
+
+void GpuProfiler::Finish()
+{
+   // Oldest first, so that the events stay in order
+   for (int i = mPending - 1; i >= 0; --i)
+   {
+      Collect(mFrames[(mFrame - i + kFrameLatency) % kFrameLatency]);
+   }
+   mPending = 0;
+}
+
+bool GpuProfiler::WriteChromeTrace(const std::string& Path) const
+{
+   std::ofstream output(Path);
+   if (!output)
+   {
+      return false;
+   }
+
+   // Microseconds from the creation of the profiler
+   output << std::fixed << std::setprecision(3);
+   output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+          << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n"
+          << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}";
+   for (const Event& event : mEvents)
+   {
+      output << ",\n{\"name\":\"" << event.Name
+             << "\",\"cat\":\"" << (event.Gpu ? "gpu" : "cpu")
+             << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << (event.Gpu ? 2 : 1)
+             << ",\"ts\":" << (event.Begin - mCpuOrigin) / 1000.0
+             << ",\"dur\":" << (event.End - event.Begin) / 1000.0 << "}";
+   }
+   output << "\n]}\n";
+   return static_cast<bool>(output);
+}
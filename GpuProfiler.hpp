@@ -0,0 +1,165 @@
+#pragma once
+
+// Third Party Libraries
+#include <glad/glad.h>
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+* GpuProfiler measures named scopes of a frame, both on the CPU and on the
+*  GPU, and writes them as a Chrome trace (chrome://tracing, about:tracing
+*  or https://ui.perfetto.dev), CPU scopes on one row and GPU scopes on
+*  another, on the same timeline.
+*
+* Each scope puts a glQueryCounter(GL_TIMESTAMP) at its start and at its end,
+*  and reads the steady clock at the same points. Query objects come from a
+*  pool per frame in flight, and the results of a frame are only read back
+*  kFrameLatency frames later, when the GPU is done with it, so profiling
+*  does not make the CPU wait for the GPU. Scopes nest, and every frame is a
+*  scope of its own, "Frame", around them.
+*
+* Scopes go to the current profiler (see SetCurrent()); with none, GPU_SCOPE
+*  costs a pointer test. Like the GL calls it times, the profiler is used
+*  from the render thread only.
+*
+* E.g.
+*  GpuProfiler profiler;
+*  GpuProfiler::SetCurrent(&profiler);
+*  // Every frame
+*  profiler.BeginFrame();
+*  {
+*     GPU_SCOPE("Draw");
+*     ... draw calls ...
+*  }
+*  profiler.EndFrame();
+*  // Done
+*  profiler.Finish();
+*  profiler.WriteChromeTrace("trace.json");
+*/
+class GpuProfiler
+{
+public:
+   // Frames between recording a frame and reading its queries back
+   static const int kFrameLatency = 3;
+
+   GpuProfiler();
+   ~GpuProfiler();
+
+   GpuProfiler(const GpuProfiler&) = delete;
+   GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+   /**
+   * Profiler used by GPU_SCOPE, nullptr for none.
+   */
+   static void SetCurrent(GpuProfiler* Profiler) { sCurrent = Profiler; }
+   static GpuProfiler* GetCurrent() { return sCurrent; }
+
+   /**
+   * Starts a frame, after collecting the results of the frame recorded
+   *  kFrameLatency frames ago.
+   */
+   void BeginFrame();
+   // Closes the scope of the frame
+   void EndFrame();
+
+   /**
+   * Opens a scope. Name must outlive the profiler (a string literal).
+   * @return Scope to pass to EndScope()
+   */
+   int BeginScope(const char* Name);
+   void EndScope(int Scope);
+
+   /**
+   * Waits for the GPU and collects the frames not collected yet. Call it
+   *  after the last EndFrame().
+   */
+   void Finish();
+
+   /**
+   * Writes every collected scope in the Chrome trace event format.
+   * @return false if the file could not be written.
+   */
+   bool WriteChromeTrace(const std::string& Path) const;
+
+private:
+   struct Scope
+   {
+      const char* Name;
+      std::int64_t CpuBegin;
+      std::int64_t CpuEnd;
+      // Indices in the frame's query pool
+      int QueryBegin;
+      int QueryEnd;
+   };
+
+   // Collected scope, in nanoseconds on the CPU timeline
+   struct Event
+   {
+      const char* Name;
+      bool Gpu;
+      std::int64_t Begin;
+      std::int64_t End;
+   };
+
+   struct Frame
+   {
+      std::vector<GLuint> Queries;
+      int QueryCount = 0;
+      std::vector<Scope> Scopes;
+   };
+
+   int NextQuery();
+   void Collect(Frame& Recorded);
+
+   static GpuProfiler* sCurrent;
+
+   Frame mFrames[kFrameLatency];
+   int mFrame = 0;
+   int mFrameScope = 0;
+   // Frames begun and not collected yet
+   int mPending = 0;
+   // GPU timestamp and steady clock read at the same time, to move GPU
+   //  timestamps on the CPU timeline
+   std::int64_t mGpuOrigin = 0;
+   std::int64_t mCpuOrigin = 0;
+   std::vector<Event> mEvents;
+};
+
+/**
+* Measures the enclosing block, see GPU_SCOPE.
+*/
+class GpuProfileScope
+{
+public:
+   explicit GpuProfileScope(const char* Name)
+      : mProfiler(GpuProfiler::GetCurrent())
+   {
+      if (mProfiler != nullptr)
+      {
+         mScope = mProfiler->BeginScope(Name);
+      }
+   }
+
+   ~GpuProfileScope()
+   {
+      if (mProfiler != nullptr)
+      {
+         mProfiler->EndScope(mScope);
+      }
+   }
+
+   GpuProfileScope(const GpuProfileScope&) = delete;
+   GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+
+private:
+   GpuProfiler* mProfiler;
+   int mScope = 0;
+};
+
+#define GPU_SCOPE_CONCATENATE(a, b) a##b
+#define GPU_SCOPE_VARIABLE(Line) GPU_SCOPE_CONCATENATE(gpuProfileScope, Line)
+// Profiles the rest of the enclosing block, on the CPU and on the GPU
+#define GPU_SCOPE(Name) GpuProfileScope GPU_SCOPE_VARIABLE(__LINE__)(Name)
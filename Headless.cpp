@@ -0,0 +1,414 @@
+#include "Headless.hpp"
+
+// Third Party Libraries
+#if defined(__linux__)
+   // We never talk to X11 here, so do not pull in its headers
+#  define EGL_NO_X11
+#  define MESA_EGL_NO_X11_HEADERS
+#  include <EGL/egl.h>
+#  include <EGL/eglext.h>
+#endif
+
+// Our own modules
+#include "GLDebug.hpp"
+#include "GLLoader.hpp"
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// VVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVV Globals VVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVV
+
+#if defined(__linux__)
+EGLDisplay gHeadlessDisplay = EGL_NO_DISPLAY;
+EGLContext gHeadlessContext = EGL_NO_CONTEXT;
+EGLConfig gHeadlessConfig = nullptr;
+// Shares objects with gHeadlessContext, used by background threads
+EGLContext gHeadlessSharedContext = EGL_NO_CONTEXT;
+#endif
+
+// Offscreen render target used instead of the window's default framebuffer
+GLuint gOffscreenFramebuffer = 0;
+GLuint gOffscreenColorBuffer = 0;
+GLuint gOffscreenDepthBuffer = 0;
+
+// ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ Globals ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+
+#if defined(__linux__)
+
+// Same version and profile that InitializeProgram() asks SDL for
+static const EGLint kContextAttributes[] =
+{
+   EGL_CONTEXT_MAJOR_VERSION, 4,
+   EGL_CONTEXT_MINOR_VERSION, 1,
+   EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+#if GL_DEBUG_CAPTURE
+   EGL_CONTEXT_OPENGL_DEBUG, EGL_TRUE,
+#endif
+   EGL_NONE
+};
+
+/**
+* Retrieves a display that does not need a window system. We prefer Mesa's
+*  surfaceless platform and fall back to the default display otherwise.
+*/
+static EGLDisplay GetHeadlessDisplay()
+{
+   PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+      (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+   if (getPlatformDisplay != nullptr)
+   {
+      EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA,
+                                              EGL_DEFAULT_DISPLAY,
+                                              nullptr);
+      if (display != EGL_NO_DISPLAY)
+      {
+         return display;
+      }
+   }
+
+   return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+bool InitializeHeadlessContext()
+{
+   gHeadlessDisplay = GetHeadlessDisplay();
+   if (gHeadlessDisplay == EGL_NO_DISPLAY ||
+       !eglInitialize(gHeadlessDisplay, nullptr, nullptr))
+   {
+      std::cerr << "EGL display could not be initialized. EGL Error: "
+                << eglGetError()
+                << "\n";
+      return false;
+   }
+
+   // We want desktop OpenGL, not OpenGL ES
+   if (!eglBindAPI(EGL_OPENGL_API))
+   {
+      std::cerr << "EGL does not support the OpenGL API" << std::endl;
+      return false;
+   }
+
+   // We never create a surface, so any config that can render OpenGL will do
+   const EGLint configAttributes[] =
+   {
+      EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+      EGL_SURFACE_TYPE, 0,
+      EGL_NONE
+   };
+   EGLint configCount = 0;
+   if (!eglChooseConfig(gHeadlessDisplay, configAttributes, &gHeadlessConfig, 1, &configCount) ||
+       configCount == 0)
+   {
+      std::cerr << "No EGL config supports OpenGL. EGL Error: "
+                << eglGetError()
+                << "\n";
+      return false;
+   }
+
+   gHeadlessContext = eglCreateContext(gHeadlessDisplay,
+                                       gHeadlessConfig,
+                                       EGL_NO_CONTEXT,
+                                       kContextAttributes);
+   if (gHeadlessContext == EGL_NO_CONTEXT)
+   {
+      std::cerr << "OpenGL context could not be created. EGL Error: "
+                << eglGetError()
+                << "\n";
+      return false;
+   }
+
+   // Make it current without any draw/read surface (EGL_KHR_surfaceless_context)
+   if (!eglMakeCurrent(gHeadlessDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, gHeadlessContext))
+   {
+      std::cerr << "Surfaceless context could not be made current. EGL Error: "
+                << eglGetError()
+                << "\n";
+      return false;
+   }
+
+   // Initialize the Glad library, this time with EGL's loader
+   if (!LoadOpenGLFunctions((GLADloadproc)eglGetProcAddress))
+   {
+      std::cerr << "Glad was not initialized" << std::endl;
+      return false;
+   }
+
+   return true;
+}
+
+bool CreateHeadlessSharedContext()
+{
+   gHeadlessSharedContext = eglCreateContext(gHeadlessDisplay,
+                                             gHeadlessConfig,
+                                             gHeadlessContext,
+                                             kContextAttributes);
+   if (gHeadlessSharedContext == EGL_NO_CONTEXT)
+   {
+      std::cerr << "Shared OpenGL context could not be created. EGL Error: "
+                << eglGetError()
+                << "\n";
+      return false;
+   }
+   return true;
+}
+
+bool MakeHeadlessSharedContextCurrent()
+{
+   return eglMakeCurrent(gHeadlessDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, gHeadlessSharedContext) == EGL_TRUE;
+}
+
+void ReleaseHeadlessSharedContext()
+{
+   eglMakeCurrent(gHeadlessDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+   eglReleaseThread();
+}
+
+#else
+
+bool InitializeHeadlessContext()
+{
+   std::cerr << "Headless mode requires EGL and is only supported on Linux"
+             << std::endl;
+   return false;
+}
+
+bool CreateHeadlessSharedContext()
+{
+   return false;
+}
+
+bool MakeHeadlessSharedContextCurrent()
+{
+   return false;
+}
+
+void ReleaseHeadlessSharedContext()
+{
+}
+
+#endif
+
+bool CreateOffscreenFramebuffer(int Width, int Height)
+{
+   // Color attachment
+   glGenRenderbuffers(1, &gOffscreenColorBuffer);
+   glBindRenderbuffer(GL_RENDERBUFFER, gOffscreenColorBuffer);
+   glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, Width, Height);
+
+   // Depth attachment (24 bits, same as the window in InitializeProgram())
+   glGenRenderbuffers(1, &gOffscreenDepthBuffer);
+   glBindRenderbuffer(GL_RENDERBUFFER, gOffscreenDepthBuffer);
+   glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, Width, Height);
+   glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+   glGenFramebuffers(1, &gOffscreenFramebuffer);
+   glBindFramebuffer(GL_FRAMEBUFFER, gOffscreenFramebuffer);
+   glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, gOffscreenColorBuffer);
+   glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, gOffscreenDepthBuffer);
+
+   // Leave it bound: every glClear/glDraw* from now on lands in here
+   if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+   {
+      std::cerr << "Offscreen framebuffer is not complete" << std::endl;
+      return false;
+   }
+
+   return true;
+}
+
+void DestroyHeadlessContext()
+{
+   if (gOffscreenFramebuffer != 0)
+   {
+      glBindFramebuffer(GL_FRAMEBUFFER, 0);
+      glDeleteFramebuffers(1, &gOffscreenFramebuffer);
+      glDeleteRenderbuffers(1, &gOffscreenColorBuffer);
+      glDeleteRenderbuffers(1, &gOffscreenDepthBuffer);
+      gOffscreenFramebuffer = 0;
+   }
+
+#if defined(__linux__)
+   if (gHeadlessDisplay != EGL_NO_DISPLAY)
+   {
+      eglMakeCurrent(gHeadlessDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+      if (gHeadlessSharedContext != EGL_NO_CONTEXT)
+      {
+         eglDestroyContext(gHeadlessDisplay, gHeadlessSharedContext);
+         gHeadlessSharedContext = EGL_NO_CONTEXT;
+      }
+      if (gHeadlessContext != EGL_NO_CONTEXT)
+      {
+         eglDestroyContext(gHeadlessDisplay, gHeadlessContext);
+         gHeadlessContext = EGL_NO_CONTEXT;
+      }
+      eglTerminate(gHeadlessDisplay);
+      gHeadlessDisplay = EGL_NO_DISPLAY;
+   }
+#endif
+}
+
+// VVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVV FrameTimer VVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVV
+
+FrameTimer::FrameTimer(int FrameCount)
+{
+   mCpuMilliseconds.reserve(FrameCount);
+   mGpuMilliseconds.reserve(FrameCount);
+   glGenQueries(2 * kFrameLatency, &mQueries[0][0]);
+}
+
+FrameTimer::~FrameTimer()
+{
+   glDeleteQueries(2 * kFrameLatency, &mQueries[0][0]);
+}
+
+void FrameTimer::Collect(int Slot)
+{
+   // Normally available long ago; if not, GL_QUERY_RESULT waits for it
+   GLuint64 begin = 0;
+   GLuint64 end = 0;
+   glGetQueryObjectui64v(mQueries[Slot][0], GL_QUERY_RESULT, &begin);
+   glGetQueryObjectui64v(mQueries[Slot][1], GL_QUERY_RESULT, &end);
+   mPending[Slot] = false;
+
+   const double milliseconds = static_cast<double>(end - begin) / 1.0e6;
+   if (end < begin || milliseconds > kMaxGpuMilliseconds)
+   {
+      ++mRejected;
+      return;
+   }
+   mGpuMilliseconds.push_back(milliseconds);
+}
+
+void FrameTimer::BeginFrame()
+{
+   const int slot = mCurrentFrame % kFrameLatency;
+   if (mPending[slot])
+   {
+      // This slot holds the frame recorded kFrameLatency frames ago
+      Collect(slot);
+   }
+
+   mFrameStart = std::chrono::steady_clock::now();
+   glQueryCounter(mQueries[slot][0], GL_TIMESTAMP);
+   // llvmpipe writes a timestamp when the commands around it are done, so
+   //  send it alone, before the commands of the frame
+   glFlush();
+}
+
+void FrameTimer::EndFrame()
+{
+   const int slot = mCurrentFrame % kFrameLatency;
+
+   // CPU time is the time it took to submit the frame
+   std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - mFrameStart;
+
+   // Without a swap nothing forces the commands out; wait for the frame to
+   //  be done before the timestamp that closes it (see FrameTimer)
+   glFinish();
+   glQueryCounter(mQueries[slot][1], GL_TIMESTAMP);
+   glFlush();
+
+   if (mCurrentFrame >= kWarmupFrames)
+   {
+      mCpuMilliseconds.push_back(elapsed.count());
+      mPending[slot] = true;
+   }
+   ++mCurrentFrame;
+}
+
+void FrameTimer::AddStateCalls(int Issued, int Skipped)
+{
+   if (mCurrentFrame >= kWarmupFrames)
+   {
+      mStateCallsIssued += Issued;
+      mStateCallsSkipped += Skipped;
+   }
+}
+
+void FrameTimer::Finish()
+{
+   // Oldest first
+   for (int i = kFrameLatency; i > 0; --i)
+   {
+      const int slot = (mCurrentFrame - i + kFrameLatency) % kFrameLatency;
+      if (mCurrentFrame - i >= 0 && mPending[slot])
+      {
+         Collect(slot);
+      }
+   }
+}
+
+/**
+* Writes Text as a JSON string, quotes included. Drivers pick their renderer
+*  strings freely, so quotes, backslashes and control characters are escaped.
+*/
+static void WriteString(std::ostream& Output, const char* Text)
+{
+   static const char kHex[] = "0123456789abcdef";
+
+   Output << '"';
+   for (const char* c = Text != nullptr ? Text : ""; *c != '\0'; ++c)
+   {
+      const unsigned char character = static_cast<unsigned char>(*c);
+      if (character == '"' || character == '\\')
+      {
+         Output << '\\' << *c;
+      }
+      else if (character < 0x20)
+      {
+         Output << "\\u00" << kHex[character >> 4] << kHex[character & 0xf];
+      }
+      else
+      {
+         Output << *c;
+      }
+   }
+   Output << '"';
+}
+
+/**
+* Writes {"min":..,"median":..,"p99":..} for a set of samples.
+* Percentiles use the nearest-rank method.
+*/
+static void WriteSummary(std::ostream& Output, std::vector<double> Samples)
+{
+   if (Samples.empty())
+   {
+      Output << "null";
+      return;
+   }
+
+   std::sort(Samples.begin(), Samples.end());
+   const std::size_t median = (Samples.size() - 1) / 2;
+   const std::size_t p99 = static_cast<std::size_t>(std::ceil(0.99 * Samples.size())) - 1;
+
+   Output << "{\"min\": " << Samples.front()
+          << ", \"median\": " << Samples[median]
+          << ", \"p99\": " << Samples[p99]
+          << "}";
+}
+
+void FrameTimer::WriteJson(std::ostream& Output) const
+{
+   const double frames = mCpuMilliseconds.empty() ? 1.0 : static_cast<double>(mCpuMilliseconds.size());
+
+   Output << "{\n"
+          << "  \"frames\": " << mCpuMilliseconds.size() << ",\n"
+          << "  \"warmup_frames\": " << (mCurrentFrame < kWarmupFrames ? mCurrentFrame : kWarmupFrames) << ",\n"
+          << "  \"renderer\": ";
+   WriteString(Output, reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+   Output << ",\n  \"cpu_ms\": ";
+   WriteSummary(Output, mCpuMilliseconds);
+   Output << ",\n  \"gpu_ms\": ";
+   WriteSummary(Output, mGpuMilliseconds);
+   Output << ",\n  \"gpu_rejected\": " << mRejected
+          << ",\n  \"state_calls_issued\": " << mStateCallsIssued / frames
+          << ",\n  \"state_calls_skipped\": " << mStateCallsSkipped / frames
+          << "\n}" << std::endl;
+}
+
+// ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ FrameTimer ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
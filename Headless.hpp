@@ -0,0 +1,141 @@
+#pragma once
+
+// Third Party Libraries
+#include <glad/glad.h>
+
+// C++ Standard Libraries
+#include <chrono>
+#include <ostream>
+#include <vector>
+
+/**
+* Headless rendering support.
+* Instead of an SDL window, we create an OpenGL context that has no surface at
+*  all (EGL surfaceless, which Mesa's llvmpipe supports), and render into an
+*  offscreen framebuffer object (FBO). This lets us run the render path on
+*  machines that have no display and no GPU, e.g. CI boxes.
+*/
+
+/**
+* Creates a surfaceless OpenGL 4.1 core context, makes it current and loads
+*  the OpenGL function pointers with glad.
+* @return true if the context was created and glad was initialized.
+*/
+bool InitializeHeadlessContext();
+
+/**
+* Creates (and binds) an offscreen framebuffer object with a color and a depth
+*  attachment, so that PreDraw() and Draw() have somewhere to render into.
+* @param Width Width of the attachments in pixels
+* @param Height Height of the attachments in pixels
+* @return true if the framebuffer is complete.
+*/
+bool CreateOffscreenFramebuffer(int Width, int Height);
+
+/**
+* Creates a second context that shares its objects (programs, buffers...) with
+*  the headless one, for work done on a background thread such as shader
+*  hot-reload. Call it on the main thread, after InitializeHeadlessContext().
+* @return true if the context was created.
+*/
+bool CreateHeadlessSharedContext();
+
+/**
+* Makes the shared context current on the calling (background) thread.
+* @return true on success.
+*/
+bool MakeHeadlessSharedContextCurrent();
+
+/**
+* Releases the shared context from the calling (background) thread.
+*/
+void ReleaseHeadlessSharedContext();
+
+/**
+* Deletes the offscreen framebuffer and destroys the headless context (and
+*  the shared one, if any).
+*/
+void DestroyHeadlessContext();
+
+/**
+* FrameTimer records how long every frame takes on the CPU and on the GPU.
+* CPU time is measured with a steady clock, from the start of the frame to
+*  the end of its submission.
+* GPU time is the difference of two GL_TIMESTAMP queries, one at the start
+*  of the frame and one once the frame is finished. Software rasterizers such
+*  as llvmpipe only rasterize when the commands are flushed, and write a
+*  timestamp when the commands flushed with it are done, so each timestamp
+*  is flushed on its own and EndFrame() waits for the frame with glFinish()
+*  before the second one. Frames are thus measured one at a time, without
+*  overlapping.
+* The query pairs come from a ring of kFrameLatency slots, and the results
+*  of a frame are read back when its slot is reused. Results that cannot be
+*  a frame time (the end before the start, or longer than
+*  kMaxGpuMilliseconds) are rejected and counted instead.
+* The first kWarmupFrames frames, which pay for shader compilation and the
+*  first uploads, are rendered but not recorded.
+*/
+class FrameTimer
+{
+public:
+   // Frames rendered before the measured ones
+   static const int kWarmupFrames = 3;
+   // Frames between recording a frame and reading its queries back
+   static const int kFrameLatency = 3;
+   // Longest GPU time accepted for a frame
+   static constexpr double kMaxGpuMilliseconds = 10000.0;
+
+   /**
+   * @param FrameCount Number of frames that will be recorded, after the
+   *  warm-up frames
+   */
+   explicit FrameTimer(int FrameCount);
+   ~FrameTimer();
+
+   FrameTimer(const FrameTimer&) = delete;
+   FrameTimer& operator=(const FrameTimer&) = delete;
+
+   // Wrap the calls that make up a frame with these two.
+   void BeginFrame();
+   void EndFrame();
+
+   /**
+   * Adds state calls to the frame being recorded (see GLStateCache), for the
+   *  per frame averages of the report. Call it before EndFrame(). Warm-up
+   *  frames are not counted.
+   * @param Issued Calls that reached the driver
+   * @param Skipped Calls the state cache skipped
+   */
+   void AddStateCalls(int Issued, int Skipped);
+
+   /**
+   * Waits for the GPU and reads back the pending queries.
+   * Must be called once after the last EndFrame().
+   */
+   void Finish();
+
+   /**
+   * Writes min/median/p99 of the CPU and GPU frame times, and the average
+   *  state calls per frame, as JSON.
+   * @param Output Stream to write to (e.g. std::cout)
+   */
+   void WriteJson(std::ostream& Output) const;
+
+private:
+   // Reads the queries of a slot and records the GPU time of its frame
+   void Collect(int Slot);
+
+   // Start and end GL_TIMESTAMP queries of each frame in flight
+   GLuint mQueries[kFrameLatency][2] = {};
+   // Whether the slot holds a frame whose queries were not read yet
+   bool mPending[kFrameLatency] = {};
+   std::vector<double> mCpuMilliseconds;
+   std::vector<double> mGpuMilliseconds;
+   std::chrono::steady_clock::time_point mFrameStart;
+   // Frames begun, warm-up frames included
+   int mCurrentFrame = 0;
+   int mRejected = 0;
+   // State calls of the recorded frames
+   long long mStateCallsIssued = 0;
+   long long mStateCallsSkipped = 0;
+};
@@ -1,14 +1,34 @@
 // Third Party Libraries
 #include "SDL.h"
 #include <glad/glad.h>
+#define GLM_ENABLE_EXPERIMENTAL
 #include <glm/vec3.hpp>
 #include <glm/mat4x4.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtx/frustum.hpp>
+
+// Our own modules
+#include "BatchRenderer.hpp"
+#include "GLDebug.hpp"
+#include "GLLoader.hpp"
+#include "GLStateCache.hpp"
+#include "GpuProfiler.hpp"
+#include "Headless.hpp"
+#include "RenderQueue.hpp"
+#include "ShaderCache.hpp"
+#include "ShaderHotReload.hpp"
+#include "Simulation.hpp"
+#include "VertexFormat.hpp"
 
 // C++ Standard Libraries
 #include <iostream>
 #include <vector>
 #include <string>
-#include <fstream>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
 
 
 // VVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVV Globals VVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVV
@@ -23,6 +43,12 @@ SDL_GLContext gOpenGLContext = nullptr;
 // Main loop flag
 bool gQuit = false; // if true, quit
 
+/** Headless benchmark mode (see Headless.hpp) */
+// If true, render offscreen without a window and report frame times as JSON
+bool gHeadless = false;
+// How many frames to render before exiting in headless mode
+int gHeadlessFrameCount = 1000;
+
 /** Pipeline */
 // Shader
 /** 
@@ -34,6 +60,54 @@ bool gQuit = false; // if true, quit
 */
 GLuint gGraphicsPipelineShaderProgram = 0;
 
+// Where the sources of the graphics pipeline live
+const std::string gVertexShaderPath = "./shaders/vert.glsl";
+const std::string gFragmentShaderPath = "./shaders/frag.glsl";
+// Where ShaderCache keeps the program binaries between launches
+const std::string gShaderCacheDirectory = "./shader-cache";
+
+/** Batched drawing (see BatchRenderer.hpp) */
+// With --instances N, Draw() renders a grid of N quads and triangles through
+//  the batch renderer instead of the single quad.
+int gInstanceCount = 0;
+std::unique_ptr<BatchRenderer> gBatchRenderer;
+std::size_t gQuadMesh = 0;
+std::size_t gTriangleMesh = 0;
+// Same as the graphics pipeline, but reads a transform per instance
+GLuint gBatchShaderProgram = 0;
+const std::string gBatchVertexShaderPath = "./shaders/batch_vert.glsl";
+// Bounds of the grid objects, refreshed every frame as they move with
+//  g_uOffset: DrawBatched() only submits those in the view frustum.
+glm::vec3_soa gGridMin;
+glm::vec3_soa gGridMax;
+std::vector<glm::uint32> gGridVisible;
+
+/** Render command queue (see RenderQueue.hpp) */
+// With --queue, the --instances objects are recorded by worker threads into
+//  the render queue instead, and drawn one draw call each.
+bool gUseRenderQueue = false;
+std::unique_ptr<RenderQueue> gRenderQueue;
+// Same as the graphics pipeline, but reads a transform per draw
+GLuint gQueueShaderProgram = 0;
+const std::string gQueueVertexShaderPath = "./shaders/model_vert.glsl";
+
+/** Profiling (see GpuProfiler.hpp) */
+// With --trace FILE, the frames are profiled on the CPU and the GPU, and the
+//  trace is written to FILE on exit, for chrome://tracing.
+std::string gTracePath;
+std::unique_ptr<GpuProfiler> gProfiler;
+
+/** Shader hot-reload (see ShaderHotReload.hpp) */
+// Rebuilds the pipeline when its sources change. Always on with a window,
+//  only with --hot-reload in headless mode.
+bool gHotReload = false;
+std::unique_ptr<ShaderHotReload> gShaderHotReload;
+std::size_t gGraphicsPipelineReloadSlot = 0;
+std::size_t gBatchReloadSlot = 0;
+std::size_t gQueueReloadSlot = 0;
+// Context of the hot-reload thread, sharing objects with gOpenGLContext
+SDL_GLContext gHotReloadContext = nullptr;
+
 /** OpenGL Objects */
 /** 
 * VAO encapsulate all of the items needed to render an object.
@@ -55,6 +129,14 @@ GLuint gVertexArrayObject = 0;
 // VBO:
 GLuint gVertexBufferObject = 0;
 
+/**
+* How the vertices are stored in the VBO (see VertexFormat.hpp). Positions
+*  take 10 bits per coordinate and colors 8 bits per channel: 8 bytes per
+*  vertex instead of the 24 of six floats. The shaders still read floats.
+*/
+const VertexFormat gVertexFormat({ { 0, 3, VertexEncoding::Snorm10_10_10_2 }, // x, y, z
+                                   { 1, 3, VertexEncoding::Unorm8 } });       // r, g, b
+
 /** 
 * Index Buffer Object(IBO) 
 * This is used to store the array of indices that we want to draw from, when we
@@ -69,6 +151,12 @@ GLuint gIndexBufferObject = 0;
 */
 float g_uOffset = 0.0f;
 
+/** Simulation (see Simulation.hpp) */
+// Runs on its own thread at a fixed tick. g_uOffset is its state,
+//  interpolated for the current frame in PreDraw().
+const double gSimulationTickSeconds = 1.0 / 120.0;
+std::unique_ptr<Simulation> gSimulation;
+
 // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ Globals ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
 
 // VVVVVVVVVVVVVVVVVVVVVVVVVV Error Handling Routines VVVVVVVVVVVVVVVVVVVVVVVVVV
@@ -132,184 +220,99 @@ static bool GLCheckErrorStatus(const char* Function, int Line)
 *     GLCheck(glBindBuffer(GL_ARRAY_BUFFER, gVertexBufferObject);)
 *     GLCheck(glDrawElements(GL_TRIANGLES, 6, GL_INT, 0);)
 */
-// To pass the arguments to GLCheckErrorStatus, use # since it's a little string
-#define GLCheck(x) GLClearAllErrors(); x; GLCheckErrorStatus(#x, __LINE__);
+/**
+* GLCheck(x) now lives in GLDebug.hpp. Calling glGetError() around every
+*  wrapped call makes the driver catch up with it each time, so when the
+*  driver supports KHR_debug it reports the errors to us through a callback
+*  instead, and they are logged off the render thread. Without KHR_debug,
+*  GLCheck(x) still works like the two functions above. In release builds
+*  (NDEBUG), GLCheck(x) is just x.
+*/
 
 // ^^^^^^^^^^^^^^^^^^^^^^^^^^ Error Handling Routines ^^^^^^^^^^^^^^^^^^^^^^^^^^
 
-/** 
-* LoadShaderAsString takes a filepath as an argument and will read line by line
-*  a file and return a string that is meant to be compiled at runtime for a
-*  vertex, fragment, geometry, tesselation, or computer shader.
-* E.g.
-*  LoadShaderAsString("./shaders/filepath");
-* @param Filename Path to the shader file
-* @return Entire file stored as a single string
+/**
+* Builds every shader program of the application through the ShaderCache (see
+*  ShaderCache.hpp): the programs are compiled in parallel when the driver
+*  supports it, and their binaries are stored in ./shader-cache so that the
+*  next launch loads them instead of compiling again.
 */
-std::string LoadShaderAsString(const std::string& Filename)
+void CreateGraphicsPipeline()
 {
-   // Resulting shader program loaded as a single string
-   std::string Result = "";
-
-   // Read the file line by line
-   std::string Line = "";
-   // Input file to bring in (@param: Read the content as a string)
-   std::ifstream MyFile(Filename.c_str());
-
-   // if the file was found, parse/read one line at a time
-   if (MyFile.is_open())
+   ShaderCache cache(gShaderCacheDirectory);
+   const std::size_t pipeline = cache.Add(gVertexShaderPath, gFragmentShaderPath);
+   const std::size_t batch = cache.Add(gBatchVertexShaderPath, gFragmentShaderPath);
+   const std::size_t queue = cache.Add(gQueueVertexShaderPath, gFragmentShaderPath);
+
+   // Kick off the work, then wait for it. Other startup work could go in 
+   //  between, polling cache.IsReady().
+   cache.Start();
+   if (!cache.Finish())
    {
-      while (std::getline(MyFile, Line))
-      {
-         // concatenate
-         Result += Line + '\n';
-      }
-      // Close the file before leaving the if statement
-      MyFile.close();
+      std::cerr << "Shader programs could not be built" << std::endl;
+      exit(1);
    }
 
-   return Result;
+   gGraphicsPipelineShaderProgram = cache.GetProgram(pipeline);
+   gBatchShaderProgram = cache.GetProgram(batch);
+   gQueueShaderProgram = cache.GetProgram(queue);
 }
 
-/** 
-* CompileShader will compile any valid vertex, fragment, geometry,
-*  tesselation, or compute shader. E.g. Compile a vertex shader: 
-*  CompileShader(GL_VERTEX_SHADER, vertexShaderSource);
-*  Compile a fragment shader:
-*  CompileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
-* 
-* @param Type: we use 'type' field to determine which shader we are
-*  going to compile.
-* @param Source: the shader source code.
-* @return id of the shaderObject.
+/**
+* Starts watching the shader sources (see ShaderHotReload.hpp). The rebuilds
+*  happen on a background thread, with a second context that shares its
+*  objects with ours. If anything is missing we simply run without it.
 */
-
-// Where the actual compilation happens
-GLuint CompileShader(GLuint Type, const std::string& Source)
+void StartShaderHotReload()
 {
-   // We want to create a shader object based on which enum we have:
-   GLuint shaderObject = 0; // is it ok to initialize to 0?
+   std::function<bool()> bindContext;
+   std::function<void()> releaseContext;
 
-   if (Type == GL_VERTEX_SHADER)
+   if (gHeadless)
    {
-      // Create a vertex shader:
-      // these checking steps aren't necessary,it could be only these 
-      //  creation lines, but they help on later debugging!
-      shaderObject = glCreateShader(GL_VERTEX_SHADER); 
-   }
-   else if (Type == GL_FRAGMENT_SHADER)
-   {
-      // Create a fragment shader:
-      shaderObject = glCreateShader(GL_FRAGMENT_SHADER);
+      if (!CreateHeadlessSharedContext())
+      {
+         return;
+      }
+      bindContext = MakeHeadlessSharedContextCurrent;
+      releaseContext = ReleaseHeadlessSharedContext;
    }
-
-   // the Source needs to be passed as const char array because the API 
-   //  doesn't have strings!
-   const char* src = Source.c_str(); // get the c string version of the string
-   glShaderSource(shaderObject, 1, &src, nullptr);
-   // Once we have the shader we can now compile the actual shader object 
-   //  itself now that we have the source code there.
-   glCompileShader(shaderObject);
-
-   /** Error checking */
-   // Retrieve the result of our compilation
-   int result = 0; // is it ok 0?
-   // Our goal with glGetShaderiv is to retrieve the compilation status
-   glGetShaderiv(shaderObject, GL_COMPILE_STATUS, &result);
-
-   if (result == GL_FALSE)
+   else
    {
-      int length;
-      glGetShaderiv(shaderObject, GL_INFO_LOG_LENGTH, &length);
-      char* errorMessages = new char[length]; // could also use alloc here.
-      glad_glGetShaderInfoLog(shaderObject, length, &length, errorMessages);
-
-      if (Type == GL_VERTEX_SHADER)
+      // SDL_GL_CreateContext makes the new context current, so switch back
+      SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
+      gHotReloadContext = SDL_GL_CreateContext(gGraphicApplicationWindow);
+      SDL_GL_MakeCurrent(gGraphicApplicationWindow, gOpenGLContext);
+      if (gHotReloadContext == nullptr)
       {
-         std::cout << "ERROR: GL_VERTEX_SHADER compilation failed!\n"
-                   << errorMessages
+         std::cerr << "Shared OpenGL context could not be created. SDL Error: "
+                   << SDL_GetError()
                    << "\n";
+         return;
       }
-      else if (Type == GL_FRAGMENT_SHADER)
+      bindContext = []()
       {
-         std::cout << "ERROR: GL_FRAGMENT_SHADER compilation failed!\n"
-                   << errorMessages
-                   << "\n";
-      }
-
-      // Reclaim our memory
-      delete[] errorMessages;
-
-      // Delete our broken shader
-      glDeleteShader(shaderObject);
+         return SDL_GL_MakeCurrent(gGraphicApplicationWindow, gHotReloadContext) == 0;
+      };
+      releaseContext = []()
+      {
+         SDL_GL_MakeCurrent(gGraphicApplicationWindow, nullptr);
+      };
    }
 
-   return shaderObject;
-}
-
-/** 
-* Creates a graphics program object (i.e. graphics pipeline) with a Vertex
-*  Shader and a Fragment Shader
-* 
-* @param vertexShaderSource source code as string
-* @param fragmentShaderSource source code as a string
-* @return id of the program object
-*/
-
-// Returns the handle (a GLuint) to the actual GPU shader program.
-// Its job is to take whatever the result of compiling a vertex shader and 
-//  assembling them in some way.
-GLuint CreateShaderProgram(const std::string& vertexShaderSource,
-                           const std::string& fragmentShaderSource)
-{
-   // This is going to be our pipeline. glCreateProgram() returns an empty 
-   //  object which we'll fill in the vertex and fragment shaders.
-   // Create a new program object:
-   GLuint programObject = glCreateProgram();
-   // Compile our shaders:
-   // Create another function (commonly seen in libraries), which takes the 
-   //  type of shader we want to build (as an enum) and the vertex shader 
-   //  source code.
-   GLuint myVertexShader = CompileShader(GL_VERTEX_SHADER, vertexShaderSource);
-   GLuint myFragmentShader = CompileShader(GL_FRAGMENT_SHADER, fragmentShaderSource); // same here
-   
-   // Attach the shaders (Link our two shader programs together. 
-   //  Consider this the equivalent of taking two .cpp files, and linking them 
-   //  into one executable file).
-   glAttachShader(programObject, myVertexShader);
-   glAttachShader(programObject, myFragmentShader);
-   // Link them together in the program object
-   glLinkProgram(programObject);
-
-   // Validate the program
-   glValidateProgram(programObject);
-   
-   // Once our final program object has been created, we can detach and then 
-   //  delete our individual shaders.
-   glDetachShader(programObject, myVertexShader);
-   glDetachShader(programObject, myFragmentShader);
-   // Delete the individual shaders once we are done
-   glDeleteShader(myVertexShader);
-   glDeleteShader(myFragmentShader);
-
-   return programObject;
-}
-
-// Responsible for creating a pipeline with a vertex and a fragment shader 
-//  once we have the actual geometry.
-void CreateGraphicsPipeline()
-{
-   // Instead of loading the source code, we'll read in the files:
-   std::string VertexShaderSource = LoadShaderAsString("./shaders/vert.glsl");
-   std::string FragmentShaderSource = LoadShaderAsString("./shaders/frag.glsl");
-
-   // We need somewhere to hold the graphics pipeline
-   // Create the shader
-   // Since shaders themselves are just text information that we gonna compile 
-   //  (in the CompileShader method in glShaderSource(etc)), we're going to 
-   //  create two global strings.
-   gGraphicsPipelineShaderProgram = CreateShaderProgram(VertexShaderSource, 
-                                                        FragmentShaderSource);
+   gShaderHotReload.reset(new ShaderHotReload(gShaderCacheDirectory,
+                                              bindContext,
+                                              releaseContext));
+   gGraphicsPipelineReloadSlot = gShaderHotReload->Watch(gVertexShaderPath,
+                                                         gFragmentShaderPath);
+   gBatchReloadSlot = gShaderHotReload->Watch(gBatchVertexShaderPath,
+                                              gFragmentShaderPath);
+   gQueueReloadSlot = gShaderHotReload->Watch(gQueueVertexShaderPath,
+                                              gFragmentShaderPath);
+   if (!gShaderHotReload->Start())
+   {
+      gShaderHotReload.reset();
+   }
 }
 
 // Try to run some opengl functions to check if it's properly set.
@@ -427,9 +430,11 @@ void VertexSpecification()
    // As we have this currently binded buffer, we populate the data from our 
    //  'vertexPositions' (which is on the CPU), onto a buffer that will live on 
    //  the GPU!
+   // The floats are packed first (see gVertexFormat), the GPU never sees them.
+   const std::vector<GLubyte> packedVertexData = gVertexFormat.Pack(vertexData);
    glBufferData(GL_ARRAY_BUFFER, // target (kind of buffer we are working with; e.g. GL_ARRAY_BUFFER or GL_ELEMENT_ARRAY_BUFFER)
-                vertexData.size() * sizeof(GLfloat), // size - size of our data in BYTES!! How big is the buffer
-                vertexData.data(), // (raw array of data) pointer to the data - since we're using a vector here we can pass .data() which returns a pointer to the raw array. If it was a regular array just pass in the array
+                packedVertexData.size(), // size - size of our data in BYTES!! How big is the buffer
+                packedVertexData.data(), // (raw array of data) pointer to the data - since we're using a vector here we can pass .data() which returns a pointer to the raw array. If it was a regular array just pass in the array
                 GL_STATIC_DRAW // the last param is an enum that tells how we're gonna use the data - the triagles are gonna change a lot? are they gonna be streamed in? in our case only draw for now
                );
    // Now that we have the data, tell opengl 'how' the information in our 
@@ -463,32 +468,16 @@ void VertexSpecification()
                 GL_STATIC_DRAW
                );
 
-   // Enable an attribute
-   glEnableVertexAttribArray(0);
    /** 
-   * For the specific attribute in our vertex specification, we use
+   * For each attribute in our vertex specification, we enable it and use
    *  'glVertexAttribPointer' to figure out how we are going to move
-   *  through the data.
+   *  through the data: attribute 0 (layout=0 in the vertex shader) is x, y, z
+   *  and attribute 1 is r, g, b. Since they are packed, the pointers say
+   *  which type each is stored as, whether it is normalized (an integer read
+   *  as 0..1 or -1..1), the stride of a whole vertex (8 bytes) and where the
+   *  colors start in it (4 bytes in).
    */
-   // How to use it:
-   glVertexAttribPointer(0, // Attribute 0 corresponds to the enabled glEnableVertexAttribArray. In the future we'll see in our vertex shader this also correspond to (layout=0) which selects these attributes.
-                         3, // The number of components (e.g. x, y, z = 3 components/attributes)
-                         GL_FLOAT, // Type
-                         GL_FALSE, // Is the data normalized
-                         sizeof(GL_FLOAT)*6, // Stride (how to get to the next component) -> in this example, we have x,y,z and r,g,b as 1 vertex, so we gotta read the x,y,z and hop 3 floats to get to the next vertex's x,y,z information!
-                         (void*)0 // Offset (nothing changes since x,y,z info starts at the 0th position in the VBO)
-                         );
-
-   // Linking up the attributes in our VAO
-   // Color information
-   glEnableVertexAttribArray(1);
-   glVertexAttribPointer(1,
-                         3, // r, g, b
-                         GL_FLOAT,
-                         GL_FALSE,
-                         sizeof(GL_FLOAT)*6,
-                         (GLvoid*)(sizeof(GL_FLOAT)*3) // Since r,g,b is the "second" information in the vertex, it doesn't start at position 0, so we have to specify how many bytes we gotta jump from the position to the rgb data, in this case 3 floats. So we use: sizeof(GL_FLOAT)*3 instead of 0
-                         );
+   gVertexFormat.Apply();
 
 
    // Clean up - Close things when we're done
@@ -500,6 +489,19 @@ void VertexSpecification()
    glDisableVertexAttribArray(0);
    // Disable the second attribute
    glDisableVertexAttribArray(1);
+
+   // The batch renderer keeps its own copy of the geometry in its shared
+   //  buffers: the quad, and a triangle made of its first three vertices.
+   if (gInstanceCount > 0 && gUseRenderQueue)
+   {
+      gRenderQueue.reset(new RenderQueue());
+   }
+   else if (gInstanceCount > 0)
+   {
+      gBatchRenderer.reset(new BatchRenderer(gInstanceCount));
+      gQuadMesh = gBatchRenderer->AddMesh(vertexData, indexBufferData);
+      gTriangleMesh = gBatchRenderer->AddMesh(vertexData, { 0, 1, 2 });
+   }
 }
 
 void InitializeProgram()
@@ -529,6 +531,11 @@ void InitializeProgram()
    //  objects or overlapping.
    SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
 
+#if GL_DEBUG_CAPTURE
+   // Debug contexts report more through KHR_debug (see GLDebug.hpp)
+   SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_DEBUG_FLAG);
+#endif
+
    // Create a window
    gGraphicApplicationWindow = SDL_CreateWindow("OpenGL Window",
                                                 SDL_WINDOWPOS_UNDEFINED,
@@ -557,9 +564,10 @@ void InitializeProgram()
    }
 
    // Initialize the Glad library
-   if (!gladLoadGLLoader(SDL_GL_GetProcAddress)) // loads up a bunch of function 
-                                                 //  pointers and then retrieves
-                                                 //  their addresses.
+   if (!LoadOpenGLFunctions(SDL_GL_GetProcAddress)) // loads up a bunch of function 
+                                                    //  pointers and then retrieves
+                                                    //  their addresses (only those
+                                                    //  we use, see GLLoader.hpp).
    {
       std::cout << "Glad was not initialized" << std::endl;
       exit(1);
@@ -584,18 +592,19 @@ void Input()
       }
    }
 
-   // Retrieve keyboard state
+   // Retrieve keyboard state. The simulation thread moves the offset on its
+   //  next tick, at a speed that does not depend on the frame rate.
    const Uint8* state = SDL_GetKeyboardState(NULL);
+   int direction = 0;
    if (state[SDL_SCANCODE_UP])
    {
-      g_uOffset += 0.01f;
-      std::cout << "g_uOffset: " << g_uOffset << std::endl;
+      direction += 1;
    }
    if (state[SDL_SCANCODE_DOWN])
    {
-      g_uOffset -= 0.01f;
-      std::cout << "g_uOffset: " << g_uOffset << std::endl;
+      direction -= 1;
    }
+   gSimulation->SetInput(direction);
 }
 /**
 * Typically we will use this for setting some sort of 'state'
@@ -606,37 +615,165 @@ void Input()
 
 // Responsible for setting opengl state (that's how he suggests to be done, 
 //  but things can be put into the Draw function as well).
+// The state goes through the state cache (see GLStateCache.hpp), so what did
+//  not change since the last frame never reaches the driver.
 void PreDraw()
 {
+   GPU_SCOPE("PreDraw");
+
+   // Where the simulation is at, between its last two ticks
+   g_uOffset = gSimulation->Sample().Offset;
+
    // Disable depth test and face culling
-   glDisable(GL_DEPTH_TEST);
-   glDisable(GL_CULL_FACE);
+   GLState().Disable(GL_DEPTH_TEST);
+   GLState().Disable(GL_CULL_FACE);
 
    // Initialize clear color
    // Setup the viewport using the size of screen
-   glViewport(0, 0, gScreenWidth, gScreenHeight);
+   GLState().Viewport(0, 0, gScreenWidth, gScreenHeight);
    // Background color of our scene:
-   glClearColor(1.f, 1.f, 0.f, 1.f);
+   GLState().ClearColor(1.f, 1.f, 0.f, 1.f);
 
    // Clear Color buffer and Depth buffer
    glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
 
+   // Swap in the pipeline rebuilt by the hot-reload thread, if there is one.
+   //  This never waits for the compiler.
+   if (gShaderHotReload)
+   {
+      gShaderHotReload->Update(gGraphicsPipelineReloadSlot, gGraphicsPipelineShaderProgram);
+      const GLuint batchProgram = gBatchShaderProgram;
+      if (gShaderHotReload->Update(gBatchReloadSlot, gBatchShaderProgram) && gBatchRenderer)
+      {
+         // Its batches would never be drawn again
+         gBatchRenderer->RemoveProgram(batchProgram);
+      }
+      gShaderHotReload->Update(gQueueReloadSlot, gQueueShaderProgram);
+   }
+
    // Define the pipeline we're using to make it work
    // Use our shader
-   glUseProgram(gGraphicsPipelineShaderProgram);
+   GLState().UseProgram(gGraphicsPipelineShaderProgram);
+}
+
+/**
+* Transform of object Index of the grid of gInstanceCount objects that covers
+*  the screen in DrawBatched() and DrawQueued().
+*/
+glm::mat4 GridTransform(int Index)
+{
+   const int side = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(gInstanceCount))));
+   const float cell = 2.0f / side;
+
+   const glm::vec3 center(-1.0f + cell * (Index % side + 0.5f),
+                          -1.0f + cell * (Index / side + 0.5f) + g_uOffset,
+                          0.0f);
+   glm::mat4 transform = glm::translate(glm::mat4(1.0f), center);
+   return glm::scale(transform, glm::vec3(cell * 0.8f));
+}
+
+/**
+* Draws gInstanceCount quads and triangles, alternating, on a grid covering
+*  the screen. However many there are, the batch renderer draws them with one
+*  draw call (one per mesh without multi-draw indirect).
+* Objects moved out of the screen by g_uOffset are culled before submission.
+*/
+void DrawBatched()
+{
+   GPU_SCOPE("DrawBatched");
+
+   const glm::mat4 viewProjection(1.0f);
+
+   // The meshes span [-0.5, 0.5] on x and y, and GridTransform() only
+   //  translates and scales them
+   gGridMin.resize(gInstanceCount);
+   gGridMax.resize(gInstanceCount);
+   gGridVisible.resize(gInstanceCount);
+   for (int i = 0; i < gInstanceCount; ++i)
+   {
+      const glm::mat4 transform = GridTransform(i);
+      gGridMin.store(i, glm::vec3(transform * glm::vec4(-0.5f, -0.5f, 0.0f, 1.0f)));
+      gGridMax.store(i, glm::vec3(transform * glm::vec4(0.5f, 0.5f, 0.0f, 1.0f)));
+   }
+
+   glm::vec4 planes[6];
+   glm::frustumPlanes(viewProjection, planes);
+   const std::size_t visible = glm::frustumCullBoxes(planes, gGridMin, gGridMax, gGridVisible.data());
+
+   for (std::size_t k = 0; k < visible; ++k)
+   {
+      const int i = static_cast<int>(gGridVisible[k]);
+      gBatchRenderer->Submit(i % 2 == 0 ? gQuadMesh : gTriangleMesh,
+                             gBatchShaderProgram,
+                             GridTransform(i));
+   }
+
+   gBatchRenderer->Render(viewProjection);
+}
+
+/**
+* Same grid as DrawBatched(), but every object is a draw call of its own.
+*  Each worker thread of the render queue records a slice of the grid, then
+*  the queue sorts the draws (quads first, then triangles) and replays them.
+*/
+void DrawQueued()
+{
+   GPU_SCOPE("DrawQueued");
+
+   // The workers record without scopes of their own: the profiler is not
+   //  thread-safe
+   {
+      GPU_SCOPE("Record");
+      gRenderQueue->Record([](RenderQueue::Recorder& Recorder, int Thread)
+      {
+         const int threads = gRenderQueue->GetThreadCount();
+         const int first = static_cast<int>(static_cast<long long>(gInstanceCount) * Thread / threads);
+         const int last = static_cast<int>(static_cast<long long>(gInstanceCount) * (Thread + 1) / threads);
+
+         RenderQueue::DrawPacket packet;
+         packet.Program = gQueueShaderProgram;
+         packet.VertexArray = gVertexArrayObject;
+         packet.FirstIndex = 0;
+         packet.BaseVertex = 0;
+         for (int i = first; i < last; ++i)
+         {
+            // The first three indices of the quad make a triangle
+            const unsigned mesh = i % 2;
+            packet.Count = mesh == 0 ? 6 : 3;
+            packet.Model = GridTransform(i);
+            Recorder.Draw(RenderQueue::MakeSortKey(0, packet.Program, mesh, 0.0f), packet);
+         }
+      });
+   }
+
+   GPU_SCOPE("Execute");
+   gRenderQueue->Execute(glm::mat4(1.0f));
 }
 
 void Draw()
 {
+   GPU_SCOPE("Draw");
+
+   if (gBatchRenderer)
+   {
+      DrawBatched();
+      return;
+   }
+   if (gRenderQueue)
+   {
+      DrawQueued();
+      return;
+   }
+
    // Make the Draw call and then the pipeline will be activated.
    // So in order to draw, we gotta figure out which vertex array object 
    //  are we gonna be using. So we set it up by using the Bind function to 
    //  select the VAO.
    // Enable our attributes
-   glBindVertexArray(gVertexArrayObject);
+   GLState().BindVertexArray(gVertexArrayObject);
    // Now, which buffer we wanna draw from
    // Select the vertex buffer object we want to enable
-   glBindBuffer(GL_ARRAY_BUFFER, gVertexBufferObject);
+   GLState().BindBuffer(GL_ARRAY_BUFFER, gVertexBufferObject);
 
    /** 
    * As we're now using IBO, we need to draw differently!
@@ -648,9 +785,8 @@ void Draw()
                   0
                  );
 
-   // Stop using our current graphics pipeline
-   // Note: this is not necessary if we only have one graphics pipeline
-   glUseProgram(0);
+   // We don't stop using our graphics pipeline (glUseProgram(0)) here: the
+   //  next frame uses it again, and the state cache skips binding it then.
 }
 
 // It'll handle input, do some updates based on the inputs, and render 
@@ -663,6 +799,11 @@ void MainLoop()
    {
       // Handle input
       Input();
+
+      if (gProfiler)
+      {
+         gProfiler->BeginFrame();
+      }
       
       // Setup anything (i.e. OpenGL State) that needs to take place before draw
       //  calls.
@@ -671,27 +812,185 @@ void MainLoop()
       // Draw calls in OpenGL
       Draw();
 
+      if (gProfiler)
+      {
+         gProfiler->EndFrame();
+      }
+
       // Update the screen of our specified window
       SDL_GL_SwapWindow(gGraphicApplicationWindow);
    }
 }
 
+/**
+* Headless counterpart of MainLoop(): renders a fixed number of frames into the
+*  offscreen framebuffer and times each of them, after FrameTimer's warm-up
+*  frames. There is no Input() and no swap, so what we measure is PreDraw()
+*  and Draw() alone.
+* The results are written to stdout as JSON, e.g.
+*  { "frames": 1000, "cpu_ms": {"min": .., "median": .., "p99": ..}, ... }
+*/
+void HeadlessLoop()
+{
+   FrameTimer timer(gHeadlessFrameCount);
+
+   const int frameCount = gHeadlessFrameCount + FrameTimer::kWarmupFrames;
+   for (int frame = 0; frame < frameCount; ++frame)
+   {
+      GLState().ResetCounters();
+      timer.BeginFrame();
+      if (gProfiler)
+      {
+         gProfiler->BeginFrame();
+      }
+      PreDraw();
+      Draw();
+      if (gProfiler)
+      {
+         gProfiler->EndFrame();
+      }
+      timer.AddStateCalls(GLState().GetIssuedCount(), GLState().GetSkippedCount());
+      timer.EndFrame();
+   }
+
+   timer.Finish();
+   timer.WriteJson(std::cout);
+}
+
 // Removes all the setup that has been used such as SDL, deallocate any memory 
 //  used.
 void CleanUp()
 {
+   gSimulation.reset();
+
+   // Stop the hot-reload thread while our context is still there
+   gShaderHotReload.reset();
+   gBatchRenderer.reset();
+   gRenderQueue.reset();
+
+   if (gProfiler)
+   {
+      gProfiler->Finish();
+      if (gProfiler->WriteChromeTrace(gTracePath))
+      {
+         std::cerr << "Trace written to " << gTracePath << std::endl;
+      }
+      else
+      {
+         std::cerr << "Trace could not be written to " << gTracePath << std::endl;
+      }
+      gProfiler.reset();
+   }
+
+   StopGLDebugCapture();
+
+   if (gHeadless)
+   {
+      DestroyHeadlessContext();
+      return;
+   }
+
+   if (gHotReloadContext != nullptr)
+   {
+      SDL_GL_DeleteContext(gHotReloadContext);
+   }
+
    // Destroy the SDL window
    SDL_DestroyWindow(gGraphicApplicationWindow);
    SDL_Quit();
 }
 
 
+/**
+* Reads the command line. Supported options:
+*  --headless     render offscreen (no window) and print frame times as JSON
+*  --frames N     number of frames to render in headless mode
+*  --hot-reload   rebuild the shaders when they change in headless mode too
+*  --instances N  draw N objects through the batch renderer
+*  --queue        draw the --instances objects through the render queue
+*  --trace FILE   profile the frames and write a Chrome trace to FILE
+*/
+void ParseArguments(int argc, char* argv[])
+{
+   for (int i = 1; i < argc; ++i)
+   {
+      if (std::strcmp(argv[i], "--headless") == 0)
+      {
+         gHeadless = true;
+      }
+      else if (std::strcmp(argv[i], "--hot-reload") == 0)
+      {
+         gHotReload = true;
+      }
+      else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+      {
+         gHeadlessFrameCount = std::atoi(argv[++i]);
+         if (gHeadlessFrameCount <= 0)
+         {
+            std::cout << "--frames expects a positive number" << std::endl;
+            exit(1);
+         }
+      }
+      else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+      {
+         gTracePath = argv[++i];
+      }
+      else if (std::strcmp(argv[i], "--queue") == 0)
+      {
+         gUseRenderQueue = true;
+      }
+      else if (std::strcmp(argv[i], "--instances") == 0 && i + 1 < argc)
+      {
+         gInstanceCount = std::atoi(argv[++i]);
+         if (gInstanceCount <= 0)
+         {
+            std::cout << "--instances expects a positive number" << std::endl;
+            exit(1);
+         }
+      }
+      else
+      {
+         std::cout << "Unknown argument: " << argv[i] << std::endl;
+         exit(1);
+      }
+   }
+}
+
+/**
+* Same as InitializeProgram(), but without SDL: creates a surfaceless context
+*  and an offscreen framebuffer of the usual screen size to render into.
+*/
+void InitializeHeadlessProgram()
+{
+   if (!InitializeHeadlessContext() ||
+       !CreateOffscreenFramebuffer(gScreenWidth, gScreenHeight))
+   {
+      exit(1);
+   }
+}
+
 int main(int argc, char* argv[])
 {
+   ParseArguments(argc, argv);
+
    // Initial steps for having a graphical application:
 
    // 1. Setup the graphics program
-   InitializeProgram();
+   if (gHeadless)
+   {
+      InitializeHeadlessProgram();
+   }
+   else
+   {
+      InitializeProgram();
+   }
+   // Have the driver report OpenGL errors (debug builds, see GLDebug.hpp)
+   StartGLDebugCapture();
+   if (!gTracePath.empty())
+   {
+      gProfiler.reset(new GpuProfiler());
+      GpuProfiler::SetCurrent(gProfiler.get());
+   }
 
    // 2. Setup our geometry
    VertexSpecification();
@@ -699,9 +998,22 @@ int main(int argc, char* argv[])
    // 3. Create our graphics pipeline
    //  - At a minimum, this means the vertex and fragment shader
    CreateGraphicsPipeline();
+   if (gHotReload || !gHeadless)
+   {
+      StartShaderHotReload();
+   }
 
-   // 4. Call the main application loop
-   MainLoop();
+   // 4. Start the simulation, then call the main application loop
+   gSimulation.reset(new Simulation(gSimulationTickSeconds));
+   gSimulation->Start();
+   if (gHeadless)
+   {
+      HeadlessLoop();
+   }
+   else
+   {
+      MainLoop();
+   }
 
    // 5. Call the cleanup function when our program terminates
    CleanUp();
@@ -0,0 +1,200 @@
+#include "MappedFile.hpp"
+
+// C++ Standard Libraries
+#include <cstdio>
+#include <utility>
+
+// Platform
+#if defined(_WIN32)
+#  define WIN32_LEAN_AND_MEAN
+#  define NOMINMAX
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+MappedFile::~MappedFile()
+{
+   Close();
+}
+
+MappedFile::MappedFile(MappedFile&& Other) noexcept
+{
+   *this = std::move(Other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& Other) noexcept
+{
+   if (this != &Other)
+   {
+      Close();
+
+      // Moving a vector keeps its storage, so mData stays valid in both cases
+      mBuffer = std::move(Other.mBuffer);
+      mData = Other.mData;
+      mSize = Other.mSize;
+      mOpen = Other.mOpen;
+      mMapped = Other.mMapped;
+#if defined(_WIN32)
+      mMapping = Other.mMapping;
+      Other.mMapping = nullptr;
+#endif
+
+      Other.mData = nullptr;
+      Other.mSize = 0;
+      Other.mOpen = false;
+      Other.mMapped = false;
+   }
+   return *this;
+}
+
+bool MappedFile::Open(const std::string& Filename)
+{
+   Close();
+
+   mOpen = TryMap(Filename) || TryRead(Filename);
+   return mOpen;
+}
+
+void MappedFile::Close()
+{
+   if (mMapped)
+   {
+#if defined(_WIN32)
+      UnmapViewOfFile(mData);
+      CloseHandle(mMapping);
+      mMapping = nullptr;
+#else
+      munmap(const_cast<char*>(mData), mSize);
+#endif
+   }
+
+   mBuffer.clear();
+   mBuffer.shrink_to_fit();
+   mData = nullptr;
+   mSize = 0;
+   mOpen = false;
+   mMapped = false;
+}
+
+#if defined(_WIN32)
+
+bool MappedFile::TryMap(const std::string& Filename)
+{
+   HANDLE file = CreateFileA(Filename.c_str(),
+                             GENERIC_READ,
+                             FILE_SHARE_READ,
+                             nullptr,
+                             OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                             nullptr);
+   if (file == INVALID_HANDLE_VALUE)
+   {
+      return false;
+   }
+
+   LARGE_INTEGER size;
+   // Empty files cannot be mapped, TryRead() handles them
+   if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+   {
+      CloseHandle(file);
+      return false;
+   }
+
+   // The mapping keeps the file open on its own
+   HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+   CloseHandle(file);
+   if (mapping == nullptr)
+   {
+      return false;
+   }
+
+   const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+   if (view == nullptr)
+   {
+      CloseHandle(mapping);
+      return false;
+   }
+
+   mMapping = mapping;
+   mData = static_cast<const char*>(view);
+   mSize = static_cast<std::size_t>(size.QuadPart);
+   mMapped = true;
+   return true;
+}
+
+#else
+
+bool MappedFile::TryMap(const std::string& Filename)
+{
+   int file = open(Filename.c_str(), O_RDONLY);
+   if (file < 0)
+   {
+      return false;
+   }
+
+   struct stat status;
+   // Empty files cannot be mapped, TryRead() handles them. Neither can
+   //  pipes and other special files.
+   if (fstat(file, &status) != 0 || !S_ISREG(status.st_mode) || status.st_size == 0)
+   {
+      close(file);
+      return false;
+   }
+
+   const std::size_t size = static_cast<std::size_t>(status.st_size);
+   void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+   // The mapping keeps the file open on its own
+   close(file);
+   if (view == MAP_FAILED)
+   {
+      return false;
+   }
+
+   // We read it once from start to end
+   madvise(view, size, MADV_SEQUENTIAL);
+
+   mData = static_cast<const char*>(view);
+   mSize = size;
+   mMapped = true;
+   return true;
+}
+
+#endif
+
+bool MappedFile::TryRead(const std::string& Filename)
+{
+   std::FILE* file = std::fopen(Filename.c_str(), "rb");
+   if (file == nullptr)
+   {
+      return false;
+   }
+
+   // One sized read when the size is known
+   std::size_t size = 0;
+   if (std::fseek(file, 0, SEEK_END) == 0)
+   {
+      const long end = std::ftell(file);
+      size = end > 0 ? static_cast<std::size_t>(end) : 0;
+      std::fseek(file, 0, SEEK_SET);
+   }
+   mBuffer.resize(size);
+   mBuffer.resize(size > 0 ? std::fread(mBuffer.data(), 1, size, file) : 0);
+
+   // Whatever is left when the size is unknown (e.g. pipes)
+   char chunk[4096];
+   std::size_t count = 0;
+   while ((count = std::fread(chunk, 1, sizeof(chunk), file)) > 0)
+   {
+      mBuffer.insert(mBuffer.end(), chunk, chunk + count);
+   }
+   std::fclose(file);
+
+   // Never null, even for an empty file
+   mData = mBuffer.empty() ? "" : mBuffer.data();
+   mSize = mBuffer.size();
+   return true;
+}
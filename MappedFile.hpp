@@ -0,0 +1,71 @@
+#pragma once
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+* MappedFile gives read-only access to a whole file without copying it.
+* The file is memory-mapped (mmap on Linux and macOS, a file mapping on
+*  Windows), so opening it costs no read and no allocation: the pages are
+*  brought in by the OS when they are first touched. If the file cannot be
+*  mapped (e.g. it is empty, or on some special file systems), it is read
+*  instead, with a single sized read into a buffer that MappedFile owns.
+*
+* Use it for anything that is only read: shader sources, meshes, textures,
+*  cached program binaries...
+* E.g.
+*  MappedFile file;
+*  if (file.Open("./shaders/vert.glsl"))
+*  {
+*     const char* source = file.Data();
+*     GLint length = static_cast<GLint>(file.Size());
+*     glShaderSource(shader, 1, &source, &length);
+*  }
+*
+* The data stays valid until the MappedFile is closed, destroyed or moved
+*  from. It is not null terminated, and is only null if no file is open.
+*/
+class MappedFile
+{
+public:
+   MappedFile() = default;
+   ~MappedFile();
+
+   MappedFile(MappedFile&& Other) noexcept;
+   MappedFile& operator=(MappedFile&& Other) noexcept;
+
+   MappedFile(const MappedFile&) = delete;
+   MappedFile& operator=(const MappedFile&) = delete;
+
+   /**
+   * Maps (or reads) the whole file. Closes any file opened before.
+   * @param Filename Path to the file
+   * @return true if the file was opened, even if it is empty.
+   */
+   bool Open(const std::string& Filename);
+
+   /**
+   * Unmaps the file and releases the buffer, if any.
+   */
+   void Close();
+
+   bool IsOpen() const { return mOpen; }
+   const char* Data() const { return mData; }
+   std::size_t Size() const { return mSize; }
+
+private:
+   bool TryMap(const std::string& Filename);
+   bool TryRead(const std::string& Filename);
+
+   const char* mData = nullptr;
+   std::size_t mSize = 0;
+   bool mOpen = false;
+   // True when mData points to a mapping, false when it points into mBuffer
+   bool mMapped = false;
+   std::vector<char> mBuffer;
+#if defined(_WIN32)
+   void* mMapping = nullptr;
+#endif
+};
@@ -0,0 +1,191 @@
+#include "RenderQueue.hpp"
+
+// Third Party Libraries
+#include <glm/gtc/type_ptr.hpp>
+
+// Our own modules
+#include "GLStateCache.hpp"
+
+// C++ Standard Libraries
+#include <algorithm>
+
+// Bits per radix sort pass, and the number of passes over a 64 bit key
+static const int kRadixBits = 8;
+static const int kRadixPasses = 64 / kRadixBits;
+static const std::size_t kRadixSize = std::size_t(1) << kRadixBits;
+
+std::uint64_t RenderQueue::MakeSortKey(unsigned Layer, GLuint Program, unsigned Material, float Depth)
+{
+   const float depth = std::min(std::max(Depth, 0.0f), 1.0f);
+   const std::uint64_t quantizedDepth = static_cast<std::uint64_t>(depth * 0xFFFFFF);
+   return (static_cast<std::uint64_t>(Layer & 0xFF) << 56) |
+          (static_cast<std::uint64_t>(Program & 0xFFFF) << 40) |
+          (static_cast<std::uint64_t>(Material & 0xFFFF) << 24) |
+          quantizedDepth;
+}
+
+RenderQueue::RenderQueue(int ThreadCount)
+{
+   if (ThreadCount <= 0)
+   {
+      ThreadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+   }
+
+   for (int thread = 0; thread < ThreadCount; ++thread)
+   {
+      mRecorders.emplace_back(new Recorder());
+   }
+   for (int thread = 0; thread < ThreadCount; ++thread)
+   {
+      mThreads.emplace_back(&RenderQueue::Worker, this, thread);
+   }
+}
+
+RenderQueue::~RenderQueue()
+{
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mStop = true;
+   }
+   mWake.notify_all();
+
+   for (std::thread& thread : mThreads)
+   {
+      thread.join();
+   }
+}
+
+void RenderQueue::Worker(int Thread)
+{
+   std::uint64_t generation = 0;
+   for (;;)
+   {
+      const std::function<void(Recorder&, int)>* job = nullptr;
+      {
+         std::unique_lock<std::mutex> lock(mMutex);
+         mWake.wait(lock, [&]() { return mStop || mGeneration != generation; });
+         if (mStop)
+         {
+            return;
+         }
+         generation = mGeneration;
+         job = mJob;
+      }
+
+      (*job)(*mRecorders[Thread], Thread);
+
+      std::lock_guard<std::mutex> lock(mMutex);
+      if (--mPending == 0)
+      {
+         mDone.notify_one();
+      }
+   }
+}
+
+void RenderQueue::Record(const std::function<void(Recorder&, int)>& Job)
+{
+   std::unique_lock<std::mutex> lock(mMutex);
+   mJob = &Job;
+   mPending = GetThreadCount();
+   ++mGeneration;
+   mWake.notify_all();
+
+   mDone.wait(lock, [this]() { return mPending == 0; });
+   mJob = nullptr;
+}
+
+/**
+* Least significant digit radix sort of mEntries by key: one counting pass per
+*  byte, from the lowest to the highest, each one stable. The histograms of
+*  all the bytes are built in a single read of the keys, and a byte that has
+*  the same value in every key (e.g. the layer, when there is only one) is
+*  skipped, since its pass would not move anything.
+*/
+void RenderQueue::Sort()
+{
+   const std::size_t count = mEntries.size();
+   std::size_t histograms[kRadixPasses][kRadixSize] = {};
+   for (const Entry& entry : mEntries)
+   {
+      for (int pass = 0; pass < kRadixPasses; ++pass)
+      {
+         ++histograms[pass][(entry.Key >> (pass * kRadixBits)) & (kRadixSize - 1)];
+      }
+   }
+
+   mScratch.resize(count);
+   for (int pass = 0; pass < kRadixPasses; ++pass)
+   {
+      std::size_t* histogram = histograms[pass];
+      const int shift = pass * kRadixBits;
+      if (histogram[(mEntries[0].Key >> shift) & (kRadixSize - 1)] == count)
+      {
+         continue;
+      }
+
+      // Turn the counts into the position of the first entry of each digit
+      std::size_t offset = 0;
+      for (std::size_t digit = 0; digit < kRadixSize; ++digit)
+      {
+         const std::size_t digitCount = histogram[digit];
+         histogram[digit] = offset;
+         offset += digitCount;
+      }
+
+      for (const Entry& entry : mEntries)
+      {
+         mScratch[histogram[(entry.Key >> shift) & (kRadixSize - 1)]++] = entry;
+      }
+      mEntries.swap(mScratch);
+   }
+}
+
+void RenderQueue::Execute(const glm::mat4& ViewProjection)
+{
+   mEntries.clear();
+   for (std::uint32_t recorder = 0; recorder < mRecorders.size(); ++recorder)
+   {
+      const std::vector<std::uint64_t>& keys = mRecorders[recorder]->mKeys;
+      for (std::uint32_t packet = 0; packet < keys.size(); ++packet)
+      {
+         mEntries.push_back(Entry{ keys[packet], recorder, packet });
+      }
+   }
+   if (mEntries.empty())
+   {
+      return;
+   }
+
+   Sort();
+
+   bool first = true;
+   GLuint program = 0;
+   GLint modelLocation = -1;
+   for (const Entry& entry : mEntries)
+   {
+      const DrawPacket& packet = mRecorders[entry.Recorder]->mPackets[entry.Packet];
+
+      // Sorted by program first, so this happens once per program
+      if (first || packet.Program != program)
+      {
+         first = false;
+         program = packet.Program;
+         GLState().UseProgram(program);
+         glUniformMatrix4fv(glGetUniformLocation(program, "u_ViewProjection"), 1, GL_FALSE,
+                            glm::value_ptr(ViewProjection));
+         modelLocation = glGetUniformLocation(program, "u_Model");
+      }
+
+      GLState().BindVertexArray(packet.VertexArray);
+      glUniformMatrix4fv(modelLocation, 1, GL_FALSE, glm::value_ptr(packet.Model));
+      glDrawElementsBaseVertex(GL_TRIANGLES, packet.Count, GL_UNSIGNED_INT,
+                               (GLvoid*)(packet.FirstIndex * sizeof(GLuint)),
+                               packet.BaseVertex);
+   }
+
+   for (std::unique_ptr<Recorder>& recorder : mRecorders)
+   {
+      recorder->mKeys.clear();
+      recorder->mPackets.clear();
+   }
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+// Third Party Libraries
+#include <glad/glad.h>
+#include <glm/mat4x4.hpp>
+
+// C++ Standard Libraries
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+* RenderQueue lets several threads decide what to draw, while only the thread
+*  that owns the OpenGL context talks to OpenGL.
+*
+* Worker threads record draw packets, each with a 64 bit sort key, into
+*  their own Recorder: a plain array that keeps its memory from one frame to
+*  the next, and that no other thread touches, so recording needs no locks.
+*  The render thread then merges the keys of all the recorders, sorts them
+*  with a radix sort and replays the packets in key order. The key puts the
+*  most expensive state changes in its high bits, so sorting also groups the
+*  draws that share a program, then a material.
+*
+* Key layout, from the high bits to the low ones (see MakeSortKey()):
+*  layer (8 bits) | program (16) | material (16) | depth (24)
+*
+* The vertex shader of the packets reads "u_ViewProjection" and "u_Model"
+*  (see shaders/model_vert.glsl).
+*
+* E.g.
+*  RenderQueue queue(4);
+*  // Every frame, on the render thread
+*  queue.Record([&](RenderQueue::Recorder& recorder, int thread)
+*  {
+*     // Runs on each worker thread: record this thread's share of the scene
+*     recorder.Draw(RenderQueue::MakeSortKey(0, program, mesh, depth), packet);
+*  });
+*  queue.Execute(viewProjection);
+*/
+class RenderQueue
+{
+public:
+   // One indexed draw call: glDrawElementsBaseVertex with GL_UNSIGNED_INT indices
+   struct DrawPacket
+   {
+      GLuint Program;
+      GLuint VertexArray;
+      GLsizei Count;
+      GLuint FirstIndex;
+      GLint BaseVertex;
+      glm::mat4 Model;
+   };
+
+   // Packets recorded by one thread
+   class Recorder
+   {
+   public:
+      void Draw(std::uint64_t Key, const DrawPacket& Packet)
+      {
+         mKeys.push_back(Key);
+         mPackets.push_back(Packet);
+      }
+
+   private:
+      friend class RenderQueue;
+      std::vector<std::uint64_t> mKeys;
+      std::vector<DrawPacket> mPackets;
+   };
+
+   /**
+   * @param Layer Drawn in increasing order, e.g. opaque, then transparent, then UI
+   * @param Program Shader program; only the low 16 bits are used
+   * @param Material Anything that groups draws within a program (mesh, textures...)
+   * @param Depth Between 0 and 1, drawn in increasing order (front to back).
+   *  Pass 1 - depth for back to front.
+   */
+   static std::uint64_t MakeSortKey(unsigned Layer, GLuint Program, unsigned Material, float Depth);
+
+   /**
+   * Starts the worker threads.
+   * @param ThreadCount Number of worker threads, 0 for one per core
+   */
+   explicit RenderQueue(int ThreadCount = 0);
+   ~RenderQueue();
+
+   RenderQueue(const RenderQueue&) = delete;
+   RenderQueue& operator=(const RenderQueue&) = delete;
+
+   int GetThreadCount() const { return static_cast<int>(mThreads.size()); }
+
+   /**
+   * Runs Job once on every worker thread, with that thread's recorder and
+   *  index (0 to GetThreadCount() - 1), and waits until they are all done.
+   *  Can be called several times before Execute().
+   */
+   void Record(const std::function<void(Recorder&, int)>& Job);
+
+   /**
+   * Sorts everything recorded since the last call and draws it, on the
+   *  calling thread, which must have the OpenGL context. Then clears the
+   *  recorders.
+   * @param ViewProjection Value of the "u_ViewProjection" uniform
+   */
+   void Execute(const glm::mat4& ViewProjection);
+
+   /**
+   * @return Number of packets drawn by the last Execute()
+   */
+   std::size_t GetPacketCount() const { return mEntries.size(); }
+
+private:
+   // Reference to a recorded packet, 16 bytes so that sorting moves little
+   struct Entry
+   {
+      std::uint64_t Key;
+      std::uint32_t Recorder;
+      std::uint32_t Packet;
+   };
+
+   void Worker(int Thread);
+   void Sort();
+
+   std::vector<std::unique_ptr<Recorder>> mRecorders;
+   std::vector<std::thread> mThreads;
+
+   // The job being run, the number of workers still running it, and a
+   //  counter the workers watch to know there is a new one
+   std::mutex mMutex;
+   std::condition_variable mWake;
+   std::condition_variable mDone;
+   const std::function<void(Recorder&, int)>* mJob = nullptr;
+   int mPending = 0;
+   std::uint64_t mGeneration = 0;
+   bool mStop = false;
+
+   // Merged keys, and the second buffer the radix sort needs
+   std::vector<Entry> mEntries;
+   std::vector<Entry> mScratch;
+};
@@ -0,0 +1,359 @@
+#include "ShaderCache.hpp"
+
+// C++ Standard Libraries
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <utility>
+
+// Platform
+#if defined(_WIN32)
+#  include <direct.h>
+#else
+#  include <sys/stat.h>
+#endif
+
+// Every cache file starts with this header, followed by the binary itself
+struct CacheFileHeader
+{
+   std::uint32_t Magic;
+   std::uint32_t Format;   // binaryFormat returned by glGetProgramBinary
+   std::uint64_t Hash;     // Same as the file name, guards against renamed files
+   std::uint32_t Length;   // Size of the binary in bytes
+   std::uint32_t Padding;
+};
+
+static const std::uint32_t kCacheFileMagic = 0x42505347; // "GSPB"
+
+std::string LoadShaderAsString(const std::string& Filename)
+{
+   MappedFile file;
+   if (!file.Open(Filename))
+   {
+      return "";
+   }
+   return std::string(file.Data(), file.Size());
+}
+
+/**
+* 64 bit FNV-1a hash, continuing from Hash.
+*/
+static std::uint64_t HashBytes(std::uint64_t Hash, const char* Data, std::size_t Size)
+{
+   for (std::size_t i = 0; i < Size; ++i)
+   {
+      Hash ^= static_cast<unsigned char>(Data[i]);
+      Hash *= 0x100000001b3ull;
+   }
+   // Separator, so that ("ab", "c") and ("a", "bc") differ
+   Hash ^= 0xff;
+   Hash *= 0x100000001b3ull;
+   return Hash;
+}
+
+static std::uint64_t HashString(std::uint64_t Hash, GLenum Name)
+{
+   const GLubyte* Text = glGetString(Name);
+   const char* String = Text != nullptr ? reinterpret_cast<const char*>(Text) : "";
+   return HashBytes(Hash, String, std::strlen(String));
+}
+
+static void PrintShaderLog(GLuint Shader, const char* Type, const std::string& Path)
+{
+   int result = 0;
+   glGetShaderiv(Shader, GL_COMPILE_STATUS, &result);
+   if (result != GL_FALSE)
+   {
+      return;
+   }
+
+   int length = 0;
+   glGetShaderiv(Shader, GL_INFO_LOG_LENGTH, &length);
+   std::vector<char> errorMessages(length > 0 ? length : 1, '\0');
+   glGetShaderInfoLog(Shader, length, nullptr, errorMessages.data());
+   std::cerr << "ERROR: " << Type << " compilation failed! (" << Path << ")\n"
+             << errorMessages.data()
+             << "\n";
+}
+
+ShaderCache::ShaderCache(const std::string& Directory)
+   : mDirectory(Directory)
+{
+#if defined(_WIN32)
+   _mkdir(mDirectory.c_str());
+#else
+   mkdir(mDirectory.c_str(), 0755);
+#endif
+}
+
+ShaderCache::~ShaderCache()
+{
+   // Programs that were never finished are still ours
+   for (Entry& program : mPrograms)
+   {
+      if (!program.Done)
+      {
+         glDeleteShader(program.VertexShader);
+         glDeleteShader(program.FragmentShader);
+         glDeleteProgram(program.Program);
+      }
+   }
+}
+
+std::size_t ShaderCache::Add(const std::string& VertexPath, const std::string& FragmentPath)
+{
+   Entry program;
+   program.VertexPath = VertexPath;
+   program.FragmentPath = FragmentPath;
+   mPrograms.push_back(std::move(program));
+   return mPrograms.size() - 1;
+}
+
+void ShaderCache::Start()
+{
+   mStart = std::chrono::steady_clock::now();
+
+   // 0xFFFFFFFF lets the driver pick the number of compiler threads
+   if (GLAD_GL_KHR_parallel_shader_compile)
+   {
+      glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+      mParallel = true;
+   }
+   else if (GLAD_GL_ARB_parallel_shader_compile)
+   {
+      glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+      mParallel = true;
+   }
+
+   GLint formats = 0;
+   glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+   mBinaries = formats > 0;
+
+   // A binary only works with the driver that produced it
+   std::uint64_t driverHash = 0xcbf29ce484222325ull;
+   driverHash = HashString(driverHash, GL_VENDOR);
+   driverHash = HashString(driverHash, GL_RENDERER);
+   driverHash = HashString(driverHash, GL_VERSION);
+
+   for (Entry& program : mPrograms)
+   {
+      // A missing file stays empty and fails to compile, which reports it
+      program.VertexSource.Open(program.VertexPath);
+      program.FragmentSource.Open(program.FragmentPath);
+      program.Hash = HashBytes(driverHash,
+                               program.VertexSource.Data(),
+                               program.VertexSource.Size());
+      program.Hash = HashBytes(program.Hash,
+                               program.FragmentSource.Data(),
+                               program.FragmentSource.Size());
+
+      if (!LoadBinary(program))
+      {
+         StartCompile(program);
+      }
+   }
+}
+
+bool ShaderCache::IsReady()
+{
+   bool ready = true;
+   for (Entry& program : mPrograms)
+   {
+      if (program.Done)
+      {
+         continue;
+      }
+
+      // Without the extension any status query would block, so report the
+      //  programs as not ready and let Finish() wait for them.
+      GLint completed = GL_FALSE;
+      if (mParallel)
+      {
+         glGetProgramiv(program.Program, GL_COMPLETION_STATUS_KHR, &completed);
+      }
+      if (completed == GL_FALSE)
+      {
+         ready = false;
+         continue;
+      }
+
+      FinishProgram(program);
+   }
+   return ready;
+}
+
+bool ShaderCache::Finish()
+{
+   int cached = 0;
+   for (Entry& program : mPrograms)
+   {
+      if (!program.Done)
+      {
+         FinishProgram(program);
+      }
+      cached += program.FromCache ? 1 : 0;
+   }
+
+   std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - mStart;
+   std::cerr << "Shader programs: " << mPrograms.size()
+             << " (" << cached << " from cache, "
+             << mPrograms.size() - cached << " compiled) in "
+             << elapsed.count() << " ms"
+             << (mParallel ? " with parallel compilation" : "")
+             << std::endl;
+
+   return mFailures == 0;
+}
+
+GLuint ShaderCache::GetProgram(std::size_t Index) const
+{
+   return mPrograms[Index].Program;
+}
+
+std::string ShaderCache::CachePath(const Entry& Program) const
+{
+   char name[32];
+   std::snprintf(name, sizeof(name), "%016llx.bin",
+                 static_cast<unsigned long long>(Program.Hash));
+   return mDirectory + "/" + name;
+}
+
+bool ShaderCache::LoadBinary(Entry& Program)
+{
+   if (!mBinaries)
+   {
+      return false;
+   }
+
+   MappedFile file;
+   if (!file.Open(CachePath(Program)) || file.Size() < sizeof(CacheFileHeader))
+   {
+      return false;
+   }
+
+   CacheFileHeader header;
+   std::memcpy(&header, file.Data(), sizeof(header));
+   if (header.Magic != kCacheFileMagic ||
+       header.Hash != Program.Hash ||
+       header.Length != file.Size() - sizeof(header))
+   {
+      return false;
+   }
+
+   // The link status is checked in FinishProgram(), like for compiled programs
+   Program.Program = glCreateProgram();
+   glProgramBinary(Program.Program, header.Format, file.Data() + sizeof(header), header.Length);
+   Program.FromCache = true;
+   return true;
+}
+
+void ShaderCache::SaveBinary(const Entry& Program) const
+{
+   if (!mBinaries)
+   {
+      return;
+   }
+
+   GLint length = 0;
+   glGetProgramiv(Program.Program, GL_PROGRAM_BINARY_LENGTH, &length);
+   if (length <= 0)
+   {
+      return;
+   }
+
+   std::vector<char> binary(length);
+   GLenum format = 0;
+   glGetProgramBinary(Program.Program, length, nullptr, &format, binary.data());
+
+   CacheFileHeader header = {};
+   header.Magic = kCacheFileMagic;
+   header.Format = format;
+   header.Hash = Program.Hash;
+   header.Length = static_cast<std::uint32_t>(length);
+
+   std::ofstream file(CachePath(Program), std::ios::binary | std::ios::trunc);
+   file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+   file.write(binary.data(), binary.size());
+}
+
+void ShaderCache::StartCompile(Entry& Program)
+{
+   // The files are not null terminated, so pass their lengths along
+   const char* vertexSource = Program.VertexSource.Data();
+   const GLint vertexLength = static_cast<GLint>(Program.VertexSource.Size());
+   Program.VertexShader = glCreateShader(GL_VERTEX_SHADER);
+   glShaderSource(Program.VertexShader, 1, &vertexSource, &vertexLength);
+   glCompileShader(Program.VertexShader);
+
+   const char* fragmentSource = Program.FragmentSource.Data();
+   const GLint fragmentLength = static_cast<GLint>(Program.FragmentSource.Size());
+   Program.FragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+   glShaderSource(Program.FragmentShader, 1, &fragmentSource, &fragmentLength);
+   glCompileShader(Program.FragmentShader);
+
+   // No status check here: it would wait for the compiler. Linking right away
+   //  is fine, a failed compilation makes the link fail too.
+   Program.Program = glCreateProgram();
+   glAttachShader(Program.Program, Program.VertexShader);
+   glAttachShader(Program.Program, Program.FragmentShader);
+   glProgramParameteri(Program.Program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+   glLinkProgram(Program.Program);
+}
+
+void ShaderCache::FinishProgram(Entry& Program)
+{
+   GLint linked = GL_FALSE;
+   glGetProgramiv(Program.Program, GL_LINK_STATUS, &linked);
+
+   if (!linked && Program.FromCache)
+   {
+      // The driver no longer accepts this binary, compile it again
+      glDeleteProgram(Program.Program);
+      Program.FromCache = false;
+      StartCompile(Program);
+      glGetProgramiv(Program.Program, GL_LINK_STATUS, &linked);
+   }
+
+   if (!linked)
+   {
+      PrintShaderLog(Program.VertexShader, "GL_VERTEX_SHADER", Program.VertexPath);
+      PrintShaderLog(Program.FragmentShader, "GL_FRAGMENT_SHADER", Program.FragmentPath);
+
+      int length = 0;
+      glGetProgramiv(Program.Program, GL_INFO_LOG_LENGTH, &length);
+      std::vector<char> errorMessages(length > 0 ? length : 1, '\0');
+      glGetProgramInfoLog(Program.Program, length, nullptr, errorMessages.data());
+      std::cerr << "ERROR: program link failed! (" << Program.VertexPath
+                << ", " << Program.FragmentPath << ")\n"
+                << errorMessages.data()
+                << "\n";
+
+      glDeleteProgram(Program.Program);
+      Program.Program = 0;
+      ++mFailures;
+   }
+   else if (!Program.FromCache)
+   {
+      SaveBinary(Program);
+   }
+
+   // Once linked, the individual shaders are no longer needed
+   if (Program.VertexShader != 0)
+   {
+      if (Program.Program != 0)
+      {
+         glDetachShader(Program.Program, Program.VertexShader);
+         glDetachShader(Program.Program, Program.FragmentShader);
+      }
+      glDeleteShader(Program.VertexShader);
+      glDeleteShader(Program.FragmentShader);
+      Program.VertexShader = 0;
+      Program.FragmentShader = 0;
+   }
+
+   Program.VertexSource.Close();
+   Program.FragmentSource.Close();
+   Program.Done = true;
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+// Third Party Libraries
+#include <glad/glad.h>
+
+// Our own modules
+#include "MappedFile.hpp"
+
+// C++ Standard Libraries
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+* LoadShaderAsString takes a filepath as an argument and returns the whole
+*  file as a string that is meant to be compiled at runtime for a vertex,
+*  fragment, geometry, tesselation, or computer shader.
+* E.g.
+*  LoadShaderAsString("./shaders/filepath");
+* ShaderCache does not use it: it hands the mapped file (see MappedFile.hpp)
+*  straight to glShaderSource, which saves the copy into a string.
+* @param Filename Path to the shader file
+* @return Entire file stored as a single string (empty if it does not exist)
+*/
+std::string LoadShaderAsString(const std::string& Filename);
+
+/**
+* ShaderCache builds many shader programs at once and keeps their binaries on
+*  disk between launches.
+*
+* Compiling and linking synchronously (compile, check status, link, check
+*  status) makes every program wait for the previous one. Instead, Start()
+*  issues the glCompileShader/glLinkProgram calls of every program first and
+*  only asks for their status afterwards. With GL_KHR_parallel_shader_compile
+*  (or its ARB twin) the driver compiles them on its own threads meanwhile,
+*  and IsReady() can tell when they are done without blocking.
+*
+* Once linked, a program's glGetProgramBinary() blob is written to the cache
+*  directory, in a file named after a hash of the shader sources and of the
+*  driver (vendor, renderer, version). On the next launch glProgramBinary()
+*  loads it back and the compilation is skipped entirely. If the driver
+*  rejects the blob (e.g. after a driver update), the program is compiled
+*  from source again.
+*
+* E.g.
+*  ShaderCache cache("./shader-cache");
+*  std::size_t pipeline = cache.Add("./shaders/vert.glsl", "./shaders/frag.glsl");
+*  cache.Start();
+*  cache.Finish();
+*  GLuint program = cache.GetProgram(pipeline);
+*/
+class ShaderCache
+{
+public:
+   /**
+   * @param Directory Where the program binaries are stored. It is created if
+   *  it does not exist yet.
+   */
+   explicit ShaderCache(const std::string& Directory);
+   ~ShaderCache();
+
+   ShaderCache(const ShaderCache&) = delete;
+   ShaderCache& operator=(const ShaderCache&) = delete;
+
+   /**
+   * Registers a program made of a vertex and a fragment shader. Must be called
+   *  before Start().
+   * @return Index to pass to GetProgram()
+   */
+   std::size_t Add(const std::string& VertexPath, const std::string& FragmentPath);
+
+   /**
+   * Loads the cached binaries and kicks off the compilation of the other
+   *  programs. Needs a current OpenGL context.
+   */
+   void Start();
+
+   /**
+   * Finishes the programs whose compilation is done, without blocking.
+   * @return true once every program is finished.
+   */
+   bool IsReady();
+
+   /**
+   * Waits for every program, stores the new binaries and prints a summary.
+   * @return true if every program was built successfully.
+   */
+   bool Finish();
+
+   /**
+   * The caller owns the program once Finish() returned (or IsReady() returned
+   *  true), and has to delete it.
+   * @return The program object, or 0 if it failed to build.
+   */
+   GLuint GetProgram(std::size_t Index) const;
+
+private:
+   struct Entry
+   {
+      std::string VertexPath;
+      std::string FragmentPath;
+      // Mapped while the program is being built
+      MappedFile VertexSource;
+      MappedFile FragmentSource;
+      std::uint64_t Hash = 0;
+      GLuint Program = 0;
+      GLuint VertexShader = 0;
+      GLuint FragmentShader = 0;
+      bool FromCache = false;
+      bool Done = false;
+   };
+
+   std::string CachePath(const Entry& Program) const;
+   bool LoadBinary(Entry& Program);
+   void SaveBinary(const Entry& Program) const;
+   void StartCompile(Entry& Program);
+   void FinishProgram(Entry& Program);
+
+   std::string mDirectory;
+   std::vector<Entry> mPrograms;
+   // Whether the driver compiles on its own threads (GL_COMPLETION_STATUS_KHR)
+   bool mParallel = false;
+   // Whether the driver has at least one program binary format
+   bool mBinaries = false;
+   int mFailures = 0;
+   std::chrono::steady_clock::time_point mStart;
+};
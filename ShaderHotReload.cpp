@@ -0,0 +1,256 @@
+#include "ShaderHotReload.hpp"
+
+// Our own modules
+#include "ShaderCache.hpp"
+
+// C++ Standard Libraries
+#include <iostream>
+#include <utility>
+
+// Platform
+#if defined(__linux__)
+#  include <poll.h>
+#  include <sys/inotify.h>
+#  include <unistd.h>
+#endif
+
+// How long the files must stay untouched before we rebuild. Editors often
+//  write a file in several steps, and we want to compile the final version.
+static const int kQuietMilliseconds = 100;
+
+static std::string DirectoryOf(const std::string& Path)
+{
+   const std::size_t slash = Path.find_last_of('/');
+   return slash == std::string::npos ? "." : Path.substr(0, slash);
+}
+
+static std::string FileNameOf(const std::string& Path)
+{
+   const std::size_t slash = Path.find_last_of('/');
+   return slash == std::string::npos ? Path : Path.substr(slash + 1);
+}
+
+static bool IsFile(const std::string& Path, const std::string& Directory, const std::string& Name)
+{
+   return DirectoryOf(Path) == Directory && FileNameOf(Path) == Name;
+}
+
+ShaderHotReload::ShaderHotReload(const std::string& CacheDirectory,
+                                 std::function<bool()> BindContext,
+                                 std::function<void()> ReleaseContext)
+   : mCacheDirectory(CacheDirectory),
+     mBindContext(std::move(BindContext)),
+     mReleaseContext(std::move(ReleaseContext))
+{
+}
+
+ShaderHotReload::~ShaderHotReload()
+{
+   mStop = true;
+   if (mThread.joinable())
+   {
+      mThread.join();
+   }
+
+#if defined(__linux__)
+   if (mNotify >= 0)
+   {
+      close(mNotify);
+   }
+#endif
+
+   for (std::unique_ptr<WatchedProgram>& program : mPrograms)
+   {
+      const GLuint pending = program->Pending.exchange(0);
+      if (pending != 0)
+      {
+         glDeleteProgram(pending);
+      }
+   }
+}
+
+std::size_t ShaderHotReload::Watch(const std::string& VertexPath, const std::string& FragmentPath)
+{
+   std::unique_ptr<WatchedProgram> program(new WatchedProgram());
+   program->VertexPath = VertexPath;
+   program->FragmentPath = FragmentPath;
+   mPrograms.push_back(std::move(program));
+   return mPrograms.size() - 1;
+}
+
+bool ShaderHotReload::Update(std::size_t Slot, GLuint& Program)
+{
+   const GLuint program = mPrograms[Slot]->Pending.exchange(0);
+   if (program == 0)
+   {
+      return false;
+   }
+
+   glDeleteProgram(Program);
+   Program = program;
+   return true;
+}
+
+void ShaderHotReload::Rebuild(const std::vector<bool>& Dirty)
+{
+   // Same cache as the startup build, so the next launch gets the new binaries
+   ShaderCache cache(mCacheDirectory);
+   std::vector<std::pair<std::size_t, std::size_t>> slots;
+   for (std::size_t slot = 0; slot < mPrograms.size(); ++slot)
+   {
+      if (Dirty[slot])
+      {
+         slots.emplace_back(slot, cache.Add(mPrograms[slot]->VertexPath,
+                                            mPrograms[slot]->FragmentPath));
+      }
+   }
+
+   // Blocking is fine here, we are not on the render thread
+   cache.Start();
+   cache.Finish();
+
+   // Objects changed in one context are only guaranteed to be complete in
+   //  another one once the commands that changed them have finished.
+   glFinish();
+
+   for (const std::pair<std::size_t, std::size_t>& slot : slots)
+   {
+      WatchedProgram& watched = *mPrograms[slot.first];
+      const GLuint program = cache.GetProgram(slot.second);
+      if (program == 0)
+      {
+         std::cerr << "Shader hot-reload: keeping the previous program ("
+                   << watched.VertexPath << ", " << watched.FragmentPath << ")"
+                   << std::endl;
+         continue;
+      }
+
+      // If the render thread did not pick up the previous rebuild, it never will
+      const GLuint previous = watched.Pending.exchange(program);
+      if (previous != 0)
+      {
+         glDeleteProgram(previous);
+      }
+      std::cerr << "Shader hot-reload: rebuilt ("
+                << watched.VertexPath << ", " << watched.FragmentPath << ")"
+                << std::endl;
+   }
+}
+
+#if defined(__linux__)
+
+bool ShaderHotReload::Start()
+{
+   mNotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+   if (mNotify < 0)
+   {
+      std::cerr << "Shader hot-reload: inotify is not available" << std::endl;
+      return false;
+   }
+
+   // Watch directories rather than files: many editors save by writing a new
+   //  file and renaming it over the old one, which a file watch would miss.
+   for (const std::unique_ptr<WatchedProgram>& program : mPrograms)
+   {
+      for (const std::string& path : { program->VertexPath, program->FragmentPath })
+      {
+         const std::string directory = DirectoryOf(path);
+         bool watched = false;
+         for (const std::pair<int, std::string>& entry : mDirectories)
+         {
+            watched = watched || entry.second == directory;
+         }
+         if (watched)
+         {
+            continue;
+         }
+
+         const int descriptor = inotify_add_watch(mNotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+         if (descriptor < 0)
+         {
+            std::cerr << "Shader hot-reload: cannot watch " << directory << std::endl;
+            return false;
+         }
+         mDirectories.emplace_back(descriptor, directory);
+      }
+   }
+
+   mThread = std::thread(&ShaderHotReload::Run, this);
+   return true;
+}
+
+void ShaderHotReload::Run()
+{
+   if (!mBindContext())
+   {
+      std::cerr << "Shader hot-reload: the background context could not be made current" << std::endl;
+      return;
+   }
+
+   std::vector<bool> dirty(mPrograms.size(), false);
+   bool anyDirty = false;
+   alignas(inotify_event) char buffer[4096];
+
+   while (!mStop)
+   {
+      // Also wakes up regularly to check mStop
+      pollfd descriptor = { mNotify, POLLIN, 0 };
+      if (poll(&descriptor, 1, kQuietMilliseconds) <= 0)
+      {
+         // Quiet for a while: rebuild what changed, if anything did
+         if (anyDirty)
+         {
+            Rebuild(dirty);
+            dirty.assign(dirty.size(), false);
+            anyDirty = false;
+         }
+         continue;
+      }
+
+      const ssize_t length = read(mNotify, buffer, sizeof(buffer));
+      for (ssize_t offset = 0; offset < length; )
+      {
+         const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+         offset += sizeof(inotify_event) + event->len;
+         if (event->len == 0)
+         {
+            continue;
+         }
+
+         std::string directory;
+         for (const std::pair<int, std::string>& entry : mDirectories)
+         {
+            if (entry.first == event->wd)
+            {
+               directory = entry.second;
+            }
+         }
+
+         for (std::size_t slot = 0; slot < mPrograms.size(); ++slot)
+         {
+            if (IsFile(mPrograms[slot]->VertexPath, directory, event->name) ||
+                IsFile(mPrograms[slot]->FragmentPath, directory, event->name))
+            {
+               dirty[slot] = true;
+               anyDirty = true;
+            }
+         }
+      }
+   }
+
+   mReleaseContext();
+}
+
+#else
+
+bool ShaderHotReload::Start()
+{
+   std::cerr << "Shader hot-reload is only supported on Linux" << std::endl;
+   return false;
+}
+
+void ShaderHotReload::Run()
+{
+}
+
+#endif
@@ -0,0 +1,101 @@
+#pragma once
+
+// Third Party Libraries
+#include <glad/glad.h>
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+* ShaderHotReload rebuilds shader programs when their source files change,
+*  without restarting the application and without stalling the render loop.
+*
+* A background thread waits for file changes with inotify. When a watched
+*  file is written, the thread rebuilds the programs that use it with a
+*  ShaderCache, on its own OpenGL context that shares objects with the render
+*  context. A program that links is handed over to the render thread, which
+*  picks it up in Update() and swaps it in between two frames. A program that
+*  fails to build is dropped (its errors are printed) and the old one is kept.
+*
+* The render thread never waits: Update() only reads an atomic.
+*
+* E.g.
+*  ShaderHotReload reload("./shader-cache", BindWorkerContext, ReleaseWorkerContext);
+*  std::size_t slot = reload.Watch("./shaders/vert.glsl", "./shaders/frag.glsl");
+*  reload.Start();
+*  ...
+*  // Every frame, before using the program
+*  reload.Update(slot, gGraphicsPipelineShaderProgram);
+*/
+class ShaderHotReload
+{
+public:
+   /**
+   * @param CacheDirectory Directory of the ShaderCache the programs go through
+   * @param BindContext Called on the background thread before anything else.
+   *  Must make current a context that shares objects with the render context.
+   * @param ReleaseContext Called on the background thread before it exits.
+   */
+   ShaderHotReload(const std::string& CacheDirectory,
+                   std::function<bool()> BindContext,
+                   std::function<void()> ReleaseContext);
+
+   /**
+   * Stops the background thread and deletes the programs that were rebuilt
+   *  but not picked up. Needs the render context to be current.
+   */
+   ~ShaderHotReload();
+
+   ShaderHotReload(const ShaderHotReload&) = delete;
+   ShaderHotReload& operator=(const ShaderHotReload&) = delete;
+
+   /**
+   * Watches the two files of a program. Must be called before Start().
+   * @return Slot to pass to Update()
+   */
+   std::size_t Watch(const std::string& VertexPath, const std::string& FragmentPath);
+
+   /**
+   * Starts watching.
+   * @return false if watching files is not supported (only Linux is) or if
+   *  the files could not be watched.
+   */
+   bool Start();
+
+   /**
+   * If the program of Slot was rebuilt, deletes Program and replaces it with
+   *  the new one. Call it on the render thread, between frames.
+   * @return true if Program was replaced.
+   */
+   bool Update(std::size_t Slot, GLuint& Program);
+
+private:
+   struct WatchedProgram
+   {
+      std::string VertexPath;
+      std::string FragmentPath;
+      // Rebuilt program waiting for Update(), 0 if none
+      std::atomic<GLuint> Pending{0};
+   };
+
+   void Run();
+   void Rebuild(const std::vector<bool>& Dirty);
+
+   std::string mCacheDirectory;
+   std::function<bool()> mBindContext;
+   std::function<void()> mReleaseContext;
+   // unique_ptr because std::atomic can be neither copied nor moved
+   std::vector<std::unique_ptr<WatchedProgram>> mPrograms;
+   // inotify file descriptor and the directory watched by each watch descriptor
+   int mNotify = -1;
+   std::vector<std::pair<int, std::string>> mDirectories;
+   std::atomic<bool> mStop{false};
+   std::thread mThread;
+};
@@ -0,0 +1,79 @@
+#include "Simulation.hpp"
+
+// C++ Standard Libraries
+#include <algorithm>
+
+// How fast the offset moves with the arrows, per second
+static const float kOffsetSpeed = 0.6f;
+
+// If the thread falls this many ticks behind (e.g. the process was paused),
+//  it drops them instead of running them back to back to catch up
+static const int kMaxLateTicks = 5;
+
+Simulation::Simulation(double TickSeconds)
+   : mTick(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(TickSeconds)))
+{
+}
+
+Simulation::~Simulation()
+{
+   mStop = true;
+   if (mThread.joinable())
+   {
+      mThread.join();
+   }
+}
+
+void Simulation::Start()
+{
+   mThread = std::thread(&Simulation::Run, this);
+}
+
+void Simulation::Tick(SimulationState& State) const
+{
+   const float seconds = std::chrono::duration<float>(mTick).count();
+   State.Offset += mDirection.load(std::memory_order_relaxed) * kOffsetSpeed * seconds;
+}
+
+void Simulation::Run()
+{
+   SimulationState state = {};
+   std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now();
+
+   while (!mStop)
+   {
+      next += mTick;
+      const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+      if (now - next > kMaxLateTicks * mTick)
+      {
+         next = now;
+      }
+      std::this_thread::sleep_until(next);
+
+      // Every field is written: this copy holds an older snapshot
+      Snapshot& snapshot = mSnapshots.Write();
+      snapshot.Previous = state;
+      Tick(state);
+      snapshot.Current = state;
+      snapshot.Time = next;
+      mSnapshots.Publish();
+
+      mTicks.fetch_add(1, std::memory_order_relaxed);
+   }
+}
+
+SimulationState Simulation::Sample()
+{
+   mSnapshots.Update();
+   const Snapshot& snapshot = mSnapshots.Read();
+
+   // How far we are into the tick that follows the snapshot, from 0 to 1
+   const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - snapshot.Time).count();
+   const double tick = std::chrono::duration<double>(mTick).count();
+   const float alpha = static_cast<float>(std::min(std::max(elapsed / tick, 0.0), 1.0));
+
+   SimulationState state;
+   state.Offset = snapshot.Previous.Offset + (snapshot.Current.Offset - snapshot.Previous.Offset) * alpha;
+   return state;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+// Our own modules
+#include "TripleBuffer.hpp"
+
+// C++ Standard Libraries
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+/**
+* Everything the simulation computes and the renderer draws.
+*/
+struct SimulationState
+{
+   // Vertical offset of the scene, moved with the up and down arrows
+   float Offset;
+};
+
+/**
+* Simulation updates the SimulationState on its own thread, at a fixed tick,
+*  whatever the frame rate. A slow frame then does not slow the simulation
+*  down, and a slow tick does not hold a frame back.
+*
+* After every tick, the thread publishes a snapshot through a TripleBuffer:
+*  the state before and after the tick, and when the tick happened. The
+*  render thread samples the latest snapshot and interpolates between those
+*  two states according to the time elapsed since the tick, so that motion
+*  stays smooth when frames and ticks do not line up. This shows the state
+*  one tick late.
+*
+* Input goes the other way through atomics: the render thread, which owns
+*  the window and its events, sets it and the next tick reads it.
+*
+* E.g.
+*  Simulation simulation(1.0 / 120.0);
+*  simulation.Start();
+*  // Every frame, on the render thread
+*  simulation.SetInput(direction);
+*  const SimulationState state = simulation.Sample();
+*/
+class Simulation
+{
+public:
+   /**
+   * @param TickSeconds Duration of a tick
+   */
+   explicit Simulation(double TickSeconds);
+
+   // Stops the thread
+   ~Simulation();
+
+   Simulation(const Simulation&) = delete;
+   Simulation& operator=(const Simulation&) = delete;
+
+   void Start();
+
+   /**
+   * @param Direction Where the offset moves: 1 up, -1 down, 0 not at all
+   */
+   void SetInput(int Direction) { mDirection.store(Direction, std::memory_order_relaxed); }
+
+   /**
+   * Interpolates the state at the current time. Render thread only.
+   */
+   SimulationState Sample();
+
+   /**
+   * @return Number of ticks run so far
+   */
+   long long GetTickCount() const { return mTicks.load(std::memory_order_relaxed); }
+
+private:
+   struct Snapshot
+   {
+      SimulationState Previous;
+      SimulationState Current;
+      std::chrono::steady_clock::time_point Time;
+   };
+
+   void Run();
+   void Tick(SimulationState& State) const;
+
+   std::chrono::steady_clock::duration mTick;
+   TripleBuffer<Snapshot> mSnapshots;
+   std::atomic<int> mDirection{0};
+   std::atomic<long long> mTicks{0};
+   std::atomic<bool> mStop{false};
+   std::thread mThread;
+};
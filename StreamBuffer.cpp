@@ -0,0 +1,157 @@
+#include "StreamBuffer.hpp"
+
+// Our own modules
+#include "GLStateCache.hpp"
+
+// C++ Standard Libraries
+#include <cassert>
+#include <iostream>
+
+// One second, in nanoseconds
+static const GLuint64 kFenceTimeout = 1000000000;
+
+StreamBuffer::StreamBuffer(std::size_t FrameSize, bool AllowPersistent)
+   // Each region starts at a multiple of the frame size, which must keep the
+   //  offsets Allocate() aligns within the region aligned in the buffer too
+   : mFrameSize((FrameSize + kMaxAlignment - 1) & ~(kMaxAlignment - 1))
+{
+   // GL_COPY_WRITE_BUFFER is not part of any VAO, so binding our buffer there
+   //  never disturbs the vertex specification of whoever calls us.
+   glGenBuffers(1, &mBuffer);
+   GLState().BindBuffer(GL_COPY_WRITE_BUFFER, mBuffer);
+
+   if (AllowPersistent && GLAD_GL_ARB_buffer_storage)
+   {
+      const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+      const GLsizeiptr size = static_cast<GLsizeiptr>(mFrameSize * kRegionCount);
+      glBufferStorage(GL_COPY_WRITE_BUFFER, size, nullptr, flags);
+      mMapping = static_cast<char*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags));
+      mPersistent = mMapping != nullptr;
+
+      if (!mPersistent)
+      {
+         // Immutable storage cannot be reallocated, start over with a new buffer
+         std::cerr << "StreamBuffer: persistent mapping failed, using glBufferSubData"
+                   << std::endl;
+         GLState().BindBuffer(GL_COPY_WRITE_BUFFER, 0);
+         glDeleteBuffers(1, &mBuffer);
+         glGenBuffers(1, &mBuffer);
+         GLState().BindBuffer(GL_COPY_WRITE_BUFFER, mBuffer);
+      }
+   }
+
+   if (!mPersistent)
+   {
+      glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(mFrameSize), nullptr, GL_STREAM_DRAW);
+      mStaging.resize(mFrameSize);
+   }
+}
+
+StreamBuffer::~StreamBuffer()
+{
+   for (GLsync& fence : mFences)
+   {
+      if (fence != nullptr)
+      {
+         glDeleteSync(fence);
+      }
+   }
+
+   if (mPersistent)
+   {
+      GLState().BindBuffer(GL_COPY_WRITE_BUFFER, mBuffer);
+      glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+   }
+   // Deleting a bound buffer unbinds it, which the state cache would not see
+   GLState().BindBuffer(GL_COPY_WRITE_BUFFER, 0);
+   glDeleteBuffers(1, &mBuffer);
+}
+
+void StreamBuffer::BeginFrame()
+{
+   mHead = 0;
+   mFlushed = 0;
+
+   if (!mPersistent)
+   {
+      // Orphan the storage: the driver hands us fresh memory and keeps the
+      //  old one alive until the GPU is done with it.
+      GLState().BindBuffer(GL_COPY_WRITE_BUFFER, mBuffer);
+      glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(mFrameSize), nullptr, GL_STREAM_DRAW);
+      return;
+   }
+
+   GLsync& fence = mFences[mRegion];
+   if (fence == nullptr)
+   {
+      return;
+   }
+
+   // Usually signaled long ago, in which case this returns right away
+   GLenum result = glClientWaitSync(fence, 0, 0);
+   if (result == GL_TIMEOUT_EXPIRED)
+   {
+      ++mStalls;
+      while (result == GL_TIMEOUT_EXPIRED)
+      {
+         result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceTimeout);
+      }
+   }
+   if (result == GL_WAIT_FAILED)
+   {
+      std::cerr << "StreamBuffer: waiting for the GPU failed" << std::endl;
+   }
+
+   glDeleteSync(fence);
+   fence = nullptr;
+}
+
+void* StreamBuffer::Allocate(std::size_t Size, std::size_t& Offset, std::size_t Alignment)
+{
+   assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0 && Alignment <= kMaxAlignment);
+
+   const std::size_t start = (mHead + Alignment - 1) & ~(Alignment - 1);
+   if (start + Size > mFrameSize)
+   {
+      return nullptr;
+   }
+   mHead = start + Size;
+
+   if (mPersistent)
+   {
+      Offset = static_cast<std::size_t>(mRegion) * mFrameSize + start;
+      return mMapping + Offset;
+   }
+
+   Offset = start;
+   return mStaging.data() + start;
+}
+
+void StreamBuffer::Flush()
+{
+   // Coherent mapping: the GPU sees the writes without us doing anything
+   if (mPersistent || mFlushed == mHead)
+   {
+      return;
+   }
+
+   GLState().BindBuffer(GL_COPY_WRITE_BUFFER, mBuffer);
+   glBufferSubData(GL_COPY_WRITE_BUFFER,
+                   static_cast<GLintptr>(mFlushed),
+                   static_cast<GLsizeiptr>(mHead - mFlushed),
+                   mStaging.data() + mFlushed);
+   mFlushed = mHead;
+}
+
+void StreamBuffer::EndFrame()
+{
+   if (!mPersistent)
+   {
+      return;
+   }
+
+   // Signaled once the GPU has run every command issued so far, i.e. every
+   //  draw call that reads this region.
+   mFences[mRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+   mRegion = (mRegion + 1) % kRegionCount;
+}
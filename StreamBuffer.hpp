@@ -0,0 +1,113 @@
+#pragma once
+
+// Third Party Libraries
+#include <glad/glad.h>
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <vector>
+
+/**
+* StreamBuffer is a buffer object for data that changes every frame (dynamic
+*  vertices, instance data...).
+*
+* With GL_ARB_buffer_storage (core in 4.4), the buffer is created with
+*  glBufferStorage and mapped once, persistently and coherently: Allocate()
+*  returns a pointer straight into GPU visible memory and nothing is copied
+*  or uploaded afterwards. The buffer holds three regions, one per frame in
+*  flight. When a frame ends we put a fence (glFenceSync) behind its draw
+*  calls, and the region is only written again once that fence is signaled,
+*  three frames later. By then the GPU is almost always done with it, so the
+*  CPU rarely waits.
+*
+* On plain 4.1 contexts (like the one InitializeProgram() asks for) there is
+*  no glBufferStorage. The buffer then holds a single region, Allocate()
+*  returns a pointer into a CPU copy, and Flush() uploads what was written
+*  with glBufferSubData, after orphaning the storage with glBufferData at the
+*  start of each frame so that the driver never waits for the GPU either.
+*
+* E.g.
+*  StreamBuffer stream(64 * 1024);
+*  // Every frame
+*  stream.BeginFrame();
+*  std::size_t offset = 0;
+*  float* vertices = static_cast<float*>(stream.Allocate(size, offset));
+*  ... write the vertices ...
+*  stream.Flush();
+*  glBindBuffer(GL_ARRAY_BUFFER, stream.GetBuffer());
+*  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (GLvoid*)offset);
+*  ... draw ...
+*  stream.EndFrame();
+*/
+class StreamBuffer
+{
+public:
+   // Number of regions of the persistent buffer, i.e. frames in flight
+   static const int kRegionCount = 3;
+   // Largest Alignment Allocate() supports; regions start on multiples of it
+   static const std::size_t kMaxAlignment = 256;
+
+   /**
+   * @param FrameSize Bytes that can be allocated per frame, rounded up to a
+   *  multiple of kMaxAlignment
+   * @param AllowPersistent Use a persistent mapping if the context supports
+   *  it. Pass false to test the glBufferSubData fallback.
+   */
+   explicit StreamBuffer(std::size_t FrameSize, bool AllowPersistent = true);
+   ~StreamBuffer();
+
+   StreamBuffer(const StreamBuffer&) = delete;
+   StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+   /**
+   * Starts a frame. Waits, if needed, until the GPU is done with the region
+   *  this frame is going to write.
+   */
+   void BeginFrame();
+
+   /**
+   * Reserves Size bytes in the current frame.
+   * @param Size Number of bytes to write
+   * @param Offset Receives the offset of these bytes in the buffer object,
+   *  to pass to glVertexAttribPointer, glDrawElementsBaseVertex...
+   * @param Alignment Alignment of the offset, a power of two up to
+   *  kMaxAlignment
+   * @return Where to write the bytes, or nullptr if the frame is full.
+   */
+   void* Allocate(std::size_t Size, std::size_t& Offset, std::size_t Alignment = 16);
+
+   /**
+   * Makes everything allocated so far visible to the GPU. Call it before the
+   *  draw calls that read the data. Nothing to do with a persistent mapping.
+   */
+   void Flush();
+
+   /**
+   * Ends the frame, after its last draw call that reads the buffer.
+   */
+   void EndFrame();
+
+   GLuint GetBuffer() const { return mBuffer; }
+   bool IsPersistent() const { return mPersistent; }
+
+   /**
+   * @return How many times BeginFrame() had to wait for the GPU.
+   */
+   int GetStallCount() const { return mStalls; }
+
+private:
+   GLuint mBuffer = 0;
+   std::size_t mFrameSize = 0;
+   bool mPersistent = false;
+   // Persistent mapping of the whole buffer
+   char* mMapping = nullptr;
+   // CPU copy of the frame for the glBufferSubData fallback
+   std::vector<char> mStaging;
+   // Region written by the current frame, and its fence from kRegionCount frames ago
+   int mRegion = 0;
+   GLsync mFences[kRegionCount] = {};
+   // Bytes allocated in the current frame, and bytes already uploaded (fallback)
+   std::size_t mHead = 0;
+   std::size_t mFlushed = 0;
+   int mStalls = 0;
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+
+/**
+* TripleBuffer hands values of T from one writer thread to one reader thread
+*  without locks and without either of them ever waiting for the other.
+*
+* There are three copies of T: the writer owns one, the reader owns one, and
+*  the third sits in the middle. Publish() swaps the writer's copy with the
+*  middle one, Update() swaps the middle one with the reader's copy, each
+*  with a single atomic exchange. The middle index carries a flag telling
+*  whether it holds something the reader has not seen yet. The reader always
+*  gets the latest complete value; values it is too slow to see are skipped.
+*
+* E.g.
+*  TripleBuffer<State> buffer;
+*  // Writer thread
+*  buffer.Write() = state;
+*  buffer.Publish();
+*  // Reader thread
+*  buffer.Update();
+*  const State& state = buffer.Read();
+*/
+template <typename T>
+class TripleBuffer
+{
+public:
+   TripleBuffer() = default;
+   TripleBuffer(const TripleBuffer&) = delete;
+   TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+   /**
+   * @return The writer's copy. Only the writer thread may touch it.
+   */
+   T& Write() { return mBuffers[mWrite]; }
+
+   /**
+   * Makes the writer's copy the latest value. Write() then returns another
+   *  copy, holding an older value: write every field before publishing again.
+   */
+   void Publish()
+   {
+      mWrite = mMiddle.exchange(mWrite | kFresh, std::memory_order_acq_rel) & kIndexMask;
+   }
+
+   /**
+   * Takes the latest published value, if there is one the reader has not
+   *  seen yet.
+   * @return true if Read() changed.
+   */
+   bool Update()
+   {
+      if ((mMiddle.load(std::memory_order_relaxed) & kFresh) == 0)
+      {
+         return false;
+      }
+      mRead = mMiddle.exchange(mRead, std::memory_order_acq_rel) & kIndexMask;
+      return true;
+   }
+
+   /**
+   * @return The reader's copy, as of the last Update(). Only the reader
+   *  thread may touch it.
+   */
+   const T& Read() const { return mBuffers[mRead]; }
+
+private:
+   static const unsigned kIndexMask = 3;
+   static const unsigned kFresh = 4;
+
+   T mBuffers[3] = {};
+   unsigned mWrite = 0;
+   std::atomic<unsigned> mMiddle{1};
+   unsigned mRead = 2;
+};
@@ -0,0 +1,179 @@
+#include "VertexFormat.hpp"
+
+// Third Party Libraries
+#include <glm/gtc/packing.hpp>
+
+// C++ Standard Libraries
+#include <cassert>
+#include <cstring>
+#include <iostream>
+
+// Components the 10_10_10_2 encodings always store; a missing w reads as 1
+static const GLint kPackedComponents = 4;
+
+static bool IsPacked(VertexEncoding Encoding)
+{
+   return Encoding == VertexEncoding::Snorm10_10_10_2 ||
+          Encoding == VertexEncoding::Unorm10_10_10_2 ||
+          Encoding == VertexEncoding::Float11_11_10;
+}
+
+// Bytes of an attribute in the packed vertex, before padding
+static std::size_t AttributeSize(const VertexAttribute& Attribute)
+{
+   switch (Attribute.Encoding)
+   {
+   case VertexEncoding::Float:  return sizeof(GLfloat) * Attribute.Components;
+   case VertexEncoding::Half:   return sizeof(GLhalf) * Attribute.Components;
+   case VertexEncoding::Snorm8:
+   case VertexEncoding::Unorm8: return Attribute.Components;
+   default:                     return sizeof(GLuint);
+   }
+}
+
+static GLenum AttributeType(VertexEncoding Encoding)
+{
+   switch (Encoding)
+   {
+   case VertexEncoding::Float:           return GL_FLOAT;
+   case VertexEncoding::Half:            return GL_HALF_FLOAT;
+   case VertexEncoding::Snorm8:          return GL_BYTE;
+   case VertexEncoding::Unorm8:          return GL_UNSIGNED_BYTE;
+   case VertexEncoding::Snorm10_10_10_2: return GL_INT_2_10_10_10_REV;
+   case VertexEncoding::Unorm10_10_10_2: return GL_UNSIGNED_INT_2_10_10_10_REV;
+   default:                              return GL_UNSIGNED_INT_10F_11F_11F_REV;
+   }
+}
+
+VertexFormat::VertexFormat(const std::vector<VertexAttribute>& Attributes)
+{
+   std::size_t offset = 0;
+   for (const VertexAttribute& attribute : Attributes)
+   {
+      const bool valid = attribute.Encoding == VertexEncoding::Float11_11_10
+         ? attribute.Components == 3
+         : IsPacked(attribute.Encoding)
+            ? attribute.Components == 3 || attribute.Components == 4
+            : attribute.Components >= 1 && attribute.Components <= 4;
+      if (!valid)
+      {
+         // Pack() would read past the attribute: reject the whole format
+         std::cerr << "Vertex attribute " << attribute.Location
+                   << " cannot have " << attribute.Components
+                   << " components in its encoding" << std::endl;
+         assert(!"Invalid vertex attribute");
+         mLayouts.clear();
+         mComponentCount = 0;
+         return;
+      }
+
+      mLayouts.push_back(Layout{ attribute, offset });
+      // Keep every attribute 4 byte aligned
+      offset += (AttributeSize(attribute) + 3) & ~std::size_t(3);
+      mComponentCount += attribute.Components;
+   }
+   mStride = static_cast<GLsizei>(offset);
+   mValid = true;
+}
+
+bool VertexFormat::IsSupported(VertexEncoding Encoding)
+{
+   if (Encoding == VertexEncoding::Float11_11_10)
+   {
+      // Core in 4.4, which glad does not go up to: drivers expose the extension
+      return GLAD_GL_ARB_vertex_type_10f_11f_11f_rev != 0;
+   }
+   return true;
+}
+
+std::vector<GLubyte> VertexFormat::Pack(const std::vector<GLfloat>& Vertices) const
+{
+   if (mComponentCount == 0)
+   {
+      return {};
+   }
+
+   const std::size_t vertexCount = Vertices.size() / mComponentCount;
+   // Zeroed, so the padding is too
+   std::vector<GLubyte> packed(vertexCount * mStride, 0);
+
+   const GLfloat* source = Vertices.data();
+   for (std::size_t vertex = 0; vertex < vertexCount; ++vertex)
+   {
+      GLubyte* destination = packed.data() + vertex * mStride;
+      for (const Layout& layout : mLayouts)
+      {
+         const GLint components = layout.Attribute.Components;
+         GLubyte* out = destination + layout.Offset;
+
+         switch (layout.Attribute.Encoding)
+         {
+         case VertexEncoding::Float:
+            std::memcpy(out, source, sizeof(GLfloat) * components);
+            break;
+         case VertexEncoding::Half:
+            for (GLint i = 0; i < components; ++i)
+            {
+               const glm::uint16 half = glm::packHalf1x16(source[i]);
+               std::memcpy(out + i * sizeof(half), &half, sizeof(half));
+            }
+            break;
+         case VertexEncoding::Snorm8:
+            for (GLint i = 0; i < components; ++i)
+            {
+               out[i] = glm::packSnorm1x8(source[i]);
+            }
+            break;
+         case VertexEncoding::Unorm8:
+            for (GLint i = 0; i < components; ++i)
+            {
+               out[i] = glm::packUnorm1x8(source[i]);
+            }
+            break;
+         case VertexEncoding::Snorm10_10_10_2:
+         case VertexEncoding::Unorm10_10_10_2:
+         {
+            const glm::vec4 value(source[0], source[1], source[2], components == 4 ? source[3] : 1.0f);
+            const glm::uint32 word = layout.Attribute.Encoding == VertexEncoding::Snorm10_10_10_2
+               ? glm::packSnorm3x10_1x2(value)
+               : glm::packUnorm3x10_1x2(value);
+            std::memcpy(out, &word, sizeof(word));
+            break;
+         }
+         case VertexEncoding::Float11_11_10:
+         {
+            const glm::uint32 word = glm::packF2x11_1x10(glm::vec3(source[0], source[1], source[2]));
+            std::memcpy(out, &word, sizeof(word));
+            break;
+         }
+         }
+
+         source += components;
+      }
+   }
+
+   return packed;
+}
+
+void VertexFormat::Apply(std::size_t Offset) const
+{
+   for (const Layout& layout : mLayouts)
+   {
+      const VertexEncoding encoding = layout.Attribute.Encoding;
+      const GLint size = encoding == VertexEncoding::Float11_11_10 ? 3
+         : IsPacked(encoding) ? kPackedComponents
+         : layout.Attribute.Components;
+      // Integers are read back as 0..1 or -1..1; floats of any size as they are
+      const GLboolean normalized = encoding == VertexEncoding::Float ||
+                                   encoding == VertexEncoding::Half ||
+                                   encoding == VertexEncoding::Float11_11_10 ? GL_FALSE : GL_TRUE;
+
+      glEnableVertexAttribArray(layout.Attribute.Location);
+      glVertexAttribPointer(layout.Attribute.Location,
+                            size,
+                            AttributeType(encoding),
+                            normalized,
+                            mStride,
+                            (GLvoid*)(Offset + layout.Offset));
+   }
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+// Third Party Libraries
+#include <glad/glad.h>
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <vector>
+
+/**
+* How one vertex attribute is stored in the vertex buffer. Every attribute
+*  starts on a 4 byte boundary, so smaller ones are padded.
+*/
+enum class VertexEncoding
+{
+   // 4 bytes per component, as is
+   Float,
+   // 2 bytes per component, half floats (glm::packHalf1x16)
+   Half,
+   // 1 byte per component, -1..1 (glm::packSnorm1x8)
+   Snorm8,
+   // 1 byte per component, 0..1 (glm::packUnorm1x8), e.g. colors
+   Unorm8,
+   // 3 components of 10 bits and one of 2 in 4 bytes, -1..1
+   //  (glm::packSnorm3x10_1x2), e.g. positions in a unit cube or normals
+   Snorm10_10_10_2,
+   // Same, 0..1 (glm::packUnorm3x10_1x2)
+   Unorm10_10_10_2,
+   // 3 positive floats of 11, 11 and 10 bits in 4 bytes (glm::packF2x11_1x10),
+   //  e.g. HDR colors. Needs GL 4.4 or GL_ARB_vertex_type_10f_11f_11f_rev.
+   Float11_11_10
+};
+
+struct VertexAttribute
+{
+   // layout(location = ...) in the vertex shader
+   GLuint Location;
+   // 1 to 4; 3 or 4 for the 10_10_10_2 encodings, 3 for Float11_11_10
+   GLint Components;
+   VertexEncoding Encoding;
+};
+
+/**
+* VertexFormat turns a description of the vertex attributes into an
+*  interleaved, packed vertex buffer and the glVertexAttribPointer calls
+*  that read it back.
+*
+* Geometry is written as plain floats, the components of every attribute
+*  one after another, and Pack() encodes them. The shaders do not change:
+*  normalized integers and half floats reach them as floats. E.g. position
+*  in Snorm10_10_10_2 and color in Unorm8 take 8 bytes per vertex instead of
+*  the 24 bytes of 6 floats.
+*
+* The normalized encodings clamp, so positions must be scaled into -1..1
+*  (e.g. by the model matrix) to use them.
+*
+* E.g.
+*  VertexFormat format({ { 0, 3, VertexEncoding::Snorm10_10_10_2 },
+*                        { 1, 3, VertexEncoding::Unorm8 } });
+*  std::vector<GLubyte> packed = format.Pack(vertices);  // x, y, z, r, g, b, ...
+*  glBufferData(GL_ARRAY_BUFFER, packed.size(), packed.data(), GL_STATIC_DRAW);
+*  format.Apply();  // with the VAO and the vertex buffer bound
+*/
+class VertexFormat
+{
+public:
+   /**
+   * An attribute with a Components count its encoding cannot store makes
+   *  the format invalid: it then has no attributes and packs nothing.
+   */
+   explicit VertexFormat(const std::vector<VertexAttribute>& Attributes);
+
+   bool IsValid() const { return mValid; }
+
+   /**
+   * @return false if the context cannot read Encoding, i.e. Float11_11_10
+   *  without GL_ARB_vertex_type_10f_11f_11f_rev.
+   */
+   static bool IsSupported(VertexEncoding Encoding);
+
+   // Bytes per packed vertex
+   GLsizei GetStride() const { return mStride; }
+   // Floats per vertex given to Pack()
+   std::size_t GetComponentCount() const { return mComponentCount; }
+
+   /**
+   * @param Vertices GetComponentCount() floats per vertex
+   * @return GetStride() bytes per vertex, nothing if the format has no
+   *  attributes
+   */
+   std::vector<GLubyte> Pack(const std::vector<GLfloat>& Vertices) const;
+
+   /**
+   * Enables the attributes of the bound VAO and points them at the bound
+   *  GL_ARRAY_BUFFER.
+   * @param Offset Where the first vertex starts in the buffer
+   */
+   void Apply(std::size_t Offset = 0) const;
+
+private:
+   struct Layout
+   {
+      VertexAttribute Attribute;
+      // Where the attribute starts in the packed vertex
+      std::size_t Offset;
+   };
+
+   std::vector<Layout> mLayouts;
+   GLsizei mStride = 0;
+   std::size_t mComponentCount = 0;
+   bool mValid = false;
+};
@@ -704,6 +704,13 @@ GLAPI int gladLoadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+/* Like gladLoadGLLoader, but only loads the core versions up to major.minor
+ * (and not past what the context supports), and only the extensions listed in
+ * extensions, a NULL terminated array of names such as "GL_ARB_buffer_storage".
+ * Every other GLAD_GL_* flag reads 0 and its functions stay NULL. Skips most
+ * of the function lookups and extension string comparisons of a full load. */
+GLAPI int gladLoadGLLoaderScoped(GLADloadproc load, int major, int minor, const char * const *extensions);
+
 #include <KHR/khrplatform.h>
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;
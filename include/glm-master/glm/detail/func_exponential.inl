@@ -31,6 +31,33 @@ namespace detail
 		}
 	};
 
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_exp
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::exp, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_log
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::log, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_pow
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& base, vec<L, T, Q> const& exponent)
+		{
+			return detail::functor2<vec, L, T, Q>::call(std::pow, base, exponent);
+		}
+	};
+
 	template<length_t L, typename T, qualifier Q, bool Aligned>
 	struct compute_sqrt
 	{
@@ -71,7 +98,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> pow(vec<L, T, Q> const& base, vec<L, T, Q> const& exponent)
 	{
-		return detail::functor2<vec, L, T, Q>::call(pow, base, exponent);
+		return detail::compute_pow<L, T, Q, detail::is_aligned<Q>::value>::call(base, exponent);
 	}
 
 	// exp
@@ -79,7 +106,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> exp(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(exp, x);
+		return detail::compute_exp<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 	// log
@@ -87,7 +114,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> log(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(log, x);
+		return detail::compute_log<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 #   if GLM_HAS_CXX11_STL
@@ -103,10 +130,22 @@ namespace detail
 	}
 #   endif
 
+namespace detail
+{
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_exp2
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(exp2, x);
+		}
+	};
+}//namespace detail
+
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> exp2(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(exp2, x);
+		return detail::compute_exp2<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 	// log2, ln2 = 0.69314718055994530941723212145818f
@@ -3,6 +3,70 @@
 
 #include "../simd/exponential.h"
 
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_ARMV8_BIT)
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_exp<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_exp(x.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_exp2<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_exp2(x.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_log(x.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log2<4, float, Q, true, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_log2(x.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_pow<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& base, vec<4, float, Q> const& exponent)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_pow(base.data, exponent.data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//(GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_ARMV8_BIT)
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
 namespace glm{
@@ -0,0 +1,57 @@
+/// @ref core
+/// @file glm/detail/func_trigonometric_simd.inl
+
+#include "../simd/trigonometric.h"
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_ARMV8_BIT)
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_sin<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_sin(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_cos(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_tan<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_tan(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_atan2<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& y, vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_atan2(y.data, x.data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//(GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_ARMV8_BIT)
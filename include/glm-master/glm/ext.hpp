@@ -196,6 +196,7 @@
 #ifdef GLM_ENABLE_EXPERIMENTAL
 #include "./gtx/associated_min_max.hpp"
 #include "./gtx/bit.hpp"
+#include "./gtx/bvh.hpp"
 #include "./gtx/closest_point.hpp"
 #include "./gtx/color_encoding.hpp"
 #include "./gtx/color_space.hpp"
@@ -211,6 +212,7 @@
 #include "./gtx/fast_exponential.hpp"
 #include "./gtx/fast_square_root.hpp"
 #include "./gtx/fast_trigonometry.hpp"
+#include "./gtx/frustum.hpp"
 #include "./gtx/functions.hpp"
 #include "./gtx/gradient_paint.hpp"
 #include "./gtx/handed_coordinate_space.hpp"
@@ -231,27 +233,34 @@
 #include "./gtx/matrix_operation.hpp"
 #include "./gtx/matrix_query.hpp"
 #include "./gtx/mixed_product.hpp"
+#include "./gtx/noise_batch.hpp"
 #include "./gtx/norm.hpp"
 #include "./gtx/normal.hpp"
 #include "./gtx/normalize_dot.hpp"
 #include "./gtx/number_precision.hpp"
 #include "./gtx/optimum_pow.hpp"
 #include "./gtx/orthonormalize.hpp"
+#include "./gtx/packing_batch.hpp"
 #include "./gtx/pca.hpp"
 #include "./gtx/perpendicular.hpp"
 #include "./gtx/polar_coordinates.hpp"
 #include "./gtx/projection.hpp"
+#include "./gtx/random.hpp"
 #include "./gtx/quaternion.hpp"
 #include "./gtx/raw_data.hpp"
 #include "./gtx/rotate_normalized_axis.hpp"
 #include "./gtx/rotate_vector.hpp"
+#include "./gtx/simd_dispatch.hpp"
 #include "./gtx/spline.hpp"
 #include "./gtx/std_based_type.hpp"
 #if !((GLM_COMPILER & GLM_COMPILER_CUDA) || (GLM_COMPILER & GLM_COMPILER_HIP))
 #	include "./gtx/string_cast.hpp"
 #endif
+#include "./gtx/transcendental_batch.hpp"
 #include "./gtx/transform.hpp"
 #include "./gtx/transform2.hpp"
+#include "./gtx/transform_batch.hpp"
+#include "./gtx/vec_soa.hpp"
 #include "./gtx/vec_swizzle.hpp"
 #include "./gtx/vector_angle.hpp"
 #include "./gtx/vector_query.hpp"
@@ -0,0 +1,122 @@
+/// @ref gtx_bvh
+/// @file glm/gtx/bvh.hpp
+///
+/// @see core (dependence)
+/// @see gtx_intersect (dependence)
+/// @see gtx_vec_soa (dependence)
+///
+/// @defgroup gtx_bvh GLM_GTX_bvh
+/// @ingroup gtx
+///
+/// Include <glm/gtx/bvh.hpp> to use the features of this extension.
+///
+/// Bounding volume hierarchy over triangle arrays, to find the closest triangle hit by rays
+/// without testing every triangle with intersectRayTriangle.
+/// The tree is built with the binned surface area heuristic (SAH) and stored depth first in
+/// 32 bytes nodes, the first child of a node following it. Leaf triangles are stored as
+/// structure of arrays: a single ray tests 4 (SSE2, NEON) or 8 (AVX) triangles per instruction,
+/// and packets of 4 or 8 rays are tested together against each box and triangle.
+
+#pragma once
+
+// Dependencies:
+#include "../glm.hpp"
+#include "intersect.hpp"
+#include "vec_soa.hpp"
+#include <vector>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_bvh is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_bvh extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_bvh
+	/// @{
+
+	/// Closest hit of a ray, as returned by intersectRayTriangle for that triangle.
+	/// @see gtx_bvh
+	template<typename T>
+	struct bvh_hit
+	{
+		vec<2, T, defaultp> baryPosition;
+		T distance;
+		/// Index of the triangle in the build arrays, bvh<T>::none when the ray hits nothing.
+		uint32 triangle;
+	};
+
+namespace detail
+{
+	template<typename T>
+	struct bvh_node
+	{
+		vec<3, T, defaultp> Min;
+		uint32 Offset; // First triangle of a leaf, second child of an inner node
+		vec<3, T, defaultp> Max;
+		uint16 Count; // Triangles of a leaf, 0 for an inner node
+		uint16 Axis; // Split axis of an inner node
+	};
+}//namespace detail
+
+	/// Bounding volume hierarchy over triangles.
+	/// A ray hits a triangle when intersectRayTriangle returns true with a distance in
+	/// [0, +infinity): both faces are hit and the ray direction doesn't need to be normalized.
+	/// Only float trees are traversed with SIMD instructions.
+	/// @see gtx_bvh
+	template<typename T>
+	class bvh
+	{
+	public:
+		typedef T value_type;
+
+		/// Triangle index of a missed ray.
+		static uint32 const none = 0xFFFFFFFF;
+
+		GLM_FUNC_DISCARD_DECL bvh();
+
+		/// Builds the tree over the triangles (vertices[3 * i], vertices[3 * i + 1], vertices[3 * i + 2]).
+		/// Subtrees are built by up to 'threads' threads, 0 meaning one per hardware thread.
+		/// Without C++11 STL support, the tree is built on the calling thread.
+		template<qualifier Q>
+		GLM_FUNC_DISCARD_DECL void build(vec<3, T, Q> const* vertices, std::size_t triangleCount, unsigned threads = 1);
+
+		/// Builds the tree over the triangles (vertices[indices[3 * i]], vertices[indices[3 * i + 1]], vertices[indices[3 * i + 2]]).
+		/// Subtrees are built by up to 'threads' threads, 0 meaning one per hardware thread.
+		/// Without C++11 STL support, the tree is built on the calling thread.
+		template<qualifier Q>
+		GLM_FUNC_DISCARD_DECL void build(vec<3, T, Q> const* vertices, uint32 const* indices, std::size_t triangleCount, unsigned threads = 1);
+
+		/// Number of triangles of the last build.
+		GLM_FUNC_DECL std::size_t size() const;
+
+		/// Number of nodes of the tree, leaves included.
+		GLM_FUNC_DECL std::size_t node_count() const;
+
+		/// Finds the closest triangle hit by the ray.
+		/// Returns false and leaves the outputs unchanged when no triangle is hit.
+		template<qualifier Q>
+		GLM_FUNC_DECL bool intersect(vec<3, T, Q> const& orig, vec<3, T, Q> const& dir, vec<2, T, Q>& baryPosition, T& distance, uint32& triangle) const;
+
+		/// Finds the closest triangle hit by each of the 'count' rays.
+		/// Rays are traversed by packets of 4 or 8 consecutive rays sharing the same nodes,
+		/// which is faster when consecutive rays are coherent, like the rays of a screen tile.
+		template<qualifier Q>
+		GLM_FUNC_DISCARD_DECL void intersect(vec<3, T, Q> const* orig, vec<3, T, Q> const* dir, std::size_t count, bvh_hit<T>* hits) const;
+
+	private:
+		template<typename Corners>
+		GLM_FUNC_DISCARD_DECL void build_tree(Corners const& corners, std::size_t triangleCount, unsigned threads);
+
+		std::vector<detail::bvh_node<T> > Nodes;
+		vec_soa<3, T> Vert0;
+		vec_soa<3, T> Edge1;
+		vec_soa<3, T> Edge2;
+		std::vector<uint32> Triangles;
+	};
+
+	/// @}
+}//namespace glm
+
+#include "bvh.inl"
@@ -0,0 +1,787 @@
+/// @ref gtx_bvh
+
+#include <algorithm>
+#include <limits>
+#if GLM_HAS_CXX11_STL
+#	include <thread>
+#endif
+
+namespace glm{
+namespace detail
+{
+	// The GTX_vec_soa packs extended with comparisons. A mask has all the bits of a lane set
+	// when the comparison is true for that lane, bits() gathers one bit per lane.
+	template<typename T>
+	struct bvh_scalar : public soa_scalar<T>
+	{
+		typedef T type;
+		typedef bool mask;
+
+		GLM_FUNC_QUALIFIER static type abs(type a) { return glm::abs(a); }
+		GLM_FUNC_QUALIFIER static type flipsign(type a, type b) { return b < static_cast<T>(0) ? -a : a; }
+		GLM_FUNC_QUALIFIER static mask lt(type a, type b) { return a < b; }
+		GLM_FUNC_QUALIFIER static mask le(type a, type b) { return a <= b; }
+		GLM_FUNC_QUALIFIER static mask gt(type a, type b) { return a > b; }
+		GLM_FUNC_QUALIFIER static mask ge(type a, type b) { return a >= b; }
+		GLM_FUNC_QUALIFIER static mask mask_and(mask a, mask b) { return a && b; }
+		GLM_FUNC_QUALIFIER static type select(mask m, type a, type b) { return m ? a : b; }
+		GLM_FUNC_QUALIFIER static int bits(mask m) { return m ? 1 : 0; }
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	struct bvh_avx_f32 : public soa_avx_f32
+	{
+		typedef __m256 mask;
+
+		GLM_FUNC_QUALIFIER static type abs(type a) { return _mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF))); }
+		GLM_FUNC_QUALIFIER static type flipsign(type a, type b) { return _mm256_xor_ps(a, _mm256_and_ps(b, _mm256_set1_ps(-0.0f))); }
+		GLM_FUNC_QUALIFIER static mask lt(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		GLM_FUNC_QUALIFIER static mask le(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+		GLM_FUNC_QUALIFIER static mask gt(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+		GLM_FUNC_QUALIFIER static mask ge(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+		GLM_FUNC_QUALIFIER static mask mask_and(mask a, mask b) { return _mm256_and_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type select(mask m, type a, type b) { return _mm256_blendv_ps(b, a, m); }
+		GLM_FUNC_QUALIFIER static int bits(mask m) { return _mm256_movemask_ps(m); }
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	struct bvh_sse2_f32 : public soa_sse2_f32
+	{
+		typedef __m128 mask;
+
+		GLM_FUNC_QUALIFIER static type abs(type a) { return _mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF))); }
+		GLM_FUNC_QUALIFIER static type flipsign(type a, type b) { return _mm_xor_ps(a, _mm_and_ps(b, _mm_set1_ps(-0.0f))); }
+		GLM_FUNC_QUALIFIER static mask lt(type a, type b) { return _mm_cmplt_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask le(type a, type b) { return _mm_cmple_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask gt(type a, type b) { return _mm_cmpgt_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask ge(type a, type b) { return _mm_cmpge_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask mask_and(mask a, mask b) { return _mm_and_ps(a, b); }
+		GLM_FUNC_QUALIFIER static int bits(mask m) { return _mm_movemask_ps(m); }
+		GLM_FUNC_QUALIFIER static type select(mask m, type a, type b)
+		{
+#			if GLM_ARCH & GLM_ARCH_SSE41_BIT
+				return _mm_blendv_ps(b, a, m);
+#			else
+				return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+#			endif
+		}
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	struct bvh_neon_f32 : public soa_neon_f32
+	{
+		typedef uint32x4_t mask;
+
+		GLM_FUNC_QUALIFIER static type abs(type a) { return vabsq_f32(a); }
+		GLM_FUNC_QUALIFIER static type flipsign(type a, type b) { return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), vandq_u32(vreinterpretq_u32_f32(b), vdupq_n_u32(0x80000000)))); }
+		GLM_FUNC_QUALIFIER static mask lt(type a, type b) { return vcltq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static mask le(type a, type b) { return vcleq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static mask gt(type a, type b) { return vcgtq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static mask ge(type a, type b) { return vcgeq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static mask mask_and(mask a, mask b) { return vandq_u32(a, b); }
+		GLM_FUNC_QUALIFIER static type select(mask m, type a, type b) { return vbslq_f32(m, a, b); }
+		GLM_FUNC_QUALIFIER static int bits(mask m)
+		{
+			static int32 const Shift[4] = {0, 1, 2, 3};
+			return static_cast<int>(vaddvq_u32(vshlq_u32(vshrq_n_u32(m, 31), vld1q_s32(Shift))));
+		}
+	};
+#	endif
+
+	// Widest bvh pack available for T at compile time
+	template<typename T>
+	struct bvh_native
+	{
+		typedef bvh_scalar<T> type;
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<>
+	struct bvh_native<float>
+	{
+		typedef bvh_avx_f32 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct bvh_native<float>
+	{
+		typedef bvh_sse2_f32 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<>
+	struct bvh_native<float>
+	{
+		typedef bvh_neon_f32 type;
+	};
+#	endif
+
+	enum
+	{
+		bvh_bin_count = 16,
+		bvh_max_leaf = 8, // Triangles tested by one AVX iteration
+		bvh_max_sah_depth = 48, // Deeper nodes are split at the median, which bounds the traversal stack
+		bvh_stack_size = 128,
+		bvh_parallel_triangles = 4096 // Smaller subtrees aren't worth a thread
+	};
+
+	// intersectRayTriangle on P::width lanes: either one ray against several triangles or
+	// several rays against one triangle. Returns the mask of the lanes where the ray hits the
+	// triangle, with the distance and barycentric coordinates computed in the same order.
+	template<typename P, typename T>
+	GLM_FUNC_QUALIFIER typename P::mask bvh_intersect_triangles(
+		typename P::type const* Orig, typename P::type const* Dir,
+		typename P::type const* Vert0, typename P::type const* Edge1, typename P::type const* Edge2,
+		typename P::type& Distance, typename P::type& BaryX, typename P::type& BaryY)
+	{
+		typedef typename P::type pack;
+
+		// p = cross(dir, edge2)
+		pack const px = P::sub(P::mul(Dir[1], Edge2[2]), P::mul(Edge2[1], Dir[2]));
+		pack const py = P::sub(P::mul(Dir[2], Edge2[0]), P::mul(Edge2[2], Dir[0]));
+		pack const pz = P::sub(P::mul(Dir[0], Edge2[1]), P::mul(Edge2[0], Dir[1]));
+		pack const Det = P::add(P::add(P::mul(Edge1[0], px), P::mul(Edge1[1], py)), P::mul(Edge1[2], pz));
+
+		pack const sx = P::sub(Orig[0], Vert0[0]);
+		pack const sy = P::sub(Orig[1], Vert0[1]);
+		pack const sz = P::sub(Orig[2], Vert0[2]);
+		pack const u = P::add(P::add(P::mul(sx, px), P::mul(sy, py)), P::mul(sz, pz));
+
+		// q = cross(dist, edge1)
+		pack const qx = P::sub(P::mul(sy, Edge1[2]), P::mul(Edge1[1], sz));
+		pack const qy = P::sub(P::mul(sz, Edge1[0]), P::mul(Edge1[2], sx));
+		pack const qz = P::sub(P::mul(sx, Edge1[1]), P::mul(Edge1[0], sy));
+		pack const v = P::add(P::add(P::mul(Dir[0], qx), P::mul(Dir[1], qy)), P::mul(Dir[2], qz));
+
+		// The bounds of intersectRayTriangle for both signs of the determinant
+		pack const Zero = P::set1(static_cast<T>(0));
+		pack const AbsDet = P::abs(Det);
+		pack const U = P::flipsign(u, Det);
+		pack const V = P::flipsign(v, Det);
+		typename P::mask const Inside = P::mask_and(
+			P::mask_and(P::ge(U, Zero), P::le(U, AbsDet)),
+			P::mask_and(P::ge(V, Zero), P::le(P::add(U, V), AbsDet)));
+
+		pack const InvDet = P::div(P::set1(static_cast<T>(1)), Det);
+		Distance = P::mul(P::add(P::add(P::mul(Edge2[0], qx), P::mul(Edge2[1], qy)), P::mul(Edge2[2], qz)), InvDet);
+		BaryX = P::mul(u, InvDet);
+		BaryY = P::mul(v, InvDet);
+		return P::mask_and(P::gt(AbsDet, Zero), Inside);
+	}
+
+	// Ray direction inverse for the slab tests. Null components are replaced by a tiny value
+	// so that a ray starting on a slab plane gives 0 rather than 0 * infinity.
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> bvh_inverse(vec<3, T, Q> const& Dir)
+	{
+		T const Tiny = static_cast<T>(1e-30);
+		vec<3, T, defaultp> Result;
+		for(length_t c = 0; c < 3; ++c)
+			Result[c] = static_cast<T>(1) / (glm::abs(Dir[c]) < Tiny ? (Dir[c] < static_cast<T>(0) ? -Tiny : Tiny) : Dir[c]);
+		return Result;
+	}
+
+	// Rounding of the slab distances may miss a triangle lying on a box face: the far distance
+	// is scaled up by a few ulps.
+	template<typename T>
+	GLM_FUNC_QUALIFIER T bvh_robust()
+	{
+		return static_cast<T>(1) + static_cast<T>(4) * std::numeric_limits<T>::epsilon();
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool bvh_intersect_box(bvh_node<T> const& Node, vec<3, T, Q> const& Orig, vec<3, T, defaultp> const& InvDir, T Distance)
+	{
+		T Near = static_cast<T>(0);
+		T Far = std::numeric_limits<T>::max();
+		for(length_t c = 0; c < 3; ++c)
+		{
+			T const t0 = (Node.Min[c] - Orig[c]) * InvDir[c];
+			T const t1 = (Node.Max[c] - Orig[c]) * InvDir[c];
+			Near = glm::max(Near, glm::min(t0, t1));
+			Far = glm::min(Far, glm::max(t0, t1));
+		}
+		return Near <= glm::min(Far * bvh_robust<T>(), Distance);
+	}
+
+	template<typename T, qualifier Q>
+	struct bvh_corners
+	{
+		vec<3, T, Q> const* Vertices;
+
+		GLM_FUNC_QUALIFIER vec<3, T, defaultp> operator()(std::size_t Triangle, std::size_t Corner) const
+		{
+			return vec<3, T, defaultp>(this->Vertices[Triangle * 3 + Corner]);
+		}
+	};
+
+	template<typename T, qualifier Q>
+	struct bvh_indexed_corners
+	{
+		vec<3, T, Q> const* Vertices;
+		uint32 const* Indices;
+
+		GLM_FUNC_QUALIFIER vec<3, T, defaultp> operator()(std::size_t Triangle, std::size_t Corner) const
+		{
+			return vec<3, T, defaultp>(this->Vertices[this->Indices[Triangle * 3 + Corner]]);
+		}
+	};
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T bvh_half_area(vec<3, T, defaultp> const& Min, vec<3, T, defaultp> const& Max)
+	{
+		vec<3, T, defaultp> const Extent(Max - Min);
+		return Extent.x * Extent.y + Extent.y * Extent.z + Extent.z * Extent.x;
+	}
+
+	template<typename T>
+	struct bvh_bin_less
+	{
+		vec<3, T, defaultp> const* Centroid;
+		length_t Axis;
+		T Min;
+		T Scale;
+		int Split;
+
+		GLM_FUNC_QUALIFIER int bin(uint32 Triangle) const
+		{
+			int const Bin = static_cast<int>((this->Centroid[Triangle][this->Axis] - this->Min) * this->Scale);
+			return Bin < bvh_bin_count - 1 ? Bin : bvh_bin_count - 1;
+		}
+
+		GLM_FUNC_QUALIFIER bool operator()(uint32 Triangle) const
+		{
+			return this->bin(Triangle) <= this->Split;
+		}
+	};
+
+	template<typename T>
+	struct bvh_centroid_less
+	{
+		vec<3, T, defaultp> const* Centroid;
+		length_t Axis;
+
+		GLM_FUNC_QUALIFIER bool operator()(uint32 a, uint32 b) const
+		{
+			return this->Centroid[a][this->Axis] < this->Centroid[b][this->Axis];
+		}
+	};
+
+	// Top down binned SAH build. Triangles are referenced by Order, which is partitioned in
+	// place so that each leaf covers a range of it. The members are recursive, hence not
+	// GLM_FUNC_QUALIFIER which may force inlining.
+	template<typename T>
+	struct bvh_builder
+	{
+		typedef vec<3, T, defaultp> vec_type;
+
+		std::vector<vec_type> Min;
+		std::vector<vec_type> Max;
+		std::vector<vec_type> Centroid;
+		std::vector<uint32> Order;
+
+		static void build_task(bvh_builder* Builder, std::size_t Begin, std::size_t End, std::size_t Depth, unsigned Threads, std::vector<bvh_node<T> >* Out)
+		{
+			Builder->build(Begin, End, Depth, Threads, *Out);
+		}
+
+		// Appends a subtree built in its own array
+		static void append(std::vector<bvh_node<T> >& Out, std::vector<bvh_node<T> > const& Subtree)
+		{
+			uint32 const Base = static_cast<uint32>(Out.size());
+			for(std::size_t i = 0; i < Subtree.size(); ++i)
+			{
+				Out.push_back(Subtree[i]);
+				if(Subtree[i].Count == 0)
+					Out.back().Offset += Base;
+			}
+		}
+
+		// Splits [Begin, End) with the cheapest binned SAH plane, returns End for a leaf
+		std::size_t split_sah(std::size_t Begin, std::size_t End, vec_type const& BoundsMin, vec_type const& BoundsMax, vec_type const& CentroidMin, vec_type const& CentroidMax, length_t& Axis)
+		{
+			std::size_t const Count = End - Begin;
+			T const Area = bvh_half_area(BoundsMin, BoundsMax);
+
+			T BestCost = std::numeric_limits<T>::max();
+			int BestSplit = -1;
+			bvh_bin_less<T> Best;
+			for(length_t a = 0; a < 3; ++a)
+			{
+				T const Extent = CentroidMax[a] - CentroidMin[a];
+				if(Extent <= static_cast<T>(0))
+					continue;
+
+				bvh_bin_less<T> Binning;
+				Binning.Centroid = &this->Centroid[0];
+				Binning.Axis = a;
+				Binning.Min = CentroidMin[a];
+				Binning.Scale = static_cast<T>(bvh_bin_count) / Extent;
+
+				std::size_t BinCount[bvh_bin_count];
+				vec_type BinMin[bvh_bin_count];
+				vec_type BinMax[bvh_bin_count];
+				for(int b = 0; b < bvh_bin_count; ++b)
+				{
+					BinCount[b] = 0;
+					BinMin[b] = vec_type(std::numeric_limits<T>::max());
+					BinMax[b] = vec_type(-std::numeric_limits<T>::max());
+				}
+				for(std::size_t i = Begin; i < End; ++i)
+				{
+					uint32 const Triangle = this->Order[i];
+					int const b = Binning.bin(Triangle);
+					++BinCount[b];
+					BinMin[b] = glm::min(BinMin[b], this->Min[Triangle]);
+					BinMax[b] = glm::max(BinMax[b], this->Max[Triangle]);
+				}
+
+				// Sweep from the right then from the left, the plane s separating bins [0, s] and [s + 1, bvh_bin_count)
+				T RightCost[bvh_bin_count];
+				std::size_t RightCount = 0;
+				vec_type RightMin(std::numeric_limits<T>::max());
+				vec_type RightMax(-std::numeric_limits<T>::max());
+				for(int b = bvh_bin_count - 1; b > 0; --b)
+				{
+					RightCount += BinCount[b];
+					RightMin = glm::min(RightMin, BinMin[b]);
+					RightMax = glm::max(RightMax, BinMax[b]);
+					RightCost[b - 1] = RightCount > 0 ? bvh_half_area(RightMin, RightMax) * static_cast<T>(RightCount) : static_cast<T>(0);
+				}
+
+				std::size_t LeftCount = 0;
+				vec_type LeftMin(std::numeric_limits<T>::max());
+				vec_type LeftMax(-std::numeric_limits<T>::max());
+				for(int s = 0; s < bvh_bin_count - 1; ++s)
+				{
+					LeftCount += BinCount[s];
+					LeftMin = glm::min(LeftMin, BinMin[s]);
+					LeftMax = glm::max(LeftMax, BinMax[s]);
+					if(LeftCount == 0 || LeftCount == Count)
+						continue;
+
+					T const Cost = bvh_half_area(LeftMin, LeftMax) * static_cast<T>(LeftCount) + RightCost[s];
+					if(Cost < BestCost)
+					{
+						BestCost = Cost;
+						BestSplit = s;
+						Best = Binning;
+					}
+				}
+			}
+
+			if(BestSplit < 0)
+				return End;
+
+			// Traversing a node costs about as much as testing a triangle
+			T const LeafCost = static_cast<T>(Count);
+			T const SplitCost = Area > static_cast<T>(0) ? static_cast<T>(1) + BestCost / Area : static_cast<T>(Count);
+			if(Count <= bvh_max_leaf && LeafCost <= SplitCost)
+				return End;
+
+			Best.Split = BestSplit;
+			Axis = Best.Axis;
+			return static_cast<std::size_t>(std::partition(this->Order.begin() + static_cast<std::ptrdiff_t>(Begin), this->Order.begin() + static_cast<std::ptrdiff_t>(End), Best) - this->Order.begin());
+		}
+
+		void build(std::size_t Begin, std::size_t End, std::size_t Depth, unsigned Threads, std::vector<bvh_node<T> >& Out)
+		{
+			vec_type BoundsMin(std::numeric_limits<T>::max());
+			vec_type BoundsMax(-std::numeric_limits<T>::max());
+			vec_type CentroidMin(std::numeric_limits<T>::max());
+			vec_type CentroidMax(-std::numeric_limits<T>::max());
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				uint32 const Triangle = this->Order[i];
+				BoundsMin = glm::min(BoundsMin, this->Min[Triangle]);
+				BoundsMax = glm::max(BoundsMax, this->Max[Triangle]);
+				CentroidMin = glm::min(CentroidMin, this->Centroid[Triangle]);
+				CentroidMax = glm::max(CentroidMax, this->Centroid[Triangle]);
+			}
+
+			std::size_t const Count = End - Begin;
+			length_t Axis = 0;
+			std::size_t Mid = End;
+			if(Count > 1 && Depth < bvh_max_sah_depth)
+				Mid = this->split_sah(Begin, End, BoundsMin, BoundsMax, CentroidMin, CentroidMax, Axis);
+
+			// Identical centroids, or too deep: split at the median of the widest axis
+			if(Mid == End && Count > bvh_max_leaf)
+			{
+				vec_type const Extent(CentroidMax - CentroidMin);
+				Axis = Extent.x >= Extent.y && Extent.x >= Extent.z ? 0 : (Extent.y >= Extent.z ? 1 : 2);
+				Mid = Begin + Count / 2;
+
+				bvh_centroid_less<T> Less;
+				Less.Centroid = &this->Centroid[0];
+				Less.Axis = Axis;
+				std::nth_element(this->Order.begin() + static_cast<std::ptrdiff_t>(Begin), this->Order.begin() + static_cast<std::ptrdiff_t>(Mid), this->Order.begin() + static_cast<std::ptrdiff_t>(End), Less);
+			}
+
+			// Boxes are padded by a few ulps: a ray parallel to an axis and lying on a face of a
+			// padded box can't hit the triangles it contains
+			vec_type const Padding(glm::max(glm::abs(BoundsMin), glm::abs(BoundsMax)) * (static_cast<T>(4) * std::numeric_limits<T>::epsilon()));
+
+			std::size_t const Index = Out.size();
+			bvh_node<T> Node;
+			Node.Min = BoundsMin - Padding;
+			Node.Max = BoundsMax + Padding;
+			Node.Offset = static_cast<uint32>(Begin);
+			Node.Count = static_cast<uint16>(Count);
+			Node.Axis = 0;
+			Out.push_back(Node);
+
+			if(Mid == End)
+				return;
+
+			Out[Index].Count = 0;
+			Out[Index].Axis = static_cast<uint16>(Axis);
+
+#			if GLM_HAS_CXX11_STL
+				if(Threads > 1 && Count >= bvh_parallel_triangles)
+				{
+					std::vector<bvh_node<T> > Left;
+					std::vector<bvh_node<T> > Right;
+					std::thread Worker(build_task, this, Begin, Mid, Depth + 1, Threads / 2, &Left);
+					this->build(Mid, End, Depth + 1, Threads - Threads / 2, Right);
+					Worker.join();
+
+					append(Out, Left);
+					Out[Index].Offset = static_cast<uint32>(Out.size());
+					append(Out, Right);
+					return;
+				}
+#			endif
+
+			this->build(Begin, Mid, Depth + 1, Threads, Out);
+			Out[Index].Offset = static_cast<uint32>(Out.size());
+			this->build(Mid, End, Depth + 1, Threads, Out);
+		}
+	};
+}//namespace detail
+
+	template<typename T>
+	uint32 const bvh<T>::none;
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER bvh<T>::bvh()
+	{}
+
+	template<typename T>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bvh<T>::build(vec<3, T, Q> const* vertices, std::size_t triangleCount, unsigned threads)
+	{
+		detail::bvh_corners<T, Q> Corners;
+		Corners.Vertices = vertices;
+		this->build_tree(Corners, triangleCount, threads);
+	}
+
+	template<typename T>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bvh<T>::build(vec<3, T, Q> const* vertices, uint32 const* indices, std::size_t triangleCount, unsigned threads)
+	{
+		detail::bvh_indexed_corners<T, Q> Corners;
+		Corners.Vertices = vertices;
+		Corners.Indices = indices;
+		this->build_tree(Corners, triangleCount, threads);
+	}
+
+	template<typename T>
+	template<typename Corners>
+	GLM_FUNC_QUALIFIER void bvh<T>::build_tree(Corners const& corners, std::size_t triangleCount, unsigned threads)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'bvh' only accept floating-point inputs");
+
+		this->Nodes.clear();
+		this->Triangles.clear();
+		if(triangleCount == 0)
+			return;
+
+		detail::bvh_builder<T> Builder;
+		Builder.Min.resize(triangleCount, vec<3, T, defaultp>(0));
+		Builder.Max.resize(triangleCount, vec<3, T, defaultp>(0));
+		Builder.Centroid.resize(triangleCount, vec<3, T, defaultp>(0));
+		Builder.Order.resize(triangleCount);
+		for(std::size_t i = 0; i < triangleCount; ++i)
+		{
+			vec<3, T, defaultp> const a(corners(i, 0));
+			vec<3, T, defaultp> const b(corners(i, 1));
+			vec<3, T, defaultp> const c(corners(i, 2));
+			Builder.Min[i] = glm::min(glm::min(a, b), c);
+			Builder.Max[i] = glm::max(glm::max(a, b), c);
+			Builder.Centroid[i] = (Builder.Min[i] + Builder.Max[i]) * static_cast<T>(0.5);
+			Builder.Order[i] = static_cast<uint32>(i);
+		}
+
+#		if GLM_HAS_CXX11_STL
+			if(threads == 0)
+				threads = std::thread::hardware_concurrency();
+#		endif
+		if(threads == 0)
+			threads = 1;
+
+		this->Nodes.reserve(triangleCount / 2);
+		Builder.build(0, triangleCount, 0, threads, this->Nodes);
+
+		// Triangles in leaf order, with padding so that full width loads stay in the arrays
+		this->Vert0.resize(triangleCount + detail::bvh_max_leaf);
+		this->Edge1.resize(triangleCount + detail::bvh_max_leaf);
+		this->Edge2.resize(triangleCount + detail::bvh_max_leaf);
+		this->Triangles.resize(triangleCount);
+		for(std::size_t i = 0; i < triangleCount; ++i)
+		{
+			uint32 const Triangle = Builder.Order[i];
+			vec<3, T, defaultp> const v0(corners(Triangle, 0));
+			this->Vert0.store(i, v0);
+			this->Edge1.store(i, corners(Triangle, 1) - v0);
+			this->Edge2.store(i, corners(Triangle, 2) - v0);
+			this->Triangles[i] = Triangle;
+		}
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER std::size_t bvh<T>::size() const
+	{
+		return this->Triangles.size();
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER std::size_t bvh<T>::node_count() const
+	{
+		return this->Nodes.size();
+	}
+
+	template<typename T>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER bool bvh<T>::intersect(vec<3, T, Q> const& orig, vec<3, T, Q> const& dir, vec<2, T, Q>& baryPosition, T& distance, uint32& triangle) const
+	{
+		typedef typename detail::bvh_native<T>::type pack;
+		std::size_t const Width = pack::width;
+
+		if(this->Nodes.empty())
+			return false;
+
+		vec<3, T, defaultp> const InvDir(detail::bvh_inverse(dir));
+		typename pack::type Orig[3];
+		typename pack::type Dir[3];
+		for(length_t c = 0; c < 3; ++c)
+		{
+			Orig[c] = pack::set1(orig[c]);
+			Dir[c] = pack::set1(dir[c]);
+		}
+
+		T Lanes[Width];
+		for(std::size_t k = 0; k < Width; ++k)
+			Lanes[k] = static_cast<T>(k);
+		typename pack::type const LaneIndex = pack::load(Lanes);
+		typename pack::type const Zero = pack::set1(static_cast<T>(0));
+
+		T Best = std::numeric_limits<T>::max();
+		T BestX = static_cast<T>(0);
+		T BestY = static_cast<T>(0);
+		std::size_t Hit = this->Triangles.size();
+
+		uint32 Stack[detail::bvh_stack_size];
+		std::size_t Top = 0;
+		uint32 Index = 0;
+		for(;;)
+		{
+			detail::bvh_node<T> const& Node = this->Nodes[Index];
+			if(detail::bvh_intersect_box(Node, orig, InvDir, Best))
+			{
+				if(Node.Count == 0)
+				{
+					// Visit the child on the side the ray comes from first
+					uint32 Near = Index + 1;
+					uint32 Far = Node.Offset;
+					if(dir[Node.Axis] < static_cast<T>(0))
+						std::swap(Near, Far);
+					Stack[Top++] = Far;
+					Index = Near;
+					continue;
+				}
+
+				std::size_t const First = Node.Offset;
+				std::size_t const Last = First + Node.Count;
+				for(std::size_t i = First; i < Last; i += Width)
+				{
+					typename pack::type Vert0[3];
+					typename pack::type Edge1[3];
+					typename pack::type Edge2[3];
+					for(length_t c = 0; c < 3; ++c)
+					{
+						Vert0[c] = pack::load(this->Vert0[c] + i);
+						Edge1[c] = pack::load(this->Edge1[c] + i);
+						Edge2[c] = pack::load(this->Edge2[c] + i);
+					}
+
+					typename pack::type Distance, BaryX, BaryY;
+					typename pack::mask Mask = detail::bvh_intersect_triangles<pack, T>(Orig, Dir, Vert0, Edge1, Edge2, Distance, BaryX, BaryY);
+					Mask = pack::mask_and(Mask, pack::mask_and(pack::ge(Distance, Zero), pack::lt(Distance, pack::set1(Best))));
+					Mask = pack::mask_and(Mask, pack::lt(LaneIndex, pack::set1(static_cast<T>(Last - i))));
+
+					int const Bits = pack::bits(Mask);
+					if(Bits == 0)
+						continue;
+
+					T Distances[Width];
+					T BaryXs[Width];
+					T BaryYs[Width];
+					pack::store(Distances, Distance);
+					pack::store(BaryXs, BaryX);
+					pack::store(BaryYs, BaryY);
+					for(std::size_t k = 0; k < Width; ++k)
+					{
+						if((Bits & (1 << k)) && Distances[k] < Best)
+						{
+							Best = Distances[k];
+							BestX = BaryXs[k];
+							BestY = BaryYs[k];
+							Hit = i + k;
+						}
+					}
+				}
+			}
+
+			if(Top == 0)
+				break;
+			Index = Stack[--Top];
+		}
+
+		if(Hit == this->Triangles.size())
+			return false;
+
+		baryPosition = vec<2, T, Q>(BestX, BestY);
+		distance = Best;
+		triangle = this->Triangles[Hit];
+		return true;
+	}
+
+	template<typename T>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bvh<T>::intersect(vec<3, T, Q> const* orig, vec<3, T, Q> const* dir, std::size_t count, bvh_hit<T>* hits) const
+	{
+		typedef typename detail::bvh_native<T>::type pack;
+		std::size_t const Width = pack::width;
+
+		typename pack::type const Zero = pack::set1(static_cast<T>(0));
+		typename pack::type const Robust = pack::set1(detail::bvh_robust<T>());
+
+		for(std::size_t First = 0; First < count; First += Width)
+		{
+			// The last packet repeats its last ray
+			std::size_t const Size = glm::min(Width, count - First);
+
+			typename pack::type Orig[3];
+			typename pack::type Dir[3];
+			typename pack::type InvDir[3];
+			{
+				T Components[3][3][Width];
+				for(std::size_t k = 0; k < Width; ++k)
+				{
+					std::size_t const Ray = First + glm::min(k, Size - 1);
+					vec<3, T, defaultp> const Inv(detail::bvh_inverse(dir[Ray]));
+					for(length_t c = 0; c < 3; ++c)
+					{
+						Components[0][c][k] = orig[Ray][c];
+						Components[1][c][k] = dir[Ray][c];
+						Components[2][c][k] = Inv[c];
+					}
+				}
+				for(length_t c = 0; c < 3; ++c)
+				{
+					Orig[c] = pack::load(Components[0][c]);
+					Dir[c] = pack::load(Components[1][c]);
+					InvDir[c] = pack::load(Components[2][c]);
+				}
+			}
+
+			typename pack::type Best = pack::set1(std::numeric_limits<T>::max());
+			typename pack::type BestX = Zero;
+			typename pack::type BestY = Zero;
+			uint32 Hit[Width];
+			for(std::size_t k = 0; k < Width; ++k)
+				Hit[k] = none;
+
+			uint32 Stack[detail::bvh_stack_size];
+			std::size_t Top = 0;
+			uint32 Index = 0;
+			while(!this->Nodes.empty())
+			{
+				detail::bvh_node<T> const& Node = this->Nodes[Index];
+
+				typename pack::type Near = Zero;
+				typename pack::type Far = pack::set1(std::numeric_limits<T>::max());
+				for(length_t c = 0; c < 3; ++c)
+				{
+					typename pack::type const t0 = pack::mul(pack::sub(pack::set1(Node.Min[c]), Orig[c]), InvDir[c]);
+					typename pack::type const t1 = pack::mul(pack::sub(pack::set1(Node.Max[c]), Orig[c]), InvDir[c]);
+					Near = pack::max(Near, pack::min(t0, t1));
+					Far = pack::min(Far, pack::max(t0, t1));
+				}
+
+				if(pack::bits(pack::le(Near, pack::min(pack::mul(Far, Robust), Best))) != 0)
+				{
+					if(Node.Count == 0)
+					{
+						// Packets are assumed coherent: order the children for the first ray
+						uint32 Nearest = Index + 1;
+						uint32 Farthest = Node.Offset;
+						if(dir[First][Node.Axis] < static_cast<T>(0))
+							std::swap(Nearest, Farthest);
+						Stack[Top++] = Farthest;
+						Index = Nearest;
+						continue;
+					}
+
+					for(std::size_t i = Node.Offset, Last = Node.Offset + Node.Count; i < Last; ++i)
+					{
+						typename pack::type Vert0[3];
+						typename pack::type Edge1[3];
+						typename pack::type Edge2[3];
+						for(length_t c = 0; c < 3; ++c)
+						{
+							Vert0[c] = pack::set1(this->Vert0[c][i]);
+							Edge1[c] = pack::set1(this->Edge1[c][i]);
+							Edge2[c] = pack::set1(this->Edge2[c][i]);
+						}
+
+						typename pack::type Distance, BaryX, BaryY;
+						typename pack::mask Mask = detail::bvh_intersect_triangles<pack, T>(Orig, Dir, Vert0, Edge1, Edge2, Distance, BaryX, BaryY);
+						Mask = pack::mask_and(Mask, pack::mask_and(pack::ge(Distance, Zero), pack::lt(Distance, Best)));
+
+						int const Bits = pack::bits(Mask);
+						if(Bits == 0)
+							continue;
+
+						Best = pack::select(Mask, Distance, Best);
+						BestX = pack::select(Mask, BaryX, BestX);
+						BestY = pack::select(Mask, BaryY, BestY);
+						for(std::size_t k = 0; k < Width; ++k)
+							if(Bits & (1 << k))
+								Hit[k] = this->Triangles[i];
+					}
+				}
+
+				if(Top == 0)
+					break;
+				Index = Stack[--Top];
+			}
+
+			T Distances[Width];
+			T BaryXs[Width];
+			T BaryYs[Width];
+			pack::store(Distances, Best);
+			pack::store(BaryXs, BestX);
+			pack::store(BaryYs, BestY);
+			for(std::size_t k = 0; k < Size; ++k)
+			{
+				bvh_hit<T>& Result = hits[First + k];
+				Result.baryPosition = vec<2, T, defaultp>(BaryXs[k], BaryYs[k]);
+				Result.distance = Distances[k];
+				Result.triangle = Hit[k];
+			}
+		}
+	}
+}//namespace glm
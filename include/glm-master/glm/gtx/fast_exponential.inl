@@ -133,4 +133,193 @@ namespace glm
 	{
 		return detail::functor1<vec, L, T, T, Q>::call(fastLog2, x);
 	}
+
+namespace detail
+{
+	// The GTX_vec_soa packs extended with the decomposition of normal floats used by the array
+	// fastLog: x = mantissa(x) * 2^exponent(x) with mantissa(x) in [1, 2). step returns 1 or 0
+	// like the scalar function of the same name. Like soa_avx512_f32, the AVX-512
+	// operations use the masked intrinsics.
+	template<typename T>
+	struct fast_exponential_scalar : public soa_scalar<T>
+	{
+		typedef T type;
+
+		GLM_FUNC_QUALIFIER static type step(type edge, type x) { return x < edge ? static_cast<T>(0) : static_cast<T>(1); }
+
+		// Bit manipulations of floats, the only type of the array functions, as frexp is a function call
+		GLM_FUNC_QUALIFIER static type exponent(type a) { return static_cast<T>(((floatBitsToInt(a) >> 23) & 0xFF) - 127); }
+		GLM_FUNC_QUALIFIER static type mantissa(type a) { return intBitsToFloat((floatBitsToInt(a) & 0x007FFFFF) | 0x3F800000); }
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	struct fast_exponential_avx512_f32 : public soa_avx512_f32
+	{
+		GLM_FUNC_QUALIFIER static type step(type edge, type x) { return _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(x, edge, _CMP_NLT_UQ), _mm512_set1_ps(1.0f)); }
+		GLM_FUNC_QUALIFIER static type exponent(type a) { return _mm512_mask_getexp_ps(a, 0xFFFF, a); }
+		GLM_FUNC_QUALIFIER static type mantissa(type a) { return _mm512_mask_getmant_ps(a, 0xFFFF, a, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero); }
+	};
+#	endif
+
+	// AVX has no 256 bits integer shifts: the biased exponent bits are converted as an integer
+	// to a float and scaled down instead, which SSE2 does the same way.
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	struct fast_exponential_avx_f32 : public soa_avx_f32
+	{
+		GLM_FUNC_QUALIFIER static type step(type edge, type x) { return _mm256_and_ps(_mm256_cmp_ps(x, edge, _CMP_NLT_UQ), _mm256_set1_ps(1.0f)); }
+
+		GLM_FUNC_QUALIFIER static type exponent(type a)
+		{
+			__m256 const Bits = _mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7F800000)));
+			return _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_castps_si256(Bits)), _mm256_set1_ps(1.0f / 8388608.0f)), _mm256_set1_ps(127.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static type mantissa(type a)
+		{
+			return _mm256_or_ps(_mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x007FFFFF))), _mm256_set1_ps(1.0f));
+		}
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	struct fast_exponential_sse2_f32 : public soa_sse2_f32
+	{
+		GLM_FUNC_QUALIFIER static type step(type edge, type x) { return _mm_and_ps(_mm_cmpnlt_ps(x, edge), _mm_set1_ps(1.0f)); }
+
+		GLM_FUNC_QUALIFIER static type exponent(type a)
+		{
+			__m128 const Bits = _mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x7F800000)));
+			return _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(Bits)), _mm_set1_ps(1.0f / 8388608.0f)), _mm_set1_ps(127.0f));
+		}
+
+		GLM_FUNC_QUALIFIER static type mantissa(type a)
+		{
+			return _mm_or_ps(_mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x007FFFFF))), _mm_set1_ps(1.0f));
+		}
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	struct fast_exponential_neon_f32 : public soa_neon_f32
+	{
+		GLM_FUNC_QUALIFIER static type step(type edge, type x) { return vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vdupq_n_f32(1.0f)), vcltq_f32(x, edge))); }
+
+		GLM_FUNC_QUALIFIER static type exponent(type a)
+		{
+			int32x4_t const Bits = vshrq_n_s32(vreinterpretq_s32_f32(a), 23);
+			return vcvtq_f32_s32(vsubq_s32(vandq_s32(Bits, vdupq_n_s32(0xFF)), vdupq_n_s32(127)));
+		}
+
+		GLM_FUNC_QUALIFIER static type mantissa(type a)
+		{
+			uint32x4_t const Bits = vandq_u32(vreinterpretq_u32_f32(a), vdupq_n_u32(0x007FFFFF));
+			return vreinterpretq_f32_u32(vorrq_u32(Bits, vreinterpretq_u32_f32(vdupq_n_f32(1.0f))));
+		}
+	};
+#	endif
+
+	// Widest pack available for T at compile time
+	template<typename T>
+	struct fast_exponential_native
+	{
+		typedef fast_exponential_scalar<T> type;
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	template<>
+	struct fast_exponential_native<float>
+	{
+		typedef fast_exponential_avx512_f32 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<>
+	struct fast_exponential_native<float>
+	{
+		typedef fast_exponential_avx_f32 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct fast_exponential_native<float>
+	{
+		typedef fast_exponential_sse2_f32 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<>
+	struct fast_exponential_native<float>
+	{
+		typedef fast_exponential_neon_f32 type;
+	};
+#	endif
+
+	// fastExp polynomial, in Horner form
+	struct fast_exp_kernel
+	{
+		template<typename P, typename T>
+		GLM_FUNC_QUALIFIER static typename P::type call(typename P::type x)
+		{
+			typename P::type Result = P::set1(T(0.008333333333));
+			Result = P::add(P::set1(T(0.041666667)), P::mul(x, Result));
+			Result = P::add(P::set1(T(0.1666666667)), P::mul(x, Result));
+			Result = P::add(P::set1(T(0.5)), P::mul(x, Result));
+			Result = P::add(P::set1(T(1)), P::mul(x, Result));
+			return P::add(P::set1(T(1)), P::mul(x, Result));
+		}
+	};
+
+	// log(x) = e * ln(2) + log(m) with m in [sqrt(2) / 2, sqrt(2)), where log(m) = 2 atanh(s) with
+	// s = (m - 1) / (m + 1) in [-0.172, 0.172] is the series 2 s (1 + s^2 / 3 + s^4 / 5 + ...)
+	struct fast_log_kernel
+	{
+		template<typename P, typename T>
+		GLM_FUNC_QUALIFIER static typename P::type call(typename P::type x)
+		{
+			typename P::type const One = P::set1(T(1));
+
+			// Halves the mantissas in [sqrt(2), 2) so that log(m) is small around x = 1
+			typename P::type const Mantissa = P::mantissa(x);
+			typename P::type const Adjust = P::step(P::set1(T(1.41421356237309504880)), Mantissa);
+			typename P::type const m = P::mul(Mantissa, P::sub(One, P::mul(Adjust, P::set1(T(0.5)))));
+			typename P::type const e = P::add(P::exponent(x), Adjust);
+
+			typename P::type const s = P::div(P::sub(m, One), P::add(m, One));
+			typename P::type const ss = P::mul(s, s);
+
+			typename P::type Series = P::set1(T(1) / T(9));
+			Series = P::add(P::set1(T(1) / T(7)), P::mul(ss, Series));
+			Series = P::add(P::set1(T(1) / T(5)), P::mul(ss, Series));
+			Series = P::add(P::set1(T(1) / T(3)), P::mul(ss, Series));
+			Series = P::add(One, P::mul(ss, Series));
+
+			typename P::type const Ln2 = P::set1(T(0.69314718055994530941723212145818));
+			return P::add(P::mul(e, Ln2), P::mul(P::add(s, s), Series));
+		}
+	};
+
+	// Like the GTX_vec_soa kernels, this processes [i, count) 'P::width' at a time and returns
+	// the index of the first value it didn't process. fast_exponential_scalar finishes the tail.
+	template<typename K, typename P, typename T>
+	GLM_FUNC_QUALIFIER std::size_t fast_exponential_array(T const* in, T* out, std::size_t i, std::size_t count)
+	{
+		for(; i + P::width <= count; i += P::width)
+			P::store(out + i, K::template call<P, T>(P::load(in + i)));
+		return i;
+	}
+
+	template<typename K>
+	GLM_FUNC_QUALIFIER void fast_exponential_batch(float const* in, float* out, std::size_t count)
+	{
+		std::size_t const i = fast_exponential_array<K, fast_exponential_native<float>::type>(in, out, 0, count);
+		fast_exponential_array<K, fast_exponential_scalar<float> >(in, out, i, count);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void fastExp(float const* in, float* out, std::size_t count)
+	{
+		detail::fast_exponential_batch<detail::fast_exp_kernel>(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void fastLog(float const* in, float* out, std::size_t count)
+	{
+		detail::fast_exponential_batch<detail::fast_log_kernel>(in, out, count);
+	}
 }//namespace glm
@@ -9,11 +9,21 @@
 /// Include <glm/gtx/fast_trigonometry.hpp> to use the features of this extension.
 ///
 /// Fast but less accurate implementations of trigonometric functions.
+///
+/// The float array overloads compute the same approximations 4 values at a time with SSE2 or
+/// NEON, 8 with AVX and 16 with AVX-512. Largest absolute errors measured against the C library:
+///
+/// | Function         | Domain                  | Max absolute error |
+/// |------------------|-------------------------|--------------------|
+/// | fastSin, fastCos | [-100, 100]             | 1.6e-5             |
+/// | fastAtan(x)      | [-1, 1]                 | 4.2e-2             |
+/// | fastAtan(y, x)   | abs(y) <= abs(x)        | 4.2e-2             |
 
 #pragma once
 
 // Dependency:
 #include "../gtc/constants.hpp"
+#include "vec_soa.hpp"
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #	error "GLM: GLM_GTX_fast_trigonometry is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
@@ -71,6 +81,24 @@ namespace glm
 	template<typename T>
 	GLM_FUNC_DECL T fastAtan(T angle);
 
+	/// Computes out[i] = fastSin(in[i]) for i in [0, count).
+	/// From GLM_GTX_fast_trigonometry extension.
+	GLM_FUNC_DISCARD_DECL void fastSin(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = fastCos(in[i]) for i in [0, count).
+	/// From GLM_GTX_fast_trigonometry extension.
+	GLM_FUNC_DISCARD_DECL void fastCos(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = fastAtan(in[i]) for i in [0, count).
+	/// Defined between -1 and 1.
+	/// From GLM_GTX_fast_trigonometry extension.
+	GLM_FUNC_DISCARD_DECL void fastAtan(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = fastAtan(y[i], x[i]) for i in [0, count).
+	/// Defined where abs(y[i]) <= abs(x[i]).
+	/// From GLM_GTX_fast_trigonometry extension.
+	GLM_FUNC_DISCARD_DECL void fastAtan(float const* y, float const* x, float* out, std::size_t count);
+
 	/// @}
 }//namespace glm
 
@@ -1,5 +1,9 @@
 /// @ref gtx_fast_trigonometry
 
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/common.h"
+#endif
+
 namespace glm{
 namespace detail
 {
@@ -139,4 +143,215 @@ namespace detail
 	{
 		return detail::functor1<vec, L, T, T, Q>::call(fastAtan, x);
 	}
+
+namespace detail
+{
+	// The GTX_vec_soa packs extended with the operations used by the array functions.
+	// select_less returns x where a < b and y elsewhere. Like soa_avx512_f32, the AVX-512
+	// operations use the masked intrinsics.
+	template<typename T>
+	struct fast_trigonometry_scalar : public soa_scalar<T>
+	{
+		typedef T type;
+
+		GLM_FUNC_QUALIFIER static type floor(type a) { return glm::floor(a); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return glm::abs(a); }
+		GLM_FUNC_QUALIFIER static type select_less(type a, type b, type x, type y) { return a < b ? x : y; }
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	struct fast_trigonometry_avx512_f32 : public soa_avx512_f32
+	{
+		GLM_FUNC_QUALIFIER static type floor(type a) { return _mm512_mask_roundscale_ps(a, 0xFFFF, a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return _mm512_abs_ps(a); }
+		GLM_FUNC_QUALIFIER static type select_less(type a, type b, type x, type y) { return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, b, _CMP_LT_OQ), y, x); }
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	struct fast_trigonometry_avx_f32 : public soa_avx_f32
+	{
+		GLM_FUNC_QUALIFIER static type floor(type a) { return _mm256_floor_ps(a); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return _mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF))); }
+		GLM_FUNC_QUALIFIER static type select_less(type a, type b, type x, type y) { return _mm256_blendv_ps(y, x, _mm256_cmp_ps(a, b, _CMP_LT_OQ)); }
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	struct fast_trigonometry_sse2_f32 : public soa_sse2_f32
+	{
+		GLM_FUNC_QUALIFIER static type floor(type a) { return glm_vec4_floor(a); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return glm_vec4_abs(a); }
+		GLM_FUNC_QUALIFIER static type select_less(type a, type b, type x, type y)
+		{
+			__m128 const Mask = _mm_cmplt_ps(a, b);
+			return _mm_or_ps(_mm_and_ps(Mask, x), _mm_andnot_ps(Mask, y));
+		}
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	struct fast_trigonometry_neon_f32 : public soa_neon_f32
+	{
+		GLM_FUNC_QUALIFIER static type floor(type a) { return vrndmq_f32(a); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return vabsq_f32(a); }
+		GLM_FUNC_QUALIFIER static type select_less(type a, type b, type x, type y) { return vbslq_f32(vcltq_f32(a, b), x, y); }
+	};
+#	endif
+
+	// Widest pack available for T at compile time
+	template<typename T>
+	struct fast_trigonometry_native
+	{
+		typedef fast_trigonometry_scalar<T> type;
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	template<>
+	struct fast_trigonometry_native<float>
+	{
+		typedef fast_trigonometry_avx512_f32 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<>
+	struct fast_trigonometry_native<float>
+	{
+		typedef fast_trigonometry_avx_f32 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct fast_trigonometry_native<float>
+	{
+		typedef fast_trigonometry_sse2_f32 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<>
+	struct fast_trigonometry_native<float>
+	{
+		typedef fast_trigonometry_neon_f32 type;
+	};
+#	endif
+
+	// fastCos without branches: cos_52s is even, so the angles pi - a and 2pi - a of the
+	// scalar code are replaced by a - pi and a - 2pi and a single polynomial is evaluated.
+	template<typename P, typename T>
+	GLM_FUNC_QUALIFIER typename P::type fast_cos_pack(typename P::type x)
+	{
+		typename P::type const Zero = P::set1(static_cast<T>(0));
+		typename P::type const HalfPi = P::set1(half_pi<T>());
+		typename P::type const ThreeHalfPi = P::set1(T(3) * half_pi<T>());
+		typename P::type const TwoPi = P::set1(two_pi<T>());
+
+		// wrapAngle
+		typename P::type const Angle = P::abs(P::sub(x, P::mul(TwoPi, P::floor(P::mul(x, P::set1(one_over_two_pi<T>()))))));
+
+		typename P::type const Offset = P::select_less(Angle, HalfPi, Zero, P::select_less(Angle, ThreeHalfPi, P::set1(pi<T>()), TwoPi));
+		typename P::type const Reduced = P::sub(Angle, Offset);
+		typename P::type const xx = P::mul(Reduced, Reduced);
+		typename P::type const Cos = P::add(P::set1(T(0.9999932946)), P::mul(xx, P::add(P::set1(T(-0.4999124376)), P::mul(xx, P::add(P::set1(T(0.0414877472)), P::mul(xx, P::set1(T(-0.0012712095))))))));
+
+		return P::select_less(Angle, HalfPi, Cos, P::select_less(Angle, ThreeHalfPi, P::sub(Zero, Cos), Cos));
+	}
+
+	template<typename P, typename T>
+	GLM_FUNC_QUALIFIER typename P::type fast_atan_pack(typename P::type x)
+	{
+		typename P::type const xx = P::mul(x, x);
+		typename P::type Result = P::set1(T(-0.0909090909));
+		Result = P::add(P::set1(T(0.111111111111)), P::mul(xx, Result));
+		Result = P::add(P::set1(T(-0.1428571429)), P::mul(xx, Result));
+		Result = P::add(P::set1(T(0.2)), P::mul(xx, Result));
+		Result = P::add(P::set1(T(-0.333333333333)), P::mul(xx, Result));
+		Result = P::add(P::set1(T(1)), P::mul(xx, Result));
+		return P::mul(x, Result);
+	}
+
+	template<typename P, typename T>
+	GLM_FUNC_QUALIFIER typename P::type fast_sign_pack(typename P::type x)
+	{
+		typename P::type const Zero = P::set1(static_cast<T>(0));
+		return P::select_less(Zero, x, P::set1(static_cast<T>(1)), P::select_less(x, Zero, P::set1(static_cast<T>(-1)), Zero));
+	}
+
+	struct fast_cos_kernel
+	{
+		template<typename P, typename T>
+		GLM_FUNC_QUALIFIER static typename P::type call(typename P::type x)
+		{
+			return fast_cos_pack<P, T>(x);
+		}
+	};
+
+	struct fast_sin_kernel
+	{
+		template<typename P, typename T>
+		GLM_FUNC_QUALIFIER static typename P::type call(typename P::type x)
+		{
+			return fast_cos_pack<P, T>(P::sub(P::set1(half_pi<T>()), x));
+		}
+	};
+
+	struct fast_atan_kernel
+	{
+		template<typename P, typename T>
+		GLM_FUNC_QUALIFIER static typename P::type call(typename P::type x)
+		{
+			return fast_atan_pack<P, T>(x);
+		}
+
+		template<typename P, typename T>
+		GLM_FUNC_QUALIFIER static typename P::type call(typename P::type y, typename P::type x)
+		{
+			typename P::type const Sign = P::mul(fast_sign_pack<P, T>(y), fast_sign_pack<P, T>(x));
+			return P::mul(P::abs(fast_atan_pack<P, T>(P::div(y, x))), Sign);
+		}
+	};
+
+	// Like the GTX_vec_soa kernels, these process [i, count) 'P::width' at a time and return
+	// the index of the first value they didn't process. fast_trigonometry_scalar finishes the tail.
+
+	template<typename K, typename P, typename T>
+	GLM_FUNC_QUALIFIER std::size_t fast_trigonometry_array(T const* in, T* out, std::size_t i, std::size_t count)
+	{
+		for(; i + P::width <= count; i += P::width)
+			P::store(out + i, K::template call<P, T>(P::load(in + i)));
+		return i;
+	}
+
+	template<typename K, typename P, typename T>
+	GLM_FUNC_QUALIFIER std::size_t fast_trigonometry_array(T const* a, T const* b, T* out, std::size_t i, std::size_t count)
+	{
+		for(; i + P::width <= count; i += P::width)
+			P::store(out + i, K::template call<P, T>(P::load(a + i), P::load(b + i)));
+		return i;
+	}
+
+	template<typename K>
+	GLM_FUNC_QUALIFIER void fast_trigonometry_batch(float const* in, float* out, std::size_t count)
+	{
+		std::size_t const i = fast_trigonometry_array<K, fast_trigonometry_native<float>::type>(in, out, 0, count);
+		fast_trigonometry_array<K, fast_trigonometry_scalar<float> >(in, out, i, count);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void fastCos(float const* in, float* out, std::size_t count)
+	{
+		detail::fast_trigonometry_batch<detail::fast_cos_kernel>(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void fastSin(float const* in, float* out, std::size_t count)
+	{
+		detail::fast_trigonometry_batch<detail::fast_sin_kernel>(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void fastAtan(float const* in, float* out, std::size_t count)
+	{
+		detail::fast_trigonometry_batch<detail::fast_atan_kernel>(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void fastAtan(float const* y, float const* x, float* out, std::size_t count)
+	{
+		std::size_t const i = detail::fast_trigonometry_array<detail::fast_atan_kernel, detail::fast_trigonometry_native<float>::type>(y, x, out, 0, count);
+		detail::fast_trigonometry_array<detail::fast_atan_kernel, detail::fast_trigonometry_scalar<float> >(y, x, out, i, count);
+	}
 }//namespace glm
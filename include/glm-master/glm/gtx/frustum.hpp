@@ -0,0 +1,74 @@
+/// @ref gtx_frustum
+/// @file glm/gtx/frustum.hpp
+///
+/// @see core (dependence)
+/// @see gtx_vec_soa (dependence)
+///
+/// @defgroup gtx_frustum GLM_GTX_frustum
+/// @ingroup gtx
+///
+/// Include <glm/gtx/frustum.hpp> to use the features of this extension.
+///
+/// Frustum planes of view-projection matrices and culling of bounding volume arrays.
+/// The bounding volumes are stored as structure of arrays and tested 4 (SSE2, NEON, AVX
+/// doubles) or 8 (AVX floats) at a time against the 6 planes. The indices of the visible
+/// volumes are written in increasing order to a compacted list.
+
+#pragma once
+
+// Dependencies:
+#include "../glm.hpp"
+#include "vec_soa.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_frustum is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_frustum extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_frustum
+	/// @{
+
+	/// Extracts the planes of the frustum of a view-projection matrix whose clip space depth
+	/// is [0, 1]: left, right, bottom, top, near and far, in that order.
+	/// A point p is on the inner side of the plane P when dot(vec3(P), p) + P.w >= 0.
+	/// Planes are normalized, P.w + dot(vec3(P), p) being the distance of p to the plane.
+	/// @see gtx_frustum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void frustumPlanesZO(mat<4, 4, T, Q> const& viewProjection, vec<4, T, Q> planes[6]);
+
+	/// Extracts the planes of the frustum of a view-projection matrix whose clip space depth
+	/// is [-1, 1]: left, right, bottom, top, near and far, in that order.
+	/// A point p is on the inner side of the plane P when dot(vec3(P), p) + P.w >= 0.
+	/// Planes are normalized, P.w + dot(vec3(P), p) being the distance of p to the plane.
+	/// @see gtx_frustum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void frustumPlanesNO(mat<4, 4, T, Q> const& viewProjection, vec<4, T, Q> planes[6]);
+
+	/// Extracts the planes of the frustum of a view-projection matrix, with the clip space
+	/// depth of GLM_FORCE_DEPTH_ZERO_TO_ONE.
+	/// @see gtx_frustum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void frustumPlanes(mat<4, 4, T, Q> const& viewProjection, vec<4, T, Q> planes[6]);
+
+	/// Writes the index of each box (min[i], max[i]) that isn't entirely on the outer side of
+	/// one of the planes to 'visible', in increasing order, and returns their number.
+	/// Boxes crossing a plane are visible. 'visible' must have room for min.size() indices.
+	/// @see gtx_frustum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t frustumCullBoxes(vec<4, T, Q> const planes[6], vec_soa<3, T> const& min, vec_soa<3, T> const& max, uint32* visible);
+
+	/// Writes the index of each sphere (center[i], radius[i]) that isn't entirely on the outer
+	/// side of one of the planes to 'visible', in increasing order, and returns their number.
+	/// Planes must be normalized, spheres crossing a plane are visible. 'visible' must have
+	/// room for center.size() indices.
+	/// @see gtx_frustum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t frustumCullSpheres(vec<4, T, Q> const planes[6], vec_soa<3, T> const& center, T const* radius, uint32* visible);
+
+	/// @}
+}//namespace glm
+
+#include "frustum.inl"
@@ -0,0 +1,231 @@
+/// @ref gtx_frustum
+
+namespace glm{
+namespace detail
+{
+	// The GTX_vec_soa packs extended with nonnegative(), which gathers one bit per lane
+	// holding a value greater or equal to zero.
+	template<typename T>
+	struct frustum_scalar : public soa_scalar<T>
+	{
+		GLM_FUNC_QUALIFIER static int nonnegative(T a) { return a >= static_cast<T>(0) ? 1 : 0; }
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	struct frustum_avx_f32 : public soa_avx_f32
+	{
+		GLM_FUNC_QUALIFIER static int nonnegative(type a) { return _mm256_movemask_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GE_OQ)); }
+	};
+
+	struct frustum_avx_f64 : public soa_avx_f64
+	{
+		GLM_FUNC_QUALIFIER static int nonnegative(type a) { return _mm256_movemask_pd(_mm256_cmp_pd(a, _mm256_setzero_pd(), _CMP_GE_OQ)); }
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	struct frustum_sse2_f32 : public soa_sse2_f32
+	{
+		GLM_FUNC_QUALIFIER static int nonnegative(type a) { return _mm_movemask_ps(_mm_cmpge_ps(a, _mm_setzero_ps())); }
+	};
+
+	struct frustum_sse2_f64 : public soa_sse2_f64
+	{
+		GLM_FUNC_QUALIFIER static int nonnegative(type a) { return _mm_movemask_pd(_mm_cmpge_pd(a, _mm_setzero_pd())); }
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	struct frustum_neon_f32 : public soa_neon_f32
+	{
+		GLM_FUNC_QUALIFIER static int nonnegative(type a)
+		{
+			static int32 const Shift[4] = {0, 1, 2, 3};
+			return static_cast<int>(vaddvq_u32(vshlq_u32(vshrq_n_u32(vcgeq_f32(a, vdupq_n_f32(0.0f)), 31), vld1q_s32(Shift))));
+		}
+	};
+#	endif
+
+	// Widest frustum pack available for T at compile time
+	template<typename T>
+	struct frustum_native
+	{
+		typedef frustum_scalar<T> type;
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<>
+	struct frustum_native<float>
+	{
+		typedef frustum_avx_f32 type;
+	};
+
+	template<>
+	struct frustum_native<double>
+	{
+		typedef frustum_avx_f64 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct frustum_native<float>
+	{
+		typedef frustum_sse2_f32 type;
+	};
+
+	template<>
+	struct frustum_native<double>
+	{
+		typedef frustum_sse2_f64 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<>
+	struct frustum_native<float>
+	{
+		typedef frustum_neon_f32 type;
+	};
+#	endif
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<4, T, Q> frustum_row(mat<4, 4, T, Q> const& m, length_t i)
+	{
+		return vec<4, T, Q>(m[0][i], m[1][i], m[2][i], m[3][i]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<4, T, Q> frustum_normalize(vec<4, T, Q> const& Plane)
+	{
+		return Plane / length(vec<3, T, Q>(Plane));
+	}
+
+	// dot(vec3(Plane), Point[i]) + Plane.w of P::width points
+	template<typename P, typename T>
+	GLM_FUNC_QUALIFIER typename P::type frustum_distance(typename P::type const Plane[4], T const* const Point[3], std::size_t i)
+	{
+		return P::add(P::add(P::add(P::mul(P::load(Point[0] + i), Plane[0]), P::mul(P::load(Point[1] + i), Plane[1])), P::mul(P::load(Point[2] + i), Plane[2])), Plane[3]);
+	}
+
+	// Appends the indices of the lanes set in Bits. Every lane is written, the count only
+	// advancing on visible lanes, which avoids a branch per volume.
+	GLM_FUNC_QUALIFIER std::size_t frustum_compact(int Bits, std::size_t i, std::size_t Width, uint32* Visible, std::size_t Count)
+	{
+		for(std::size_t k = 0; k < Width; ++k)
+		{
+			Visible[Count] = static_cast<uint32>(i + k);
+			Count += static_cast<std::size_t>((Bits >> k) & 1);
+		}
+		return Count;
+	}
+
+	// As the GTX_vec_soa kernels, each kernel processes the volumes [i, count) 'P::width' at a
+	// time and returns the index of the first volume it didn't process.
+
+	template<typename P, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t frustum_cull_boxes(vec<4, T, Q> const* Planes, T const* const Min[3], T const* const Max[3], std::size_t i, std::size_t count, uint32* Visible, std::size_t& VisibleCount)
+	{
+		// A box is on the outer side of a plane when its corner the farthest along the plane
+		// normal is
+		typename P::type Plane[6][4];
+		T const* Corner[6][3];
+		for(length_t p = 0; p < 6; ++p)
+		{
+			for(length_t c = 0; c < 4; ++c)
+				Plane[p][c] = P::set1(Planes[p][c]);
+			for(length_t c = 0; c < 3; ++c)
+				Corner[p][c] = Planes[p][c] < static_cast<T>(0) ? Min[c] : Max[c];
+		}
+
+		for(; i + P::width <= count; i += P::width)
+		{
+			typename P::type Distance = frustum_distance<P, T>(Plane[0], Corner[0], i);
+			for(length_t p = 1; p < 6; ++p)
+				Distance = P::min(Distance, frustum_distance<P, T>(Plane[p], Corner[p], i));
+			VisibleCount = frustum_compact(P::nonnegative(Distance), i, P::width, Visible, VisibleCount);
+		}
+		return i;
+	}
+
+	template<typename P, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t frustum_cull_spheres(vec<4, T, Q> const* Planes, T const* const Center[3], T const* Radius, std::size_t i, std::size_t count, uint32* Visible, std::size_t& VisibleCount)
+	{
+		typename P::type Plane[6][4];
+		for(length_t p = 0; p < 6; ++p)
+			for(length_t c = 0; c < 4; ++c)
+				Plane[p][c] = P::set1(Planes[p][c]);
+
+		for(; i + P::width <= count; i += P::width)
+		{
+			typename P::type Distance = frustum_distance<P, T>(Plane[0], Center, i);
+			for(length_t p = 1; p < 6; ++p)
+				Distance = P::min(Distance, frustum_distance<P, T>(Plane[p], Center, i));
+			VisibleCount = frustum_compact(P::nonnegative(P::add(Distance, P::load(Radius + i))), i, P::width, Visible, VisibleCount);
+		}
+		return i;
+	}
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanesZO(mat<4, 4, T, Q> const& viewProjection, vec<4, T, Q> planes[6])
+	{
+		// Gribb and Hartmann: -w <= x <= w, -w <= y <= w and 0 <= z <= w in clip space
+		vec<4, T, Q> const Row0(detail::frustum_row(viewProjection, 0));
+		vec<4, T, Q> const Row1(detail::frustum_row(viewProjection, 1));
+		vec<4, T, Q> const Row2(detail::frustum_row(viewProjection, 2));
+		vec<4, T, Q> const Row3(detail::frustum_row(viewProjection, 3));
+
+		planes[0] = detail::frustum_normalize(Row3 + Row0);
+		planes[1] = detail::frustum_normalize(Row3 - Row0);
+		planes[2] = detail::frustum_normalize(Row3 + Row1);
+		planes[3] = detail::frustum_normalize(Row3 - Row1);
+		planes[4] = detail::frustum_normalize(Row2);
+		planes[5] = detail::frustum_normalize(Row3 - Row2);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanesNO(mat<4, 4, T, Q> const& viewProjection, vec<4, T, Q> planes[6])
+	{
+		// Same as frustumPlanesZO() with -w <= z <= w
+		frustumPlanesZO(viewProjection, planes);
+		planes[4] = detail::frustum_normalize(detail::frustum_row(viewProjection, 3) + detail::frustum_row(viewProjection, 2));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanes(mat<4, 4, T, Q> const& viewProjection, vec<4, T, Q> planes[6])
+	{
+#		if GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT
+			frustumPlanesZO(viewProjection, planes);
+#		else
+			frustumPlanesNO(viewProjection, planes);
+#		endif
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t frustumCullBoxes(vec<4, T, Q> const planes[6], vec_soa<3, T> const& min, vec_soa<3, T> const& max, uint32* visible)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'frustumCullBoxes' only accept floating-point inputs");
+		assert(min.size() == max.size());
+
+		T const* Min[3];
+		T const* Max[3];
+		detail::soa_components(min, Min);
+		detail::soa_components(max, Max);
+
+		std::size_t Count = 0;
+		std::size_t const i = detail::frustum_cull_boxes<typename detail::frustum_native<T>::type, T, Q>(planes, Min, Max, 0, min.size(), visible, Count);
+		detail::frustum_cull_boxes<detail::frustum_scalar<T>, T, Q>(planes, Min, Max, i, min.size(), visible, Count);
+		return Count;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t frustumCullSpheres(vec<4, T, Q> const planes[6], vec_soa<3, T> const& center, T const* radius, uint32* visible)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'frustumCullSpheres' only accept floating-point inputs");
+
+		T const* Center[3];
+		detail::soa_components(center, Center);
+
+		std::size_t Count = 0;
+		std::size_t const i = detail::frustum_cull_spheres<typename detail::frustum_native<T>::type, T, Q>(planes, Center, radius, 0, center.size(), visible, Count);
+		detail::frustum_cull_spheres<detail::frustum_scalar<T>, T, Q>(planes, Center, radius, i, center.size(), visible, Count);
+		return Count;
+	}
+}//namespace glm
@@ -0,0 +1,69 @@
+/// @ref gtx_noise_batch
+/// @file glm/gtx/noise_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtc_noise (dependence)
+/// @see gtx_vec_soa (dependence)
+///
+/// @defgroup gtx_noise_batch GLM_GTX_noise_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/noise_batch.hpp> to use the features of this extension.
+///
+/// Evaluate 2D and 3D Perlin and simplex noise over arrays of points and regular grids.
+/// The points are processed 4 at a time with SSE2 or NEON and 8 at a time with AVX, using
+/// the same operations in the same order as the GTC_noise functions: float results match
+/// them up to floating point contraction and the sign of zeros.
+/// Each function sums fractal Brownian motion octaves: octave o is sampled at the position
+/// scaled by lacunarity^o and weighted by gain^o. One octave gives the plain noise.
+
+#pragma once
+
+// Dependencies:
+#include "../glm.hpp"
+#include "../gtc/noise.hpp"
+#include "vec_soa.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_noise_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_noise_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_noise_batch
+	/// @{
+
+	/// Computes out[i] = sum(gain^o * perlin(in[i] * lacunarity^o)) for i in [0, count) and o in [0, octaves).
+	/// L must be 2 or 3. Only float values are computed with SIMD instructions.
+	/// @see gtx_noise_batch
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlin(vec<L, T, Q> const* in, T* out, std::size_t count, int octaves = 1, T lacunarity = static_cast<T>(2), T gain = static_cast<T>(0.5));
+
+	/// Computes out[i] = sum(gain^o * simplex(in[i] * lacunarity^o)) for i in [0, count) and o in [0, octaves).
+	/// L must be 2 or 3. Only float values are computed with SIMD instructions.
+	/// @see gtx_noise_batch
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void simplex(vec<L, T, Q> const* in, T* out, std::size_t count, int octaves = 1, T lacunarity = static_cast<T>(2), T gain = static_cast<T>(0.5));
+
+	/// Evaluates perlin fractal noise at the points origin + vec(x, y[, z]) * step of a size.x by size.y[ by size.z] grid.
+	/// The result for a point is stored at out[x + size.x * (y + size.y * z)].
+	/// Rows are split in contiguous bands between 'threads' threads, 0 meaning one per hardware thread.
+	/// Without C++11 STL support, the grid is computed on the calling thread.
+	/// @see gtx_noise_batch
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlinGrid(vec<L, T, Q> const& origin, vec<L, T, Q> const& step, vec<L, int, Q> const& size, T* out, int octaves = 1, T lacunarity = static_cast<T>(2), T gain = static_cast<T>(0.5), unsigned threads = 1);
+
+	/// Evaluates simplex fractal noise at the points origin + vec(x, y[, z]) * step of a size.x by size.y[ by size.z] grid.
+	/// The result for a point is stored at out[x + size.x * (y + size.y * z)].
+	/// Rows are split in contiguous bands between 'threads' threads, 0 meaning one per hardware thread.
+	/// Without C++11 STL support, the grid is computed on the calling thread.
+	/// @see gtx_noise_batch
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void simplexGrid(vec<L, T, Q> const& origin, vec<L, T, Q> const& step, vec<L, int, Q> const& size, T* out, int octaves = 1, T lacunarity = static_cast<T>(2), T gain = static_cast<T>(0.5), unsigned threads = 1);
+
+	/// @}
+}//namespace glm
+
+#include "noise_batch.inl"
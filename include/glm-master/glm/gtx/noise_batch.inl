@@ -0,0 +1,577 @@
+/// @ref gtx_noise_batch
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/common.h"
+#endif
+
+#if GLM_HAS_CXX11_STL
+#	include <thread>
+#	include <vector>
+#endif
+
+namespace glm{
+namespace detail
+{
+	// The GTX_vec_soa packs extended with the operations used by the noise functions.
+	// step and greater return 1 or 0 like the scalar functions of the same name.
+	template<typename T>
+	struct noise_scalar : public soa_scalar<T>
+	{
+		typedef T type;
+
+		GLM_FUNC_QUALIFIER static type floor(type a) { return glm::floor(a); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return glm::abs(a); }
+		GLM_FUNC_QUALIFIER static type step(type edge, type x) { return x < edge ? static_cast<T>(0) : static_cast<T>(1); }
+		GLM_FUNC_QUALIFIER static type greater(type a, type b) { return a > b ? static_cast<T>(1) : static_cast<T>(0); }
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	struct noise_avx_f32 : public soa_avx_f32
+	{
+		GLM_FUNC_QUALIFIER static type floor(type a) { return _mm256_floor_ps(a); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return _mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF))); }
+		GLM_FUNC_QUALIFIER static type step(type edge, type x) { return _mm256_and_ps(_mm256_cmp_ps(x, edge, _CMP_NLT_UQ), _mm256_set1_ps(1.0f)); }
+		GLM_FUNC_QUALIFIER static type greater(type a, type b) { return _mm256_and_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ), _mm256_set1_ps(1.0f)); }
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	struct noise_sse2_f32 : public soa_sse2_f32
+	{
+		GLM_FUNC_QUALIFIER static type floor(type a) { return glm_vec4_floor(a); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return glm_vec4_abs(a); }
+		GLM_FUNC_QUALIFIER static type step(type edge, type x) { return _mm_and_ps(_mm_cmpnlt_ps(x, edge), _mm_set1_ps(1.0f)); }
+		GLM_FUNC_QUALIFIER static type greater(type a, type b) { return _mm_and_ps(_mm_cmpgt_ps(a, b), _mm_set1_ps(1.0f)); }
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	struct noise_neon_f32 : public soa_neon_f32
+	{
+		GLM_FUNC_QUALIFIER static type floor(type a) { return vrndmq_f32(a); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return vabsq_f32(a); }
+		GLM_FUNC_QUALIFIER static type step(type edge, type x) { return vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vdupq_n_f32(1.0f)), vcltq_f32(x, edge))); }
+		GLM_FUNC_QUALIFIER static type greater(type a, type b) { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(vdupq_n_f32(1.0f)), vcgtq_f32(a, b))); }
+	};
+#	endif
+
+	// Widest noise pack available for T at compile time
+	template<typename T>
+	struct noise_native
+	{
+		typedef noise_scalar<T> type;
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<>
+	struct noise_native<float>
+	{
+		typedef noise_avx_f32 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct noise_native<float>
+	{
+		typedef noise_sse2_f32 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<>
+	struct noise_native<float>
+	{
+		typedef noise_neon_f32 type;
+	};
+#	endif
+
+	// Pack versions of the detail/_noise.hpp helpers, each lane computed like the scalar code
+
+	template<typename P, typename T>
+	GLM_FUNC_QUALIFIER typename P::type noise_fract(typename P::type x)
+	{
+		return P::sub(x, P::floor(x));
+	}
+
+	template<typename P, typename T>
+	GLM_FUNC_QUALIFIER typename P::type noise_mod(typename P::type x, T y)
+	{
+		typename P::type const Y = P::set1(y);
+		return P::sub(x, P::mul(Y, P::floor(P::div(x, Y))));
+	}
+
+	template<typename P, typename T>
+	GLM_FUNC_QUALIFIER typename P::type noise_mod289(typename P::type x)
+	{
+		typename P::type const Floor = P::floor(P::mul(x, P::set1(static_cast<T>(1.0) / static_cast<T>(289.0))));
+		return P::sub(x, P::mul(Floor, P::set1(static_cast<T>(289.0))));
+	}
+
+	template<typename P, typename T>
+	GLM_FUNC_QUALIFIER typename P::type noise_permute(typename P::type x)
+	{
+		return noise_mod289<P, T>(P::mul(P::add(P::mul(x, P::set1(static_cast<T>(34))), P::set1(static_cast<T>(1))), x));
+	}
+
+	template<typename P, typename T>
+	GLM_FUNC_QUALIFIER typename P::type noise_taylorInvSqrt(typename P::type r)
+	{
+		return P::sub(P::set1(static_cast<T>(1.79284291400159)), P::mul(P::set1(static_cast<T>(0.85373472095314)), r));
+	}
+
+	template<typename P, typename T>
+	GLM_FUNC_QUALIFIER typename P::type noise_fade(typename P::type t)
+	{
+		typename P::type const Cube = P::mul(P::mul(t, t), t);
+		typename P::type const Poly = P::sub(P::mul(t, P::set1(static_cast<T>(6))), P::set1(static_cast<T>(15)));
+		return P::mul(Cube, P::add(P::mul(t, Poly), P::set1(static_cast<T>(10))));
+	}
+
+	template<typename P, typename T>
+	GLM_FUNC_QUALIFIER typename P::type noise_mix(typename P::type x, typename P::type y, typename P::type a)
+	{
+		return P::add(P::mul(x, P::sub(P::set1(static_cast<T>(1)), a)), P::mul(y, a));
+	}
+
+	template<length_t L>
+	struct noise_perlin;
+
+	template<>
+	struct noise_perlin<2>
+	{
+		// Normalized gradient of the lattice corner hashed to i, dotted with the offset (fx, fy)
+		template<typename P, typename T>
+		GLM_FUNC_QUALIFIER static typename P::type corner(typename P::type i, typename P::type fx, typename P::type fy)
+		{
+			typename P::type const Half = P::set1(static_cast<T>(0.5));
+
+			typename P::type gx = P::sub(P::mul(P::set1(static_cast<T>(2)), noise_fract<P, T>(P::div(i, P::set1(static_cast<T>(41))))), P::set1(static_cast<T>(1)));
+			typename P::type gy = P::sub(P::abs(gx), Half);
+			gx = P::sub(gx, P::floor(P::add(gx, Half)));
+
+			typename P::type const Norm = noise_taylorInvSqrt<P, T>(P::add(P::mul(gx, gx), P::mul(gy, gy)));
+			return P::add(P::mul(P::mul(gx, Norm), fx), P::mul(P::mul(gy, Norm), fy));
+		}
+
+		template<typename P, typename T>
+		GLM_FUNC_QUALIFIER static typename P::type call(typename P::type const* Position)
+		{
+			typename P::type const One = P::set1(static_cast<T>(1));
+
+			typename P::type const FloorX = P::floor(Position[0]);
+			typename P::type const FloorY = P::floor(Position[1]);
+			typename P::type const ix0 = noise_mod<P, T>(FloorX, static_cast<T>(289));
+			typename P::type const iy0 = noise_mod<P, T>(FloorY, static_cast<T>(289));
+			typename P::type const ix1 = noise_mod<P, T>(P::add(FloorX, One), static_cast<T>(289));
+			typename P::type const iy1 = noise_mod<P, T>(P::add(FloorY, One), static_cast<T>(289));
+			typename P::type const fx0 = P::sub(Position[0], FloorX);
+			typename P::type const fy0 = P::sub(Position[1], FloorY);
+			typename P::type const fx1 = P::sub(fx0, One);
+			typename P::type const fy1 = P::sub(fy0, One);
+
+			typename P::type const px0 = noise_permute<P, T>(ix0);
+			typename P::type const px1 = noise_permute<P, T>(ix1);
+
+			typename P::type const n00 = corner<P, T>(noise_permute<P, T>(P::add(px0, iy0)), fx0, fy0);
+			typename P::type const n10 = corner<P, T>(noise_permute<P, T>(P::add(px1, iy0)), fx1, fy0);
+			typename P::type const n01 = corner<P, T>(noise_permute<P, T>(P::add(px0, iy1)), fx0, fy1);
+			typename P::type const n11 = corner<P, T>(noise_permute<P, T>(P::add(px1, iy1)), fx1, fy1);
+
+			typename P::type const FadeX = noise_fade<P, T>(fx0);
+			typename P::type const FadeY = noise_fade<P, T>(fy0);
+			typename P::type const nx0 = noise_mix<P, T>(n00, n10, FadeX);
+			typename P::type const nx1 = noise_mix<P, T>(n01, n11, FadeX);
+			return P::mul(P::set1(static_cast<T>(2.3)), noise_mix<P, T>(nx0, nx1, FadeY));
+		}
+	};
+
+	template<>
+	struct noise_perlin<3>
+	{
+		// Normalized gradient of the lattice corner hashed to i, dotted with the offset (fx, fy, fz)
+		template<typename P, typename T>
+		GLM_FUNC_QUALIFIER static typename P::type corner(typename P::type i, typename P::type fx, typename P::type fy, typename P::type fz)
+		{
+			typename P::type const Zero = P::set1(static_cast<T>(0));
+			typename P::type const Half = P::set1(static_cast<T>(0.5));
+			typename P::type const Seventh = P::set1(static_cast<T>(1.0 / 7.0));
+
+			typename P::type gx = P::mul(i, Seventh);
+			typename P::type gy = P::sub(noise_fract<P, T>(P::mul(P::floor(gx), Seventh)), Half);
+			gx = noise_fract<P, T>(gx);
+			typename P::type const gz = P::sub(P::sub(Half, P::abs(gx)), P::abs(gy));
+			typename P::type const sz = P::step(gz, Zero);
+			gx = P::sub(gx, P::mul(sz, P::sub(P::step(Zero, gx), Half)));
+			gy = P::sub(gy, P::mul(sz, P::sub(P::step(Zero, gy), Half)));
+
+			typename P::type const Norm = noise_taylorInvSqrt<P, T>(P::add(P::add(P::mul(gx, gx), P::mul(gy, gy)), P::mul(gz, gz)));
+			return P::add(P::add(P::mul(P::mul(gx, Norm), fx), P::mul(P::mul(gy, Norm), fy)), P::mul(P::mul(gz, Norm), fz));
+		}
+
+		template<typename P, typename T>
+		GLM_FUNC_QUALIFIER static typename P::type call(typename P::type const* Position)
+		{
+			typename P::type const One = P::set1(static_cast<T>(1));
+
+			typename P::type const FloorX = P::floor(Position[0]);
+			typename P::type const FloorY = P::floor(Position[1]);
+			typename P::type const FloorZ = P::floor(Position[2]);
+			typename P::type const ix0 = noise_mod289<P, T>(FloorX);
+			typename P::type const iy0 = noise_mod289<P, T>(FloorY);
+			typename P::type const iz0 = noise_mod289<P, T>(FloorZ);
+			typename P::type const ix1 = noise_mod289<P, T>(P::add(FloorX, One));
+			typename P::type const iy1 = noise_mod289<P, T>(P::add(FloorY, One));
+			typename P::type const iz1 = noise_mod289<P, T>(P::add(FloorZ, One));
+			typename P::type const fx0 = P::sub(Position[0], FloorX);
+			typename P::type const fy0 = P::sub(Position[1], FloorY);
+			typename P::type const fz0 = P::sub(Position[2], FloorZ);
+			typename P::type const fx1 = P::sub(fx0, One);
+			typename P::type const fy1 = P::sub(fy0, One);
+			typename P::type const fz1 = P::sub(fz0, One);
+
+			typename P::type const px0 = noise_permute<P, T>(ix0);
+			typename P::type const px1 = noise_permute<P, T>(ix1);
+			typename P::type const ixy00 = noise_permute<P, T>(P::add(px0, iy0));
+			typename P::type const ixy10 = noise_permute<P, T>(P::add(px1, iy0));
+			typename P::type const ixy01 = noise_permute<P, T>(P::add(px0, iy1));
+			typename P::type const ixy11 = noise_permute<P, T>(P::add(px1, iy1));
+
+			typename P::type const n000 = corner<P, T>(noise_permute<P, T>(P::add(ixy00, iz0)), fx0, fy0, fz0);
+			typename P::type const n100 = corner<P, T>(noise_permute<P, T>(P::add(ixy10, iz0)), fx1, fy0, fz0);
+			typename P::type const n010 = corner<P, T>(noise_permute<P, T>(P::add(ixy01, iz0)), fx0, fy1, fz0);
+			typename P::type const n110 = corner<P, T>(noise_permute<P, T>(P::add(ixy11, iz0)), fx1, fy1, fz0);
+			typename P::type const n001 = corner<P, T>(noise_permute<P, T>(P::add(ixy00, iz1)), fx0, fy0, fz1);
+			typename P::type const n101 = corner<P, T>(noise_permute<P, T>(P::add(ixy10, iz1)), fx1, fy0, fz1);
+			typename P::type const n011 = corner<P, T>(noise_permute<P, T>(P::add(ixy01, iz1)), fx0, fy1, fz1);
+			typename P::type const n111 = corner<P, T>(noise_permute<P, T>(P::add(ixy11, iz1)), fx1, fy1, fz1);
+
+			typename P::type const FadeX = noise_fade<P, T>(fx0);
+			typename P::type const FadeY = noise_fade<P, T>(fy0);
+			typename P::type const FadeZ = noise_fade<P, T>(fz0);
+			typename P::type const nz00 = noise_mix<P, T>(n000, n001, FadeZ);
+			typename P::type const nz10 = noise_mix<P, T>(n100, n101, FadeZ);
+			typename P::type const nz01 = noise_mix<P, T>(n010, n011, FadeZ);
+			typename P::type const nz11 = noise_mix<P, T>(n110, n111, FadeZ);
+			typename P::type const nyz0 = noise_mix<P, T>(nz00, nz01, FadeY);
+			typename P::type const nyz1 = noise_mix<P, T>(nz10, nz11, FadeY);
+			return P::mul(P::set1(static_cast<T>(2.2)), noise_mix<P, T>(nyz0, nyz1, FadeX));
+		}
+	};
+
+	template<length_t L>
+	struct noise_simplex;
+
+	template<>
+	struct noise_simplex<2>
+	{
+		// Contribution of the simplex corner hashed to p, at the offset (x, y) from the point
+		template<typename P, typename T>
+		GLM_FUNC_QUALIFIER static typename P::type corner(typename P::type p, typename P::type x, typename P::type y)
+		{
+			typename P::type const Half = P::set1(static_cast<T>(0.5));
+
+			typename P::type m = P::max(P::sub(Half, P::add(P::mul(x, x), P::mul(y, y))), P::set1(static_cast<T>(0)));
+			m = P::mul(m, m);
+			m = P::mul(m, m);
+
+			// Gradients: 41 points uniformly over a line, mapped onto a diamond
+			typename P::type const gx = P::sub(P::mul(P::set1(static_cast<T>(2)), noise_fract<P, T>(P::mul(p, P::set1(static_cast<T>(0.024390243902439))))), P::set1(static_cast<T>(1)));
+			typename P::type const h = P::sub(P::abs(gx), Half);
+			typename P::type const a0 = P::sub(gx, P::floor(P::add(gx, Half)));
+
+			// Normalise the gradient implicitly by scaling m
+			m = P::mul(m, noise_taylorInvSqrt<P, T>(P::add(P::mul(a0, a0), P::mul(h, h))));
+			return P::mul(m, P::add(P::mul(a0, x), P::mul(h, y)));
+		}
+
+		template<typename P, typename T>
+		GLM_FUNC_QUALIFIER static typename P::type call(typename P::type const* Position)
+		{
+			typename P::type const One = P::set1(static_cast<T>(1));
+			typename P::type const C0 = P::set1(static_cast<T>(0.211324865405187));  // (3.0 -  sqrt(3.0)) / 6.0
+			typename P::type const C1 = P::set1(static_cast<T>(0.366025403784439));  //  0.5 * (sqrt(3.0)  - 1.0)
+			typename P::type const C2 = P::set1(static_cast<T>(-0.577350269189626)); // -1.0 + 2.0 * C.x
+
+			// First corner
+			typename P::type const s = P::add(P::mul(Position[0], C1), P::mul(Position[1], C1));
+			typename P::type ix = P::floor(P::add(Position[0], s));
+			typename P::type iy = P::floor(P::add(Position[1], s));
+			typename P::type const t = P::add(P::mul(ix, C0), P::mul(iy, C0));
+			typename P::type const x0 = P::add(P::sub(Position[0], ix), t);
+			typename P::type const y0 = P::add(P::sub(Position[1], iy), t);
+
+			// Other corners
+			typename P::type const i1x = P::greater(x0, y0);
+			typename P::type const i1y = P::sub(One, i1x);
+			typename P::type const x1 = P::sub(P::add(x0, C0), i1x);
+			typename P::type const y1 = P::sub(P::add(y0, C0), i1y);
+			typename P::type const x2 = P::add(x0, C2);
+			typename P::type const y2 = P::add(y0, C2);
+
+			// Permutations
+			ix = noise_mod<P, T>(ix, static_cast<T>(289));
+			iy = noise_mod<P, T>(iy, static_cast<T>(289));
+			typename P::type const p0 = noise_permute<P, T>(P::add(noise_permute<P, T>(iy), ix));
+			typename P::type const p1 = noise_permute<P, T>(P::add(P::add(noise_permute<P, T>(P::add(iy, i1y)), ix), i1x));
+			typename P::type const p2 = noise_permute<P, T>(P::add(P::add(noise_permute<P, T>(P::add(iy, One)), ix), One));
+
+			typename P::type const n0 = corner<P, T>(p0, x0, y0);
+			typename P::type const n1 = corner<P, T>(p1, x1, y1);
+			typename P::type const n2 = corner<P, T>(p2, x2, y2);
+			return P::mul(P::set1(static_cast<T>(130)), P::add(P::add(n0, n1), n2));
+		}
+	};
+
+	template<>
+	struct noise_simplex<3>
+	{
+		// Contribution of the simplex corner hashed to p, at the offset (x, y, z) from the point
+		template<typename P, typename T>
+		GLM_FUNC_QUALIFIER static typename P::type corner(typename P::type p, typename P::type x, typename P::type y, typename P::type z)
+		{
+			typename P::type const Zero = P::set1(static_cast<T>(0));
+			typename P::type const One = P::set1(static_cast<T>(1));
+
+			// Gradients: 7x7 points over a square, mapped onto an octahedron
+			T const n_ = static_cast<T>(0.142857142857); // 1.0/7.0
+			typename P::type const NsX = P::set1(n_ * static_cast<T>(2) - static_cast<T>(0));
+			typename P::type const NsY = P::set1(n_ * static_cast<T>(0.5) - static_cast<T>(1));
+			typename P::type const NsZ = P::set1(n_ * static_cast<T>(1) - static_cast<T>(0));
+
+			typename P::type const j = P::sub(p, P::mul(P::set1(static_cast<T>(49)), P::floor(P::mul(P::mul(p, NsZ), NsZ))));
+			typename P::type const x_ = P::floor(P::mul(j, NsZ));
+			typename P::type const y_ = P::floor(P::sub(j, P::mul(P::set1(static_cast<T>(7)), x_)));
+
+			typename P::type gx = P::add(P::mul(x_, NsX), NsY);
+			typename P::type gy = P::add(P::mul(y_, NsX), NsY);
+			typename P::type const gz = P::sub(P::sub(One, P::abs(gx)), P::abs(gy));
+
+			typename P::type const Two = P::set1(static_cast<T>(2));
+			typename P::type const sh = P::step(gz, Zero);
+			gx = P::sub(gx, P::mul(P::add(P::mul(P::floor(gx), Two), One), sh));
+			gy = P::sub(gy, P::mul(P::add(P::mul(P::floor(gy), Two), One), sh));
+
+			// Normalise gradients
+			typename P::type const Norm = noise_taylorInvSqrt<P, T>(P::add(P::add(P::mul(gx, gx), P::mul(gy, gy)), P::mul(gz, gz)));
+			typename P::type const Dot = P::add(P::add(P::mul(P::mul(gx, Norm), x), P::mul(P::mul(gy, Norm), y)), P::mul(P::mul(gz, Norm), z));
+
+			typename P::type m = P::max(P::sub(P::set1(static_cast<T>(0.6)), P::add(P::add(P::mul(x, x), P::mul(y, y)), P::mul(z, z))), Zero);
+			m = P::mul(m, m);
+			return P::mul(P::mul(m, m), Dot);
+		}
+
+		template<typename P, typename T>
+		GLM_FUNC_QUALIFIER static typename P::type call(typename P::type const* Position)
+		{
+			typename P::type const One = P::set1(static_cast<T>(1));
+			typename P::type const Cx = P::set1(static_cast<T>(1.0 / 6.0));
+			typename P::type const Cy = P::set1(static_cast<T>(1.0 / 3.0));
+
+			// First corner
+			typename P::type const s = P::add(P::add(P::mul(Position[0], Cy), P::mul(Position[1], Cy)), P::mul(Position[2], Cy));
+			typename P::type ix = P::floor(P::add(Position[0], s));
+			typename P::type iy = P::floor(P::add(Position[1], s));
+			typename P::type iz = P::floor(P::add(Position[2], s));
+			typename P::type const t = P::add(P::add(P::mul(ix, Cx), P::mul(iy, Cx)), P::mul(iz, Cx));
+			typename P::type const x0 = P::add(P::sub(Position[0], ix), t);
+			typename P::type const y0 = P::add(P::sub(Position[1], iy), t);
+			typename P::type const z0 = P::add(P::sub(Position[2], iz), t);
+
+			// Other corners
+			typename P::type const gx = P::step(y0, x0);
+			typename P::type const gy = P::step(z0, y0);
+			typename P::type const gz = P::step(x0, z0);
+			typename P::type const lx = P::sub(One, gx);
+			typename P::type const ly = P::sub(One, gy);
+			typename P::type const lz = P::sub(One, gz);
+			typename P::type const i1x = P::min(gx, lz);
+			typename P::type const i1y = P::min(gy, lx);
+			typename P::type const i1z = P::min(gz, ly);
+			typename P::type const i2x = P::max(gx, lz);
+			typename P::type const i2y = P::max(gy, lx);
+			typename P::type const i2z = P::max(gz, ly);
+
+			typename P::type const x1 = P::add(P::sub(x0, i1x), Cx);
+			typename P::type const y1 = P::add(P::sub(y0, i1y), Cx);
+			typename P::type const z1 = P::add(P::sub(z0, i1z), Cx);
+			typename P::type const x2 = P::add(P::sub(x0, i2x), Cy);
+			typename P::type const y2 = P::add(P::sub(y0, i2y), Cy);
+			typename P::type const z2 = P::add(P::sub(z0, i2z), Cy);
+			typename P::type const Half = P::set1(static_cast<T>(0.5));
+			typename P::type const x3 = P::sub(x0, Half);
+			typename P::type const y3 = P::sub(y0, Half);
+			typename P::type const z3 = P::sub(z0, Half);
+
+			// Permutations
+			ix = noise_mod289<P, T>(ix);
+			iy = noise_mod289<P, T>(iy);
+			iz = noise_mod289<P, T>(iz);
+			typename P::type const p0 = noise_permute<P, T>(P::add(noise_permute<P, T>(P::add(noise_permute<P, T>(iz), iy)), ix));
+			typename P::type const p1 = noise_permute<P, T>(P::add(P::add(noise_permute<P, T>(P::add(P::add(noise_permute<P, T>(P::add(iz, i1z)), iy), i1y)), ix), i1x));
+			typename P::type const p2 = noise_permute<P, T>(P::add(P::add(noise_permute<P, T>(P::add(P::add(noise_permute<P, T>(P::add(iz, i2z)), iy), i2y)), ix), i2x));
+			typename P::type const p3 = noise_permute<P, T>(P::add(P::add(noise_permute<P, T>(P::add(P::add(noise_permute<P, T>(P::add(iz, One)), iy), One)), ix), One));
+
+			typename P::type const n0 = corner<P, T>(p0, x0, y0, z0);
+			typename P::type const n1 = corner<P, T>(p1, x1, y1, z1);
+			typename P::type const n2 = corner<P, T>(p2, x2, y2, z2);
+			typename P::type const n3 = corner<P, T>(p3, x3, y3, z3);
+			return P::mul(P::set1(static_cast<T>(42)), P::add(P::add(n0, n1), P::add(n2, n3)));
+		}
+	};
+
+	// Sums the octaves of the noise N at the L coordinates of P::width points
+	template<typename N, typename P, length_t L, typename T>
+	GLM_FUNC_QUALIFIER typename P::type noise_fbm(typename P::type const* Position, int octaves, T lacunarity, T gain)
+	{
+		typename P::type Result = P::set1(static_cast<T>(0));
+		T Frequency = static_cast<T>(1);
+		T Amplitude = static_cast<T>(1);
+		for(int o = 0; o < octaves; ++o)
+		{
+			typename P::type Scaled[L];
+			for(length_t c = 0; c < L; ++c)
+				Scaled[c] = P::mul(Position[c], P::set1(Frequency));
+			Result = P::add(Result, P::mul(P::set1(Amplitude), N::template call<P, T>(Scaled)));
+			Frequency *= lacunarity;
+			Amplitude *= gain;
+		}
+		return Result;
+	}
+
+	// Like the GTX_vec_soa kernels, these process [i, count) 'P::width' at a time and return
+	// the index of the first point they didn't process. noise_scalar finishes the tail.
+
+	template<typename N, typename P, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t noise_points(vec<L, T, Q> const* in, T* out, std::size_t i, std::size_t count, int octaves, T lacunarity, T gain)
+	{
+		for(; i + P::width <= count; i += P::width)
+		{
+			T Components[L][P::width];
+			for(std::size_t k = 0; k < P::width; ++k)
+				for(length_t c = 0; c < L; ++c)
+					Components[c][k] = in[i + k][c];
+
+			typename P::type Position[L];
+			for(length_t c = 0; c < L; ++c)
+				Position[c] = P::load(Components[c]);
+			P::store(out + i, noise_fbm<N, P, L, T>(Position, octaves, lacunarity, gain));
+		}
+		return i;
+	}
+
+	// Row of a grid: the x coordinate varies, the others are given in Position[1, L)
+	template<typename N, typename P, length_t L, typename T>
+	GLM_FUNC_QUALIFIER int noise_row(T originX, T stepX, typename P::type* Position, T* out, int x, int count, int octaves, T lacunarity, T gain)
+	{
+		T Lanes[P::width];
+		for(std::size_t k = 0; k < P::width; ++k)
+			Lanes[k] = static_cast<T>(k);
+		typename P::type const Offset = P::load(Lanes);
+
+		for(; x + static_cast<int>(P::width) <= count; x += static_cast<int>(P::width))
+		{
+			typename P::type const Index = P::add(P::set1(static_cast<T>(x)), Offset);
+			Position[0] = P::add(P::set1(originX), P::mul(Index, P::set1(stepX)));
+			P::store(out + x, noise_fbm<N, P, L, T>(Position, octaves, lacunarity, gain));
+		}
+		return x;
+	}
+
+	template<typename N, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void noise_grid_rows(vec<L, T, Q> const& origin, vec<L, T, Q> const& step, vec<L, int, Q> const& size, T* out, std::size_t first, std::size_t last, int octaves, T lacunarity, T gain)
+	{
+		typedef typename noise_native<T>::type pack;
+		typedef noise_scalar<T> scalar;
+
+		for(std::size_t Row = first; Row < last; ++Row)
+		{
+			typename pack::type Position[L];
+			typename scalar::type Tail[L];
+
+			std::size_t Coordinate = Row;
+			for(length_t c = 1; c < L; ++c)
+			{
+				std::size_t const Size = static_cast<std::size_t>(size[c]);
+				Tail[c] = origin[c] + static_cast<T>(Coordinate % Size) * step[c];
+				Position[c] = pack::set1(Tail[c]);
+				Coordinate /= Size;
+			}
+
+			T* const Dst = out + Row * static_cast<std::size_t>(size.x);
+			int const x = noise_row<N, pack, L, T>(origin.x, step.x, Position, Dst, 0, size.x, octaves, lacunarity, gain);
+			noise_row<N, scalar, L, T>(origin.x, step.x, Tail, Dst, x, size.x, octaves, lacunarity, gain);
+		}
+	}
+
+	template<typename N, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void noise_batch(vec<L, T, Q> const* in, T* out, std::size_t count, int octaves, T lacunarity, T gain)
+	{
+		GLM_STATIC_ASSERT(L == 2 || L == 3, "'GLM_GTX_noise_batch' only supports 2 and 3 components vectors");
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'GLM_GTX_noise_batch' only accept floating-point inputs");
+
+		std::size_t const i = noise_points<N, typename noise_native<T>::type>(in, out, 0, count, octaves, lacunarity, gain);
+		noise_points<N, noise_scalar<T> >(in, out, i, count, octaves, lacunarity, gain);
+	}
+
+	template<typename N, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void noise_grid(vec<L, T, Q> const& origin, vec<L, T, Q> const& step, vec<L, int, Q> const& size, T* out, int octaves, T lacunarity, T gain, unsigned threads)
+	{
+		GLM_STATIC_ASSERT(L == 2 || L == 3, "'GLM_GTX_noise_batch' only supports 2 and 3 components vectors");
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'GLM_GTX_noise_batch' only accept floating-point inputs");
+
+		std::size_t Rows = 1;
+		for(length_t c = 0; c < L; ++c)
+		{
+			if(size[c] <= 0)
+				return;
+			if(c > 0)
+				Rows *= static_cast<std::size_t>(size[c]);
+		}
+
+#		if GLM_HAS_CXX11_STL
+			if(threads == 0)
+				threads = std::thread::hardware_concurrency();
+			if(static_cast<std::size_t>(threads) > Rows)
+				threads = static_cast<unsigned>(Rows);
+
+			if(threads > 1)
+			{
+				// Contiguous bands of rows, the calling thread computes the last one
+				std::vector<std::thread> Workers;
+				Workers.reserve(threads - 1);
+				for(unsigned t = 0; t + 1 < threads; ++t)
+					Workers.push_back(std::thread(noise_grid_rows<N, L, T, Q>, origin, step, size, out, Rows * t / threads, Rows * (t + 1) / threads, octaves, lacunarity, gain));
+				noise_grid_rows<N, L, T, Q>(origin, step, size, out, Rows * (threads - 1) / threads, Rows, octaves, lacunarity, gain);
+				for(std::size_t t = 0; t < Workers.size(); ++t)
+					Workers[t].join();
+				return;
+			}
+#		else
+			static_cast<void>(threads);
+#		endif
+
+		noise_grid_rows<N, L, T, Q>(origin, step, size, out, 0, Rows, octaves, lacunarity, gain);
+	}
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlin(vec<L, T, Q> const* in, T* out, std::size_t count, int octaves, T lacunarity, T gain)
+	{
+		detail::noise_batch<detail::noise_perlin<L> >(in, out, count, octaves, lacunarity, gain);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplex(vec<L, T, Q> const* in, T* out, std::size_t count, int octaves, T lacunarity, T gain)
+	{
+		detail::noise_batch<detail::noise_simplex<L> >(in, out, count, octaves, lacunarity, gain);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlinGrid(vec<L, T, Q> const& origin, vec<L, T, Q> const& step, vec<L, int, Q> const& size, T* out, int octaves, T lacunarity, T gain, unsigned threads)
+	{
+		detail::noise_grid<detail::noise_perlin<L> >(origin, step, size, out, octaves, lacunarity, gain, threads);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplexGrid(vec<L, T, Q> const& origin, vec<L, T, Q> const& step, vec<L, int, Q> const& size, T* out, int octaves, T lacunarity, T gain, unsigned threads)
+	{
+		detail::noise_grid<detail::noise_simplex<L> >(origin, step, size, out, octaves, lacunarity, gain, threads);
+	}
+}//namespace glm
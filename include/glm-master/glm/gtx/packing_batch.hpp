@@ -0,0 +1,87 @@
+/// @ref gtx_packing_batch
+/// @file glm/gtx/packing_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtc_packing (dependence)
+///
+/// @defgroup gtx_packing_batch GLM_GTX_packing_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/packing_batch.hpp> to use the features of this extension.
+///
+/// Pack and unpack arrays of values.
+/// The results are the same as calling the GTC_packing functions on each value, except that
+/// packHalf rounds ties to even. The values are processed 4 at a time with SSE2 or NEON,
+/// 8 at a time with AVX2, and half floats are converted with F16C when the compiler targets it.
+
+#pragma once
+
+// Dependencies:
+#include "../glm.hpp"
+#include "../gtc/packing.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_packing_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_packing_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_packing_batch
+	/// @{
+
+	/// Computes out[i] = packHalf1x16(in[i]) for i in [0, count), except that ties round to even
+	/// like F16C and GPUs do, where packHalf1x16 rounds them away from zero.
+	/// NaN keep their sign and high significand bits and become quiet NaN.
+	/// @see gtx_packing_batch
+	GLM_FUNC_DISCARD_DECL void packHalf(float const* in, uint16* out, std::size_t count);
+
+	/// Computes out[i] = unpackHalf1x16(in[i]) for i in [0, count).
+	/// @see gtx_packing_batch
+	GLM_FUNC_DISCARD_DECL void unpackHalf(uint16 const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = packUnorm4x8(in[i]) for i in [0, count).
+	/// @see gtx_packing_batch
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void packUnorm4x8(vec<4, float, Q> const* in, uint32* out, std::size_t count);
+
+	/// Computes out[i] = unpackUnorm4x8(in[i]) for i in [0, count).
+	/// @see gtx_packing_batch
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void unpackUnorm4x8(uint32 const* in, vec<4, float, Q>* out, std::size_t count);
+
+	/// Computes out[i] = packSnorm4x8(in[i]) for i in [0, count).
+	/// @see gtx_packing_batch
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void packSnorm4x8(vec<4, float, Q> const* in, uint32* out, std::size_t count);
+
+	/// Computes out[i] = unpackSnorm4x8(in[i]) for i in [0, count).
+	/// @see gtx_packing_batch
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void unpackSnorm4x8(uint32 const* in, vec<4, float, Q>* out, std::size_t count);
+
+	/// Computes out[i] = packUnorm3x10_1x2(in[i]) for i in [0, count).
+	/// @see gtx_packing_batch
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void packUnorm3x10_1x2(vec<4, float, Q> const* in, uint32* out, std::size_t count);
+
+	/// Computes out[i] = unpackUnorm3x10_1x2(in[i]) for i in [0, count).
+	/// @see gtx_packing_batch
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void unpackUnorm3x10_1x2(uint32 const* in, vec<4, float, Q>* out, std::size_t count);
+
+	/// Computes out[i] = packSnorm3x10_1x2(in[i]) for i in [0, count).
+	/// @see gtx_packing_batch
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void packSnorm3x10_1x2(vec<4, float, Q> const* in, uint32* out, std::size_t count);
+
+	/// Computes out[i] = unpackSnorm3x10_1x2(in[i]) for i in [0, count).
+	/// @see gtx_packing_batch
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void unpackSnorm3x10_1x2(uint32 const* in, vec<4, float, Q>* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "packing_batch.inl"
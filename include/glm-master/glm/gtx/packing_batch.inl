@@ -0,0 +1,257 @@
+/// @ref gtx_packing_batch
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/packing.h"
+#endif
+
+namespace glm{
+namespace detail
+{
+	// float to half rounding ties to even, for the paths without SIMD.
+	// Same bit manipulations as glm_vec4_to_half in glm/simd/packing.h.
+	GLM_FUNC_QUALIFIER uint16 packHalf_rte(float v)
+	{
+		uint32 Bits = 0;
+		memcpy(&Bits, &v, sizeof(Bits));
+		uint32 const Sign = Bits & 0x80000000u;
+		uint32 const Abs = Bits ^ Sign;
+
+		uint32 Result;
+		if(Abs >= ((127u + 16u) << 23))
+			Result = Abs > 0x7f800000u ? 0x7e00u | ((Abs & 0x007fffffu) >> 13) : 0x7c00u;
+		else if(Abs < (113u << 23))
+		{
+			// Adding 0.5 aligns the 10 significand bits at the bottom and the FPU rounds them to nearest even
+			float Denormal = 0;
+			memcpy(&Denormal, &Abs, sizeof(Denormal));
+			Denormal += 0.5f;
+			memcpy(&Result, &Denormal, sizeof(Result));
+			Result -= 126u << 23;
+		}
+		else
+			Result = (Abs - (112u << 23) + 0xfffu + ((Abs >> 13) & 1u)) >> 13;
+
+		return static_cast<uint16>(Result | (Sign >> 16));
+	}
+
+#	if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<bool Signed>
+	GLM_FUNC_QUALIFIER void pack4x8_neon(float const* in, uint32* out, std::size_t count)
+	{
+		float32x4_t const Min = vdupq_n_f32(Signed ? -1.0f : 0.0f);
+		float32x4_t const Max = vdupq_n_f32(1.0f);
+		float32x4_t const Scale = vdupq_n_f32(Signed ? 127.0f : 255.0f);
+
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			// vcvta rounds half away from zero, like std::round
+			int32x4_t q[4];
+			for(std::size_t j = 0; j < 4; ++j)
+				q[j] = vcvtaq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(vld1q_f32(in + (i + j) * 4), Min), Max), Scale));
+
+			int16x8_t const Words01 = vcombine_s16(vqmovn_s32(q[0]), vqmovn_s32(q[1]));
+			int16x8_t const Words23 = vcombine_s16(vqmovn_s32(q[2]), vqmovn_s32(q[3]));
+			uint8x16_t const Bytes = Signed
+				? vreinterpretq_u8_s8(vcombine_s8(vqmovn_s16(Words01), vqmovn_s16(Words23)))
+				: vcombine_u8(vqmovun_s16(Words01), vqmovun_s16(Words23));
+			vst1q_u8(reinterpret_cast<uint8*>(out + i), Bytes);
+		}
+
+		for(; i < count; ++i)
+		{
+			vec4 const v(in[i * 4 + 0], in[i * 4 + 1], in[i * 4 + 2], in[i * 4 + 3]);
+			out[i] = Signed ? packSnorm4x8(v) : packUnorm4x8(v);
+		}
+	}
+
+	template<bool Signed>
+	GLM_FUNC_QUALIFIER void unpack4x8_neon(uint32 const* in, float* out, std::size_t count)
+	{
+		// Same constants and clamp as the scalar functions, so the results are identical
+		float32x4_t const Min = vdupq_n_f32(Signed ? -1.0f : 0.0f);
+		float32x4_t const Max = vdupq_n_f32(1.0f);
+		float32x4_t const Scale = vdupq_n_f32(Signed ? 0.0078740157480315f : 0.0039215686274509803921568627451f);
+
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			uint8x16_t const Bytes = vld1q_u8(reinterpret_cast<uint8 const*>(in + i));
+			int32x4_t Ints[4];
+			if(Signed)
+			{
+				int16x8_t const Lo = vmovl_s8(vget_low_s8(vreinterpretq_s8_u8(Bytes)));
+				int16x8_t const Hi = vmovl_s8(vget_high_s8(vreinterpretq_s8_u8(Bytes)));
+				Ints[0] = vmovl_s16(vget_low_s16(Lo));
+				Ints[1] = vmovl_s16(vget_high_s16(Lo));
+				Ints[2] = vmovl_s16(vget_low_s16(Hi));
+				Ints[3] = vmovl_s16(vget_high_s16(Hi));
+			}
+			else
+			{
+				uint16x8_t const Lo = vmovl_u8(vget_low_u8(Bytes));
+				uint16x8_t const Hi = vmovl_u8(vget_high_u8(Bytes));
+				Ints[0] = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(Lo)));
+				Ints[1] = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(Lo)));
+				Ints[2] = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(Hi)));
+				Ints[3] = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(Hi)));
+			}
+
+			for(std::size_t j = 0; j < 4; ++j)
+				vst1q_f32(out + (i + j) * 4, vminq_f32(vmaxq_f32(vmulq_f32(vcvtq_f32_s32(Ints[j]), Scale), Min), Max));
+		}
+
+		for(; i < count; ++i)
+		{
+			vec4 const v = Signed ? unpackSnorm4x8(in[i]) : unpackUnorm4x8(in[i]);
+			vst1q_f32(out + i * 4, vld1q_f32(&v.x));
+		}
+	}
+#	endif
+
+	template<qualifier Q>
+	struct compute_packing_batch
+	{
+		// Tightly packed vec4 are read and written as arrays of floats by the SIMD kernels
+		GLM_FUNC_QUALIFIER static float const* floats(vec<4, float, Q> const* v)
+		{
+			GLM_STATIC_ASSERT(sizeof(vec<4, float, Q>) == sizeof(float) * 4, "Batch packing requires tightly packed vec4");
+			return reinterpret_cast<float const*>(v);
+		}
+
+		GLM_FUNC_QUALIFIER static float* floats(vec<4, float, Q>* v)
+		{
+			GLM_STATIC_ASSERT(sizeof(vec<4, float, Q>) == sizeof(float) * 4, "Batch packing requires tightly packed vec4");
+			return reinterpret_cast<float*>(v);
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void packHalf(float const* in, uint16* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_f32_to_f16_batch(in, out, count);
+#		elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4)
+				vst1_u16(out + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(in + i))));
+			for(; i < count; ++i)
+				out[i] = detail::packHalf_rte(in[i]);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = detail::packHalf_rte(in[i]);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf(uint16 const* in, float* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_f16_to_f32_batch(in, out, count);
+#		elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4)
+				vst1q_f32(out + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(in + i))));
+			for(; i < count; ++i)
+				out[i] = unpackHalf1x16(in[i]);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = unpackHalf1x16(in[i]);
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packUnorm4x8(vec<4, float, Q> const* in, uint32* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_pack4x8_batch(detail::compute_packing_batch<Q>::floats(in), out, count, false);
+#		elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+			detail::pack4x8_neon<false>(detail::compute_packing_batch<Q>::floats(in), out, count);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = packUnorm4x8(vec4(in[i]));
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackUnorm4x8(uint32 const* in, vec<4, float, Q>* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_unpack4x8_batch(in, detail::compute_packing_batch<Q>::floats(out), count, false);
+#		elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+			detail::unpack4x8_neon<false>(in, detail::compute_packing_batch<Q>::floats(out), count);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = vec<4, float, Q>(unpackUnorm4x8(in[i]));
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packSnorm4x8(vec<4, float, Q> const* in, uint32* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_pack4x8_batch(detail::compute_packing_batch<Q>::floats(in), out, count, true);
+#		elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+			detail::pack4x8_neon<true>(detail::compute_packing_batch<Q>::floats(in), out, count);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = packSnorm4x8(vec4(in[i]));
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackSnorm4x8(uint32 const* in, vec<4, float, Q>* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_unpack4x8_batch(in, detail::compute_packing_batch<Q>::floats(out), count, true);
+#		elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+			detail::unpack4x8_neon<true>(in, detail::compute_packing_batch<Q>::floats(out), count);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = vec<4, float, Q>(unpackSnorm4x8(in[i]));
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packUnorm3x10_1x2(vec<4, float, Q> const* in, uint32* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_pack3x10_1x2_batch(detail::compute_packing_batch<Q>::floats(in), out, count, false);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = packUnorm3x10_1x2(vec4(in[i]));
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackUnorm3x10_1x2(uint32 const* in, vec<4, float, Q>* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_unpack3x10_1x2_batch(in, detail::compute_packing_batch<Q>::floats(out), count, false);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = vec<4, float, Q>(unpackUnorm3x10_1x2(in[i]));
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packSnorm3x10_1x2(vec<4, float, Q> const* in, uint32* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_pack3x10_1x2_batch(detail::compute_packing_batch<Q>::floats(in), out, count, true);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = packSnorm3x10_1x2(vec4(in[i]));
+#		endif
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackSnorm3x10_1x2(uint32 const* in, vec<4, float, Q>* out, std::size_t count)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			glm_unpack3x10_1x2_batch(in, detail::compute_packing_batch<Q>::floats(out), count, true);
+#		else
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = vec<4, float, Q>(unpackSnorm3x10_1x2(in[i]));
+#		endif
+	}
+}//namespace glm
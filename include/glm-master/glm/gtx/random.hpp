@@ -0,0 +1,117 @@
+/// @ref gtx_random
+/// @file glm/gtx/random.hpp
+///
+/// @see core (dependence)
+/// @see gtc_random
+///
+/// @defgroup gtx_random GLM_GTX_random
+/// @ingroup gtx
+///
+/// Include <glm/gtx/random.hpp> to use the features of this extension.
+///
+/// Seedable random number engine filling arrays with the distributions of GLM_GTC_random.
+/// The GLM_GTC_random functions call std::rand() for each component, which is slow, may
+/// lock, and shares one global state between threads. A random_engine is an object of its own,
+/// typically one per thread: 8 xoshiro128+ generators advanced together, 8 lanes per
+/// instruction with AVX2, 4 with SSE2 or NEON. The sequence is the same on every platform.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_random is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_random extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_random
+	/// @{
+
+	/// Random number engine made of 8 interleaved xoshiro128+ generators.
+	/// Engines seeded with different values, for example a base seed plus a thread index,
+	/// produce independent sequences. An engine must not be used by several threads at once.
+	/// @see gtx_random
+	class random_engine
+	{
+	public:
+		/// Number of generators advanced together.
+		static std::size_t const lanes = 8;
+
+		GLM_FUNC_DISCARD_DECL explicit random_engine(uint64 seed = 0);
+
+		/// Restarts the sequence from the state derived from 'seed' with splitmix64.
+		GLM_FUNC_DISCARD_DECL void seed(uint64 seed);
+
+		/// Fills 'out' with 'count' uniformly distributed 32 bits integers.
+		/// Filling n values then m values gives the same values as filling n + m values.
+		GLM_FUNC_DISCARD_DECL void generate(uint32* out, std::size_t count);
+
+		/// Fills 'out' with 'count' values uniformly distributed in [0, 1), with 24 random bits.
+		GLM_FUNC_DISCARD_DECL void generate(float* out, std::size_t count);
+
+		/// Fills 'out' with 'count' values uniformly distributed in [0, 1), with 53 random bits
+		/// made of two consecutive integers of the sequence.
+		GLM_FUNC_DISCARD_DECL void generate(double* out, std::size_t count);
+
+	private:
+		template<typename genType>
+		GLM_FUNC_DISCARD_DECL void generate_values(genType* out, std::size_t count);
+
+		GLM_FUNC_DECL uint32 next_buffered();
+
+		uint32 State[4][lanes];
+		uint32 Buffer[lanes];
+		std::size_t Available;
+	};
+
+	/// Fills 'out' with 'count' values uniformly distributed in [Min, Max).
+	/// @see gtx_random
+	template<typename T>
+	GLM_FUNC_DISCARD_DECL void linearRand(random_engine& engine, T Min, T Max, T* out, std::size_t count);
+
+	/// Fills 'out' with 'count' vectors whose components are uniformly distributed in [Min, Max).
+	/// @see gtx_random
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void linearRand(random_engine& engine, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, vec<L, T, Q>* out, std::size_t count);
+
+	/// Fills 'out' with 'count' values of a normal distribution.
+	/// Unlike the GLM_GTC_random function, which scales by Deviation * Deviation, Deviation is
+	/// the standard deviation.
+	/// @see gtx_random
+	template<typename T>
+	GLM_FUNC_DISCARD_DECL void gaussRand(random_engine& engine, T Mean, T Deviation, T* out, std::size_t count);
+
+	/// Fills 'out' with 'count' vectors whose components follow normal distributions.
+	/// Deviation is the standard deviation of each component.
+	/// @see gtx_random
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void gaussRand(random_engine& engine, vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation, vec<L, T, Q>* out, std::size_t count);
+
+	/// Fills 'out' with 'count' points uniformly distributed on a circle of the given radius.
+	/// @see gtx_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void circularRand(random_engine& engine, T Radius, vec<2, T, Q>* out, std::size_t count);
+
+	/// Fills 'out' with 'count' points uniformly distributed on a sphere of the given radius.
+	/// @see gtx_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void sphericalRand(random_engine& engine, T Radius, vec<3, T, Q>* out, std::size_t count);
+
+	/// Fills 'out' with 'count' points uniformly distributed in a disk of the given radius.
+	/// @see gtx_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void diskRand(random_engine& engine, T Radius, vec<2, T, Q>* out, std::size_t count);
+
+	/// Fills 'out' with 'count' points uniformly distributed in a ball of the given radius.
+	/// @see gtx_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void ballRand(random_engine& engine, T Radius, vec<3, T, Q>* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "random.inl"
@@ -0,0 +1,517 @@
+/// @ref gtx_random
+
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER uint64 random_splitmix64(uint64& x)
+	{
+		uint64 z = (x += static_cast<uint64>(0x9E3779B97F4A7C15ull));
+		z = (z ^ (z >> 30)) * static_cast<uint64>(0xBF58476D1CE4E5B9ull);
+		z = (z ^ (z >> 27)) * static_cast<uint64>(0x94D049BB133111EBull);
+		return z ^ (z >> 31);
+	}
+
+	// The 24 high bits, the low bits of xoshiro128+ being the weakest
+	GLM_FUNC_QUALIFIER float random_float(uint32 x)
+	{
+		return static_cast<float>(x >> 8) * (1.0f / 16777216.0f);
+	}
+
+	GLM_FUNC_QUALIFIER double random_double(uint32 High, uint32 Low)
+	{
+		return static_cast<double>(((static_cast<uint64>(High) << 32) | Low) >> 11) * (1.0 / 9007199254740992.0);
+	}
+
+	GLM_FUNC_QUALIFIER void random_convert(uint32 x, uint32& Out)
+	{
+		Out = x;
+	}
+
+	GLM_FUNC_QUALIFIER void random_convert(uint32 x, float& Out)
+	{
+		Out = random_float(x);
+	}
+
+	// 8 xoshiro128+ generators, lane k of State[w] holding the word w of the generator k.
+	// next() advances every generator by one step and writes their outputs in lane order.
+	struct random_scalar
+	{
+		uint32 s[4][random_engine::lanes];
+
+		GLM_FUNC_QUALIFIER void load(uint32 const State[4][random_engine::lanes])
+		{
+			std::memcpy(this->s, State, sizeof(this->s));
+		}
+
+		GLM_FUNC_QUALIFIER void store(uint32 State[4][random_engine::lanes]) const
+		{
+			std::memcpy(State, this->s, sizeof(this->s));
+		}
+
+		GLM_FUNC_QUALIFIER void next(uint32* Out)
+		{
+			for(std::size_t k = 0; k < random_engine::lanes; ++k)
+			{
+				Out[k] = this->s[0][k] + this->s[3][k];
+
+				uint32 const t = this->s[1][k] << 9;
+				this->s[2][k] ^= this->s[0][k];
+				this->s[3][k] ^= this->s[1][k];
+				this->s[1][k] ^= this->s[2][k];
+				this->s[0][k] ^= this->s[3][k];
+				this->s[2][k] ^= t;
+				this->s[3][k] = (this->s[3][k] << 11) | (this->s[3][k] >> 21);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER void next(float* Out)
+		{
+			uint32 Values[random_engine::lanes];
+			this->next(Values);
+			for(std::size_t k = 0; k < random_engine::lanes; ++k)
+				Out[k] = random_float(Values[k]);
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	struct random_avx2
+	{
+		__m256i s0, s1, s2, s3;
+
+		GLM_FUNC_QUALIFIER void load(uint32 const State[4][random_engine::lanes])
+		{
+			this->s0 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(State[0]));
+			this->s1 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(State[1]));
+			this->s2 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(State[2]));
+			this->s3 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(State[3]));
+		}
+
+		GLM_FUNC_QUALIFIER void store(uint32 State[4][random_engine::lanes]) const
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(State[0]), this->s0);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(State[1]), this->s1);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(State[2]), this->s2);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(State[3]), this->s3);
+		}
+
+		GLM_FUNC_QUALIFIER __m256i step()
+		{
+			__m256i const Result = _mm256_add_epi32(this->s0, this->s3);
+			__m256i const t = _mm256_slli_epi32(this->s1, 9);
+			this->s2 = _mm256_xor_si256(this->s2, this->s0);
+			this->s3 = _mm256_xor_si256(this->s3, this->s1);
+			this->s1 = _mm256_xor_si256(this->s1, this->s2);
+			this->s0 = _mm256_xor_si256(this->s0, this->s3);
+			this->s2 = _mm256_xor_si256(this->s2, t);
+			this->s3 = _mm256_or_si256(_mm256_slli_epi32(this->s3, 11), _mm256_srli_epi32(this->s3, 21));
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER void next(uint32* Out)
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out), this->step());
+		}
+
+		GLM_FUNC_QUALIFIER void next(float* Out)
+		{
+			_mm256_storeu_ps(Out, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(this->step(), 8)), _mm256_set1_ps(1.0f / 16777216.0f)));
+		}
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Lanes 0 to 3 in s[0], 4 to 7 in s[1]
+	struct random_sse2
+	{
+		__m128i s[2][4];
+
+		GLM_FUNC_QUALIFIER void load(uint32 const State[4][random_engine::lanes])
+		{
+			for(int h = 0; h < 2; ++h)
+			for(int w = 0; w < 4; ++w)
+				this->s[h][w] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(State[w] + h * 4));
+		}
+
+		GLM_FUNC_QUALIFIER void store(uint32 State[4][random_engine::lanes]) const
+		{
+			for(int h = 0; h < 2; ++h)
+			for(int w = 0; w < 4; ++w)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(State[w] + h * 4), this->s[h][w]);
+		}
+
+		GLM_FUNC_QUALIFIER __m128i step(int h)
+		{
+			__m128i const Result = _mm_add_epi32(this->s[h][0], this->s[h][3]);
+			__m128i const t = _mm_slli_epi32(this->s[h][1], 9);
+			this->s[h][2] = _mm_xor_si128(this->s[h][2], this->s[h][0]);
+			this->s[h][3] = _mm_xor_si128(this->s[h][3], this->s[h][1]);
+			this->s[h][1] = _mm_xor_si128(this->s[h][1], this->s[h][2]);
+			this->s[h][0] = _mm_xor_si128(this->s[h][0], this->s[h][3]);
+			this->s[h][2] = _mm_xor_si128(this->s[h][2], t);
+			this->s[h][3] = _mm_or_si128(_mm_slli_epi32(this->s[h][3], 11), _mm_srli_epi32(this->s[h][3], 21));
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER void next(uint32* Out)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), this->step(0));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + 4), this->step(1));
+		}
+
+		GLM_FUNC_QUALIFIER void next(float* Out)
+		{
+			__m128 const Scale = _mm_set1_ps(1.0f / 16777216.0f);
+			_mm_storeu_ps(Out, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(this->step(0), 8)), Scale));
+			_mm_storeu_ps(Out + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(this->step(1), 8)), Scale));
+		}
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_NEON_BIT
+	// Lanes 0 to 3 in s[0], 4 to 7 in s[1]
+	struct random_neon
+	{
+		uint32x4_t s[2][4];
+
+		GLM_FUNC_QUALIFIER void load(uint32 const State[4][random_engine::lanes])
+		{
+			for(int h = 0; h < 2; ++h)
+			for(int w = 0; w < 4; ++w)
+				this->s[h][w] = vld1q_u32(State[w] + h * 4);
+		}
+
+		GLM_FUNC_QUALIFIER void store(uint32 State[4][random_engine::lanes]) const
+		{
+			for(int h = 0; h < 2; ++h)
+			for(int w = 0; w < 4; ++w)
+				vst1q_u32(State[w] + h * 4, this->s[h][w]);
+		}
+
+		GLM_FUNC_QUALIFIER uint32x4_t step(int h)
+		{
+			uint32x4_t const Result = vaddq_u32(this->s[h][0], this->s[h][3]);
+			uint32x4_t const t = vshlq_n_u32(this->s[h][1], 9);
+			this->s[h][2] = veorq_u32(this->s[h][2], this->s[h][0]);
+			this->s[h][3] = veorq_u32(this->s[h][3], this->s[h][1]);
+			this->s[h][1] = veorq_u32(this->s[h][1], this->s[h][2]);
+			this->s[h][0] = veorq_u32(this->s[h][0], this->s[h][3]);
+			this->s[h][2] = veorq_u32(this->s[h][2], t);
+			this->s[h][3] = vorrq_u32(vshlq_n_u32(this->s[h][3], 11), vshrq_n_u32(this->s[h][3], 21));
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER void next(uint32* Out)
+		{
+			vst1q_u32(Out, this->step(0));
+			vst1q_u32(Out + 4, this->step(1));
+		}
+
+		GLM_FUNC_QUALIFIER void next(float* Out)
+		{
+			float32x4_t const Scale = vdupq_n_f32(1.0f / 16777216.0f);
+			vst1q_f32(Out, vmulq_f32(vcvtq_f32_u32(vshrq_n_u32(this->step(0), 8)), Scale));
+			vst1q_f32(Out + 4, vmulq_f32(vcvtq_f32_u32(vshrq_n_u32(this->step(1), 8)), Scale));
+		}
+	};
+#	endif
+
+	// Fastest generator available at compile time
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		typedef random_avx2 random_native;
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+		typedef random_sse2 random_native;
+#	elif GLM_ARCH & GLM_ARCH_NEON_BIT
+		typedef random_neon random_native;
+#	else
+		typedef random_scalar random_native;
+#	endif
+
+	// Writes 'Blocks' steps of the generators, keeping their state in registers meanwhile
+	template<typename G, typename genType>
+	GLM_FUNC_QUALIFIER void random_fill(uint32 State[4][random_engine::lanes], genType* Out, std::size_t Blocks)
+	{
+		G Generator;
+		Generator.load(State);
+		for(std::size_t b = 0; b < Blocks; ++b)
+			Generator.next(Out + b * random_engine::lanes);
+		Generator.store(State);
+	}
+
+	// Uniform values in [0, 1) drawn from the engine by chunks, for the rejection methods
+	template<typename T>
+	class random_uniform
+	{
+	public:
+		GLM_FUNC_QUALIFIER explicit random_uniform(random_engine& engine)
+			: Engine(engine)
+			, Next(chunk)
+		{}
+
+		GLM_FUNC_QUALIFIER T operator()()
+		{
+			if(this->Next == chunk)
+			{
+				this->Engine.generate(this->Values, chunk);
+				this->Next = 0;
+			}
+			return this->Values[this->Next++];
+		}
+
+		// Uniform in [-1, 1)
+		GLM_FUNC_QUALIFIER T signed_value()
+		{
+			return (*this)() * static_cast<T>(2) - static_cast<T>(1);
+		}
+
+	private:
+		enum { chunk = 256 };
+
+		random_engine& Engine;
+		T Values[chunk];
+		std::size_t Next;
+	};
+
+	// Marsaglia polar method, the one of the GLM_GTC_random gaussRand, keeping both values
+	// of each accepted pair
+	template<typename T>
+	class random_gauss
+	{
+	public:
+		GLM_FUNC_QUALIFIER explicit random_gauss(random_engine& engine)
+			: Uniform(engine)
+			, Spare(static_cast<T>(0))
+			, HasSpare(false)
+		{}
+
+		GLM_FUNC_QUALIFIER T operator()()
+		{
+			if(this->HasSpare)
+			{
+				this->HasSpare = false;
+				return this->Spare;
+			}
+
+			T x, y, w;
+			do
+			{
+				x = this->Uniform.signed_value();
+				y = this->Uniform.signed_value();
+				w = x * x + y * y;
+			} while(w >= static_cast<T>(1) || w <= static_cast<T>(0));
+
+			T const Scale = sqrt(static_cast<T>(-2) * log(w) / w);
+			this->Spare = x * Scale;
+			this->HasSpare = true;
+			return y * Scale;
+		}
+
+	private:
+		random_uniform<T> Uniform;
+		T Spare;
+		bool HasSpare;
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER random_engine::random_engine(uint64 seed)
+	{
+		this->seed(seed);
+	}
+
+	GLM_FUNC_QUALIFIER void random_engine::seed(uint64 seed)
+	{
+		uint64 x = seed;
+		for(std::size_t k = 0; k < lanes; ++k)
+		for(std::size_t w = 0; w < 4; w += 2)
+		{
+			uint64 const z = detail::random_splitmix64(x);
+			this->State[w][k] = static_cast<uint32>(z);
+			this->State[w + 1][k] = static_cast<uint32>(z >> 32);
+		}
+		this->Available = 0;
+	}
+
+	GLM_FUNC_QUALIFIER uint32 random_engine::next_buffered()
+	{
+		if(this->Available == 0)
+		{
+			detail::random_fill<detail::random_native>(this->State, this->Buffer, 1);
+			this->Available = lanes;
+		}
+		return this->Buffer[lanes - this->Available--];
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void random_engine::generate_values(genType* out, std::size_t count)
+	{
+		// Values left by the previous call come first, so that the sequence doesn't depend on
+		// how it is split between calls
+		std::size_t i = 0;
+		for(; i < count && this->Available > 0; ++i)
+			detail::random_convert(this->next_buffered(), out[i]);
+
+		std::size_t const Blocks = (count - i) / lanes;
+		detail::random_fill<detail::random_native>(this->State, out + i, Blocks);
+		i += Blocks * lanes;
+
+		for(; i < count; ++i)
+			detail::random_convert(this->next_buffered(), out[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void random_engine::generate(uint32* out, std::size_t count)
+	{
+		this->generate_values(out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void random_engine::generate(float* out, std::size_t count)
+	{
+		this->generate_values(out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void random_engine::generate(double* out, std::size_t count)
+	{
+		uint32 Values[512];
+		for(std::size_t i = 0; i < count; i += 256)
+		{
+			std::size_t const Size = count - i < 256 ? count - i : 256;
+			this->generate_values(Values, Size * 2);
+			for(std::size_t k = 0; k < Size; ++k)
+				out[i + k] = detail::random_double(Values[k * 2], Values[k * 2 + 1]);
+		}
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void linearRand(random_engine& engine, T Min, T Max, T* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'linearRand' only accept floating-point inputs");
+
+		engine.generate(out, count);
+		T const Range = Max - Min;
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = Min + Range * out[i];
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void linearRand(random_engine& engine, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, vec<L, T, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'linearRand' only accept floating-point inputs");
+
+		// The components are drawn in bulk, then scattered to the possibly padded vectors
+		T Values[256 * L];
+		vec<L, T, Q> const Range(Max - Min);
+		for(std::size_t i = 0; i < count; i += 256)
+		{
+			std::size_t const Size = count - i < 256 ? count - i : 256;
+			engine.generate(Values, Size * L);
+			for(std::size_t k = 0; k < Size; ++k)
+			for(length_t c = 0; c < L; ++c)
+				out[i + k][c] = Min[c] + Range[c] * Values[k * L + static_cast<std::size_t>(c)];
+		}
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void gaussRand(random_engine& engine, T Mean, T Deviation, T* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'gaussRand' only accept floating-point inputs");
+
+		detail::random_gauss<T> Gauss(engine);
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = Mean + Deviation * Gauss();
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void gaussRand(random_engine& engine, vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation, vec<L, T, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'gaussRand' only accept floating-point inputs");
+
+		detail::random_gauss<T> Gauss(engine);
+		for(std::size_t i = 0; i < count; ++i)
+		for(length_t c = 0; c < L; ++c)
+			out[i][c] = Mean[c] + Deviation[c] * Gauss();
+	}
+
+	// Rejection methods, which avoid the trigonometric functions: the points are drawn in the
+	// square or cube around the disk or ball until they fall in it
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void circularRand(random_engine& engine, T Radius, vec<2, T, Q>* out, std::size_t count)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		detail::random_uniform<T> Uniform(engine);
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			T x, y, s;
+			do
+			{
+				x = Uniform.signed_value();
+				y = Uniform.signed_value();
+				s = x * x + y * y;
+			} while(s > static_cast<T>(1) || s <= static_cast<T>(0));
+
+			out[i] = vec<2, T, Q>(x, y) * (Radius / sqrt(s));
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void sphericalRand(random_engine& engine, T Radius, vec<3, T, Q>* out, std::size_t count)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		// Marsaglia: a point of the unit disk maps to the sphere
+		detail::random_uniform<T> Uniform(engine);
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			T x, y, s;
+			do
+			{
+				x = Uniform.signed_value();
+				y = Uniform.signed_value();
+				s = x * x + y * y;
+			} while(s >= static_cast<T>(1));
+
+			T const Scale = static_cast<T>(2) * sqrt(static_cast<T>(1) - s);
+			out[i] = vec<3, T, Q>(x * Scale, y * Scale, static_cast<T>(1) - static_cast<T>(2) * s) * Radius;
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void diskRand(random_engine& engine, T Radius, vec<2, T, Q>* out, std::size_t count)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		detail::random_uniform<T> Uniform(engine);
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			T x, y;
+			do
+			{
+				x = Uniform.signed_value();
+				y = Uniform.signed_value();
+			} while(x * x + y * y > static_cast<T>(1));
+
+			out[i] = vec<2, T, Q>(x, y) * Radius;
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void ballRand(random_engine& engine, T Radius, vec<3, T, Q>* out, std::size_t count)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		detail::random_uniform<T> Uniform(engine);
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			T x, y, z;
+			do
+			{
+				x = Uniform.signed_value();
+				y = Uniform.signed_value();
+				z = Uniform.signed_value();
+			} while(x * x + y * y + z * z > static_cast<T>(1));
+
+			out[i] = vec<3, T, Q>(x, y, z) * Radius;
+		}
+	}
+}//namespace glm
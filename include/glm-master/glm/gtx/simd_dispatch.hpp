@@ -0,0 +1,97 @@
+/// @ref gtx_simd_dispatch
+/// @file glm/gtx/simd_dispatch.hpp
+///
+/// @see core (dependence)
+/// @see gtx_transform_batch (dependence)
+/// @see gtx_vec_soa (dependence)
+///
+/// @defgroup gtx_simd_dispatch GLM_GTX_simd_dispatch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/simd_dispatch.hpp> to use the features of this extension.
+///
+/// Runtime selection of the instruction set used by bulk functions.
+/// GLM_FORCE_SSE2, GLM_FORCE_AVX2, etc. pick the instruction set at compile time, so a binary
+/// built for AVX2 crashes on older CPUs and a binary built for SSE2 never uses AVX2.
+/// The functions of the glm::dispatch namespace instead detect the CPU with cpuid the first time
+/// they are called and go through a table of function pointers to the SSE2, SSE4.1, AVX2 or AVX-512
+/// kernels. The kernels are compiled with per function target attributes, so no compiler option is needed.
+/// On other architectures, every level runs the code selected at compile time.
+
+#pragma once
+
+// Dependencies:
+#include "../glm.hpp"
+#include "../gtx/transform_batch.hpp"
+#include "../gtx/vec_soa.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_simd_dispatch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_simd_dispatch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_simd_dispatch
+	/// @{
+
+	/// Instruction set levels, from the slowest to the fastest.
+	/// @see gtx_simd_dispatch
+	enum simd_level
+	{
+		simd_level_none,	///< Code selected at compile time by GLM_ARCH
+		simd_level_sse2,
+		simd_level_sse41,
+		simd_level_avx2,	///< AVX2 and FMA
+		simd_level_avx512,	///< AVX-512 F
+		simd_level_count
+	};
+
+	/// Returns the highest level supported by the CPU and the operating system.
+	/// @see gtx_simd_dispatch
+	GLM_FUNC_DECL simd_level simd_level_supported();
+
+	/// Returns the level currently used by the glm::dispatch functions.
+	/// @see gtx_simd_dispatch
+	GLM_FUNC_DECL simd_level simd_level_current();
+
+	/// Makes the glm::dispatch functions use 'level', clamped to simd_level_supported(), and returns the level used.
+	/// Meant for tests and benchmarks. Not thread safe: call it before other threads use the glm::dispatch functions.
+	/// @see gtx_simd_dispatch
+	GLM_FUNC_DECL simd_level simd_level_force(simd_level level);
+
+	/// Returns a printable name of 'level', e.g. "avx2".
+	/// @see gtx_simd_dispatch
+	GLM_FUNC_DECL char const* simd_level_name(simd_level level);
+
+	namespace dispatch
+	{
+		/// Computes out[i] = m * in[i] for i in [0, count).
+		/// 'in' and 'out' may point to the same array but must not otherwise overlap.
+		/// @see gtx_simd_dispatch
+		template<qualifier Q>
+		GLM_FUNC_DISCARD_DECL void transform_batch(mat<4, 4, float, Q> const& m, vec<4, float, Q> const* in, vec<4, float, Q>* out, std::size_t count);
+
+		/// Computes out[i] = m * in[i] for i in [0, count).
+		/// 'in' and 'out' may point to the same array but must not otherwise overlap.
+		/// @see gtx_simd_dispatch
+		template<qualifier Q>
+		GLM_FUNC_DISCARD_DECL void mul_batch(mat<4, 4, float, Q> const& m, mat<4, 4, float, Q> const* in, mat<4, 4, float, Q>* out, std::size_t count);
+
+		/// Computes out[i] = inverse(in[i]) for i in [0, count).
+		/// 'in' and 'out' may point to the same array but must not otherwise overlap.
+		/// @see gtx_simd_dispatch
+		template<qualifier Q>
+		GLM_FUNC_DISCARD_DECL void inverse_batch(mat<4, 4, float, Q> const* in, mat<4, 4, float, Q>* out, std::size_t count);
+
+		/// out[i] = dot(x[i], y[i]). 'out' must have room for x.size() values.
+		/// @see gtx_simd_dispatch
+		template<length_t L>
+		GLM_FUNC_DISCARD_DECL void dot(vec_soa<L, float> const& x, vec_soa<L, float> const& y, float* out);
+	}//namespace dispatch
+
+	/// @}
+}//namespace glm
+
+#include "simd_dispatch.inl"
@@ -0,0 +1,390 @@
+/// @ref gtx_simd_dispatch
+
+#if (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)) && \
+	!(GLM_COMPILER & (GLM_COMPILER_CUDA | GLM_COMPILER_HIP)) && \
+	(GLM_COMPILER & (GLM_COMPILER_VC | GLM_COMPILER_GCC | GLM_COMPILER_CLANG))
+#	define GLM_DISPATCH_X86
+#	if GLM_COMPILER & GLM_COMPILER_VC
+#		include <intrin.h>
+#		include <immintrin.h>
+		// Visual C++ accepts any intrinsic in any function
+#		define GLM_DISPATCH_TARGET(Features)
+#	else
+#		include <cpuid.h>
+#		include <immintrin.h>
+#		define GLM_DISPATCH_TARGET(Features) __attribute__((target(Features)))
+#	endif
+#	include "../simd/matrix.h"
+	// simd/matrix.h only has the AVX-512 inverse when GLM_ARCH includes AVX-512: otherwise build it for its own target
+#	if !(GLM_ARCH & GLM_ARCH_AVX512_BIT)
+#		define GLM_FUNC_AVX512_QUALIFIER GLM_DISPATCH_TARGET("avx512f") inline
+#		include "../simd/matrix_avx512.inl"
+#	endif
+#endif
+
+namespace glm{
+namespace detail
+{
+	// Kernels work on raw floats: column major mat4 are 16 floats and vec4 are 4 floats.
+	struct simd_dispatch_table
+	{
+		void (*transform_batch)(float const* m, float const* in, float* out, std::size_t count);
+		void (*inverse_batch)(float const* in, float* out, std::size_t count);
+		void (*soa_dot)(float const* const* x, float const* const* y, length_t components, float* out, std::size_t count);
+	};
+
+	// The kernels are plain inline functions rather than GLM_FUNC_QUALIFIER ones:
+	// they are only called through the dispatch table, so forcing them inline is pointless.
+
+	inline void simd_transform_batch_none(float const* m, float const* in, float* out, std::size_t count)
+	{
+		transform_batch(*reinterpret_cast<mat<4, 4, float, packed_highp> const*>(m), reinterpret_cast<vec<4, float, packed_highp> const*>(in), reinterpret_cast<vec<4, float, packed_highp>*>(out), count);
+	}
+
+	inline void simd_inverse_batch_none(float const* in, float* out, std::size_t count)
+	{
+		mat<4, 4, float, packed_highp> const* In = reinterpret_cast<mat<4, 4, float, packed_highp> const*>(in);
+		mat<4, 4, float, packed_highp>* Out = reinterpret_cast<mat<4, 4, float, packed_highp>*>(out);
+		for(std::size_t i = 0; i < count; ++i)
+			Out[i] = inverse(In[i]);
+	}
+
+	// Vectors [first, count), for the tails of the SIMD kernels
+	inline void simd_soa_dot_scalar(float const* const* x, float const* const* y, length_t components, float* out, std::size_t first, std::size_t count)
+	{
+		for(std::size_t i = first; i < count; ++i)
+		{
+			float Result = x[0][i] * y[0][i];
+			for(length_t c = 1; c < components; ++c)
+				Result += x[c][i] * y[c][i];
+			out[i] = Result;
+		}
+	}
+
+	inline void simd_soa_dot_none(float const* const* x, float const* const* y, length_t components, float* out, std::size_t count)
+	{
+		simd_soa_dot_scalar(x, y, components, out, 0, count);
+	}
+
+#	ifdef GLM_DISPATCH_X86
+	inline void simd_cpuid(unsigned int Leaf, unsigned int SubLeaf, unsigned int Regs[4])
+	{
+#		if GLM_COMPILER & GLM_COMPILER_VC
+			int Info[4];
+			__cpuidex(Info, static_cast<int>(Leaf), static_cast<int>(SubLeaf));
+			for(int i = 0; i < 4; ++i)
+				Regs[i] = static_cast<unsigned int>(Info[i]);
+#		else
+			__cpuid_count(Leaf, SubLeaf, Regs[0], Regs[1], Regs[2], Regs[3]);
+#		endif
+	}
+
+	// XCR0: the register states the operating system saves on context switches. Only valid with OSXSAVE.
+	inline uint64 simd_xgetbv()
+	{
+#		if GLM_COMPILER & GLM_COMPILER_VC
+			return _xgetbv(0);
+#		else
+			unsigned int Eax, Edx;
+			__asm__ __volatile__("xgetbv" : "=a"(Eax), "=d"(Edx) : "c"(0));
+			return (static_cast<uint64>(Edx) << 32) | Eax;
+#		endif
+	}
+
+	inline simd_level simd_level_detect()
+	{
+		unsigned int Regs[4];
+		simd_cpuid(0, 0, Regs);
+		unsigned int const MaxLeaf = Regs[0];
+		if(MaxLeaf < 1)
+			return simd_level_none;
+
+		simd_cpuid(1, 0, Regs);
+		unsigned int const Ecx1 = Regs[2];
+		unsigned int const Edx1 = Regs[3];
+		if(!(Edx1 & (1u << 26)))
+			return simd_level_none;
+		if(!(Ecx1 & (1u << 19)))
+			return simd_level_sse2;
+
+		// AVX also needs the operating system to save the YMM registers
+		bool const OSXSAVE = (Ecx1 & (1u << 27)) != 0;
+		bool const AVX = (Ecx1 & (1u << 28)) != 0;
+		bool const FMA = (Ecx1 & (1u << 12)) != 0;
+		if(!OSXSAVE || !AVX || !FMA || MaxLeaf < 7)
+			return simd_level_sse41;
+		uint64 const XCR0 = simd_xgetbv();
+		if((XCR0 & 0x6) != 0x6)
+			return simd_level_sse41;
+
+		simd_cpuid(7, 0, Regs);
+		if(!(Regs[1] & (1u << 5)))
+			return simd_level_sse41;
+
+		// AVX-512 also needs the opmask and ZMM states
+		if(!(Regs[1] & (1u << 16)) || (XCR0 & 0xE6) != 0xE6)
+			return simd_level_avx2;
+		return simd_level_avx512;
+	}
+
+	// VVVV SSE2 VVVV
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// The simd/matrix.h kernels behind glm::transform_batch and glm::inverse, so the results match theirs.
+	// They use the widest instructions GLM_ARCH allows, which the whole program requires anyway.
+	inline void simd_transform_batch_sse2(float const* m, float const* in, float* out, std::size_t count)
+	{
+		glm_vec4 const Columns[4] = {_mm_loadu_ps(m + 0), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12)};
+		glm_mat4_mul_vec4_batch(Columns, in, out, count);
+	}
+
+	inline void simd_inverse_batch_sse2(float const* in, float* out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			glm_vec4 const In[4] = {_mm_loadu_ps(in + i * 16 + 0), _mm_loadu_ps(in + i * 16 + 4), _mm_loadu_ps(in + i * 16 + 8), _mm_loadu_ps(in + i * 16 + 12)};
+			glm_vec4 Out[4];
+			glm_mat4_inverse(In, Out);
+			for(std::size_t c = 0; c < 4; ++c)
+				_mm_storeu_ps(out + i * 16 + c * 4, Out[c]);
+		}
+	}
+#	else
+	// simd/matrix.h is empty without SSE2 in GLM_ARCH, so this level runs the portable kernels
+	inline void simd_transform_batch_sse2(float const* m, float const* in, float* out, std::size_t count)
+	{
+		simd_transform_batch_none(m, in, out, count);
+	}
+
+	inline void simd_inverse_batch_sse2(float const* in, float* out, std::size_t count)
+	{
+		simd_inverse_batch_none(in, out, count);
+	}
+#	endif
+
+	GLM_DISPATCH_TARGET("sse2") inline void simd_soa_dot_sse2(float const* const* x, float const* const* y, length_t components, float* out, std::size_t count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			__m128 Result = _mm_mul_ps(_mm_loadu_ps(x[0] + i), _mm_loadu_ps(y[0] + i));
+			for(length_t c = 1; c < components; ++c)
+				Result = _mm_add_ps(Result, _mm_mul_ps(_mm_loadu_ps(x[c] + i), _mm_loadu_ps(y[c] + i)));
+			_mm_storeu_ps(out + i, Result);
+		}
+		simd_soa_dot_scalar(x, y, components, out, i, count);
+	}
+
+	// ^^^^ SSE2 ^^^^
+
+	// VVVV AVX2 VVVV
+
+	// Two vectors per __m256, eight per iteration.
+	GLM_DISPATCH_TARGET("avx2,fma") inline void simd_transform_batch_avx2(float const* m, float const* in, float* out, std::size_t count)
+	{
+		__m256 const c0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 0));
+		__m256 const c1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 4));
+		__m256 const c2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 8));
+		__m256 const c3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 12));
+
+		std::size_t i = 0;
+		for(; i + 8 <= count; i += 8)
+		{
+			for(std::size_t j = 0; j < 8; j += 2)
+			{
+				__m256 const v = _mm256_loadu_ps(in + (i + j) * 4);
+				__m256 r = _mm256_mul_ps(c0, _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+				r = _mm256_fmadd_ps(c1, _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+				r = _mm256_fmadd_ps(c2, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+				r = _mm256_fmadd_ps(c3, _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+				_mm256_storeu_ps(out + (i + j) * 4, r);
+			}
+		}
+		for(; i < count; ++i)
+		{
+			__m128 const v = _mm_loadu_ps(in + i * 4);
+			__m128 r = _mm_mul_ps(_mm256_castps256_ps128(c0), _mm_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+			r = _mm_fmadd_ps(_mm256_castps256_ps128(c1), _mm_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+			r = _mm_fmadd_ps(_mm256_castps256_ps128(c2), _mm_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+			r = _mm_fmadd_ps(_mm256_castps256_ps128(c3), _mm_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+			_mm_storeu_ps(out + i * 4, r);
+		}
+	}
+
+	GLM_DISPATCH_TARGET("avx2,fma") inline void simd_soa_dot_avx2(float const* const* x, float const* const* y, length_t components, float* out, std::size_t count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= count; i += 8)
+		{
+			__m256 Result = _mm256_mul_ps(_mm256_loadu_ps(x[0] + i), _mm256_loadu_ps(y[0] + i));
+			for(length_t c = 1; c < components; ++c)
+				Result = _mm256_fmadd_ps(_mm256_loadu_ps(x[c] + i), _mm256_loadu_ps(y[c] + i), Result);
+			_mm256_storeu_ps(out + i, Result);
+		}
+		simd_soa_dot_scalar(x, y, components, out, i, count);
+	}
+
+	// ^^^^ AVX2 ^^^^
+
+	// VVVV AVX-512 VVVV
+
+	// GCC 12 reports the _mm512_undefined_ps() used by its AVX-512 intrinsics as uninitialized once inlined
+#	if GLM_COMPILER & GLM_COMPILER_GCC
+#		pragma GCC diagnostic push
+#		pragma GCC diagnostic ignored "-Wuninitialized"
+#		pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#	endif
+
+	// Four vectors per __m512. The last partial register uses masked loads and stores.
+	GLM_DISPATCH_TARGET("avx512f") inline void simd_transform_batch_avx512(float const* m, float const* in, float* out, std::size_t count)
+	{
+		__m512 const c0 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 0));
+		__m512 const c1 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 4));
+		__m512 const c2 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 8));
+		__m512 const c3 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 12));
+
+		for(std::size_t i = 0; i < count; i += 4)
+		{
+			__mmask16 const Mask = count - i >= 4 ? static_cast<__mmask16>(0xFFFF) : static_cast<__mmask16>((1u << ((count - i) * 4)) - 1u);
+			__m512 const v = _mm512_maskz_loadu_ps(Mask, in + i * 4);
+			__m512 r = _mm512_mul_ps(c0, _mm512_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+			r = _mm512_fmadd_ps(c1, _mm512_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+			r = _mm512_fmadd_ps(c2, _mm512_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+			r = _mm512_fmadd_ps(c3, _mm512_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+			_mm512_mask_storeu_ps(out + i * 4, Mask, r);
+		}
+	}
+
+	// One matrix per call: glm_mat4_inverse_avx512 is built for the AVX-512 target above when GLM_ARCH lacks it
+	GLM_DISPATCH_TARGET("avx512f") inline void simd_inverse_batch_avx512(float const* in, float* out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			glm_mat4_inverse_avx512(reinterpret_cast<__m128 const*>(in + i * 16), reinterpret_cast<__m128*>(out + i * 16));
+	}
+
+	GLM_DISPATCH_TARGET("avx512f") inline void simd_soa_dot_avx512(float const* const* x, float const* const* y, length_t components, float* out, std::size_t count)
+	{
+		std::size_t i = 0;
+		for(; i + 16 <= count; i += 16)
+		{
+			__m512 Result = _mm512_mul_ps(_mm512_loadu_ps(x[0] + i), _mm512_loadu_ps(y[0] + i));
+			for(length_t c = 1; c < components; ++c)
+				Result = _mm512_fmadd_ps(_mm512_loadu_ps(x[c] + i), _mm512_loadu_ps(y[c] + i), Result);
+			_mm512_storeu_ps(out + i, Result);
+		}
+		simd_soa_dot_scalar(x, y, components, out, i, count);
+	}
+
+#	if GLM_COMPILER & GLM_COMPILER_GCC
+#		pragma GCC diagnostic pop
+#	endif
+
+	// ^^^^ AVX-512 ^^^^
+#	endif//GLM_DISPATCH_X86
+
+	inline simd_dispatch_table const& simd_dispatch_table_get(simd_level Level)
+	{
+		// simd_level_sse41 shares the SSE2 kernels until some kernel benefits from SSE4.1.
+		// There is no AVX2 inverse: with two columns per __m256, gathering the sub-factors takes
+		// more lane crossing permutes than the SSE2 version spends on shuffles and arithmetic together.
+		static simd_dispatch_table const Tables[simd_level_count] =
+		{
+			{simd_transform_batch_none, simd_inverse_batch_none, simd_soa_dot_none},
+#		ifdef GLM_DISPATCH_X86
+			{simd_transform_batch_sse2, simd_inverse_batch_sse2, simd_soa_dot_sse2},
+			{simd_transform_batch_sse2, simd_inverse_batch_sse2, simd_soa_dot_sse2},
+			{simd_transform_batch_avx2, simd_inverse_batch_sse2, simd_soa_dot_avx2},
+			{simd_transform_batch_avx512, simd_inverse_batch_avx512, simd_soa_dot_avx512}
+#		else
+			{simd_transform_batch_none, simd_inverse_batch_none, simd_soa_dot_none},
+			{simd_transform_batch_none, simd_inverse_batch_none, simd_soa_dot_none},
+			{simd_transform_batch_none, simd_inverse_batch_none, simd_soa_dot_none},
+			{simd_transform_batch_none, simd_inverse_batch_none, simd_soa_dot_none}
+#		endif
+		};
+		return Tables[Level];
+	}
+
+	inline simd_level& simd_level_state()
+	{
+		static simd_level Level = simd_level_supported();
+		return Level;
+	}
+
+	inline simd_dispatch_table const& simd_dispatch_table_current()
+	{
+		return simd_dispatch_table_get(simd_level_state());
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER simd_level simd_level_supported()
+	{
+#		ifdef GLM_DISPATCH_X86
+			static simd_level const Level = detail::simd_level_detect();
+			return Level;
+#		else
+			return simd_level_none;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER simd_level simd_level_current()
+	{
+		return detail::simd_level_state();
+	}
+
+	GLM_FUNC_QUALIFIER simd_level simd_level_force(simd_level level)
+	{
+		simd_level const Supported = simd_level_supported();
+		detail::simd_level_state() = level < Supported ? level : Supported;
+		return detail::simd_level_state();
+	}
+
+	GLM_FUNC_QUALIFIER char const* simd_level_name(simd_level level)
+	{
+		static char const* const Names[simd_level_count] = {"none", "sse2", "sse41", "avx2", "avx512"};
+		return level >= simd_level_none && level < simd_level_count ? Names[level] : "unknown";
+	}
+
+namespace dispatch
+{
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void transform_batch(mat<4, 4, float, Q> const& m, vec<4, float, Q> const* in, vec<4, float, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(sizeof(vec<4, float, Q>) == sizeof(float) * 4, "'vec4' must be tightly packed");
+
+		detail::simd_dispatch_table_current().transform_batch(&m[0][0], reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+	}
+
+	// out[i] = m * in[i] transforms each column of in[i] by m, so this is transform_batch on 4 * count columns.
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void mul_batch(mat<4, 4, float, Q> const& m, mat<4, 4, float, Q> const* in, mat<4, 4, float, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(sizeof(mat<4, 4, float, Q>) == sizeof(float) * 16, "'mat4' must be tightly packed");
+
+		detail::simd_dispatch_table_current().transform_batch(&m[0][0], reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count * 4);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void inverse_batch(mat<4, 4, float, Q> const* in, mat<4, 4, float, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(sizeof(mat<4, 4, float, Q>) == sizeof(float) * 16, "'mat4' must be tightly packed");
+
+		detail::simd_dispatch_table_current().inverse_batch(reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+	}
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER void dot(vec_soa<L, float> const& x, vec_soa<L, float> const& y, float* out)
+	{
+		assert(x.size() == y.size());
+
+		float const* X[L];
+		float const* Y[L];
+		for(length_t c = 0; c < L; ++c)
+		{
+			X[c] = x[c];
+			Y[c] = y[c];
+		}
+		detail::simd_dispatch_table_current().soa_dot(X, Y, L, out, x.size());
+	}
+}//namespace dispatch
+}//namespace glm
@@ -0,0 +1,75 @@
+/// @ref gtx_transcendental_batch
+/// @file glm/gtx/transcendental_batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_transcendental_batch GLM_GTX_transcendental_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/transcendental_batch.hpp> to use the features of this extension.
+///
+/// Trigonometric, exponential and logarithmic functions of float arrays.
+/// The values are processed 4 at a time with SSE2 or NEON and 8 at a time with AVX2, using the
+/// polynomial approximations of glm/simd/trigonometric.h and glm/simd/exponential.h, whose
+/// documented ulp bounds apply. Without SIMD, the C library functions are called.
+
+#pragma once
+
+// Dependencies:
+#include "../glm.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_transcendental_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_transcendental_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_transcendental_batch
+	/// @{
+
+	/// Computes out[i] = sin(in[i]) for i in [0, count).
+	/// @see gtx_transcendental_batch
+	GLM_FUNC_DISCARD_DECL void sin(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = cos(in[i]) for i in [0, count).
+	/// @see gtx_transcendental_batch
+	GLM_FUNC_DISCARD_DECL void cos(float const* in, float* out, std::size_t count);
+
+	/// Computes outSin[i] = sin(in[i]) and outCos[i] = cos(in[i]) for i in [0, count), sharing the argument reduction.
+	/// @see gtx_transcendental_batch
+	GLM_FUNC_DISCARD_DECL void sincos(float const* in, float* outSin, float* outCos, std::size_t count);
+
+	/// Computes out[i] = tan(in[i]) for i in [0, count).
+	/// @see gtx_transcendental_batch
+	GLM_FUNC_DISCARD_DECL void tan(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = atan(y[i], x[i]) for i in [0, count).
+	/// @see gtx_transcendental_batch
+	GLM_FUNC_DISCARD_DECL void atan(float const* y, float const* x, float* out, std::size_t count);
+
+	/// Computes out[i] = exp(in[i]) for i in [0, count).
+	/// @see gtx_transcendental_batch
+	GLM_FUNC_DISCARD_DECL void exp(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = exp2(in[i]) for i in [0, count).
+	/// @see gtx_transcendental_batch
+	GLM_FUNC_DISCARD_DECL void exp2(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = log(in[i]) for i in [0, count).
+	/// @see gtx_transcendental_batch
+	GLM_FUNC_DISCARD_DECL void log(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = log2(in[i]) for i in [0, count).
+	/// @see gtx_transcendental_batch
+	GLM_FUNC_DISCARD_DECL void log2(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = pow(base[i], exponent[i]) for i in [0, count).
+	/// @see gtx_transcendental_batch
+	GLM_FUNC_DISCARD_DECL void pow(float const* base, float const* exponent, float* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "transcendental_batch.inl"
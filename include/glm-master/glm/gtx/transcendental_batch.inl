@@ -0,0 +1,213 @@
+/// @ref gtx_transcendental_batch
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_ARMV8_BIT)
+#	include "../simd/trigonometric.h"
+#	include "../simd/exponential.h"
+#endif
+#include <cmath>
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		typedef __m256 transcendental_batch_type;
+#		define GLM_TRANSCENDENTAL_BATCH_WIDTH 8
+#	elif (GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_ARMV8_BIT)
+		typedef glm_f32vec4 transcendental_batch_type;
+#		define GLM_TRANSCENDENTAL_BATCH_WIDTH 4
+#	else
+		typedef float transcendental_batch_type;
+#		define GLM_TRANSCENDENTAL_BATCH_WIDTH 1
+#	endif
+
+	GLM_FUNC_QUALIFIER transcendental_batch_type transcendental_batch_load(float const* p)
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			return _mm256_loadu_ps(p);
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			return _mm_loadu_ps(p);
+#		elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+			return vld1q_f32(p);
+#		else
+			return *p;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void transcendental_batch_store(float* p, transcendental_batch_type v)
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			_mm256_storeu_ps(p, v);
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			_mm_storeu_ps(p, v);
+#		elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+			vst1q_f32(p, v);
+#		else
+			*p = v;
+#		endif
+	}
+
+	// One struct per function, computing a register of values
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#		define GLM_TRANSCENDENTAL_BATCH_KERNEL(Name, Vector, Scalar) \
+			struct transcendental_##Name { GLM_FUNC_QUALIFIER static __m256 call(__m256 x) { return glm_vec8_##Vector(x); } };
+#		define GLM_TRANSCENDENTAL_BATCH_KERNEL2(Name, Vector, Scalar) \
+			struct transcendental_##Name { GLM_FUNC_QUALIFIER static __m256 call(__m256 a, __m256 b) { return glm_vec8_##Vector(a, b); } };
+#	elif (GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_ARMV8_BIT)
+#		define GLM_TRANSCENDENTAL_BATCH_KERNEL(Name, Vector, Scalar) \
+			struct transcendental_##Name { GLM_FUNC_QUALIFIER static glm_f32vec4 call(glm_f32vec4 x) { return glm_vec4_##Vector(x); } };
+#		define GLM_TRANSCENDENTAL_BATCH_KERNEL2(Name, Vector, Scalar) \
+			struct transcendental_##Name { GLM_FUNC_QUALIFIER static glm_f32vec4 call(glm_f32vec4 a, glm_f32vec4 b) { return glm_vec4_##Vector(a, b); } };
+#	else
+#		define GLM_TRANSCENDENTAL_BATCH_KERNEL(Name, Vector, Scalar) \
+			struct transcendental_##Name { GLM_FUNC_QUALIFIER static float call(float x) { return Scalar(x); } };
+#		define GLM_TRANSCENDENTAL_BATCH_KERNEL2(Name, Vector, Scalar) \
+			struct transcendental_##Name { GLM_FUNC_QUALIFIER static float call(float a, float b) { return Scalar(a, b); } };
+#	endif
+
+	GLM_TRANSCENDENTAL_BATCH_KERNEL(sin, sin, std::sin)
+	GLM_TRANSCENDENTAL_BATCH_KERNEL(cos, cos, std::cos)
+	GLM_TRANSCENDENTAL_BATCH_KERNEL(tan, tan, std::tan)
+	GLM_TRANSCENDENTAL_BATCH_KERNEL(exp, exp, std::exp)
+	GLM_TRANSCENDENTAL_BATCH_KERNEL(exp2, exp2, glm::exp2)
+	GLM_TRANSCENDENTAL_BATCH_KERNEL(log, log, std::log)
+	GLM_TRANSCENDENTAL_BATCH_KERNEL(log2, log2, glm::log2)
+	GLM_TRANSCENDENTAL_BATCH_KERNEL2(atan2, atan2, std::atan2)
+	GLM_TRANSCENDENTAL_BATCH_KERNEL2(pow, pow, std::pow)
+
+#	undef GLM_TRANSCENDENTAL_BATCH_KERNEL
+#	undef GLM_TRANSCENDENTAL_BATCH_KERNEL2
+
+	// The last values are copied to a full register padded with ones, a valid input of every
+	// function, so that they are computed by the same code as the others.
+	template<typename kernel>
+	GLM_FUNC_QUALIFIER void transcendental_batch(float const* in, float* out, std::size_t count)
+	{
+		std::size_t const Width = GLM_TRANSCENDENTAL_BATCH_WIDTH;
+
+		std::size_t i = 0;
+		for(; i + Width <= count; i += Width)
+			transcendental_batch_store(out + i, kernel::call(transcendental_batch_load(in + i)));
+
+		if(i < count)
+		{
+			float Buffer[GLM_TRANSCENDENTAL_BATCH_WIDTH];
+			for(std::size_t j = 0; j < Width; ++j)
+				Buffer[j] = i + j < count ? in[i + j] : 1.0f;
+			transcendental_batch_store(Buffer, kernel::call(transcendental_batch_load(Buffer)));
+			for(std::size_t j = 0; i + j < count; ++j)
+				out[i + j] = Buffer[j];
+		}
+	}
+
+	template<typename kernel>
+	GLM_FUNC_QUALIFIER void transcendental_batch(float const* a, float const* b, float* out, std::size_t count)
+	{
+		std::size_t const Width = GLM_TRANSCENDENTAL_BATCH_WIDTH;
+
+		std::size_t i = 0;
+		for(; i + Width <= count; i += Width)
+			transcendental_batch_store(out + i, kernel::call(transcendental_batch_load(a + i), transcendental_batch_load(b + i)));
+
+		if(i < count)
+		{
+			float BufferA[GLM_TRANSCENDENTAL_BATCH_WIDTH];
+			float BufferB[GLM_TRANSCENDENTAL_BATCH_WIDTH];
+			for(std::size_t j = 0; j < Width; ++j)
+			{
+				BufferA[j] = i + j < count ? a[i + j] : 1.0f;
+				BufferB[j] = i + j < count ? b[i + j] : 1.0f;
+			}
+			transcendental_batch_store(BufferA, kernel::call(transcendental_batch_load(BufferA), transcendental_batch_load(BufferB)));
+			for(std::size_t j = 0; i + j < count; ++j)
+				out[i + j] = BufferA[j];
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void transcendental_batch_sincos(transcendental_batch_type x, transcendental_batch_type* s, transcendental_batch_type* c)
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			glm_vec8_sincos(x, s, c);
+#		elif (GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_ARMV8_BIT)
+			glm_vec4_sincos(x, s, c);
+#		else
+			*s = std::sin(x);
+			*c = std::cos(x);
+#		endif
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void sin(float const* in, float* out, std::size_t count)
+	{
+		detail::transcendental_batch<detail::transcendental_sin>(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void cos(float const* in, float* out, std::size_t count)
+	{
+		detail::transcendental_batch<detail::transcendental_cos>(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void sincos(float const* in, float* outSin, float* outCos, std::size_t count)
+	{
+		std::size_t const Width = GLM_TRANSCENDENTAL_BATCH_WIDTH;
+
+		detail::transcendental_batch_type s, c;
+		std::size_t i = 0;
+		for(; i + Width <= count; i += Width)
+		{
+			detail::transcendental_batch_sincos(detail::transcendental_batch_load(in + i), &s, &c);
+			detail::transcendental_batch_store(outSin + i, s);
+			detail::transcendental_batch_store(outCos + i, c);
+		}
+
+		if(i < count)
+		{
+			float Buffer[GLM_TRANSCENDENTAL_BATCH_WIDTH];
+			for(std::size_t j = 0; j < Width; ++j)
+				Buffer[j] = i + j < count ? in[i + j] : 1.0f;
+			detail::transcendental_batch_sincos(detail::transcendental_batch_load(Buffer), &s, &c);
+			detail::transcendental_batch_store(Buffer, s);
+			for(std::size_t j = 0; i + j < count; ++j)
+				outSin[i + j] = Buffer[j];
+			detail::transcendental_batch_store(Buffer, c);
+			for(std::size_t j = 0; i + j < count; ++j)
+				outCos[i + j] = Buffer[j];
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void tan(float const* in, float* out, std::size_t count)
+	{
+		detail::transcendental_batch<detail::transcendental_tan>(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void atan(float const* y, float const* x, float* out, std::size_t count)
+	{
+		detail::transcendental_batch<detail::transcendental_atan2>(y, x, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void exp(float const* in, float* out, std::size_t count)
+	{
+		detail::transcendental_batch<detail::transcendental_exp>(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void exp2(float const* in, float* out, std::size_t count)
+	{
+		detail::transcendental_batch<detail::transcendental_exp2>(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void log(float const* in, float* out, std::size_t count)
+	{
+		detail::transcendental_batch<detail::transcendental_log>(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void log2(float const* in, float* out, std::size_t count)
+	{
+		detail::transcendental_batch<detail::transcendental_log2>(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void pow(float const* base, float const* exponent, float* out, std::size_t count)
+	{
+		detail::transcendental_batch<detail::transcendental_pow>(base, exponent, out, count);
+	}
+}//namespace glm
+
+#undef GLM_TRANSCENDENTAL_BATCH_WIDTH
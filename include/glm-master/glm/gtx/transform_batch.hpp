@@ -0,0 +1,40 @@
+/// @ref gtx_transform_batch
+/// @file glm/gtx/transform_batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_transform_batch GLM_GTX_transform_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/transform_batch.hpp> to use the features of this extension.
+///
+/// Transform arrays of vectors by a single matrix.
+/// For float vectors, the matrix is kept in registers and the vectors are processed
+/// 4 at a time with SSE2 or NEON, 8 at a time with AVX, followed by a scalar tail.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_transform_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_transform_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_transform_batch
+	/// @{
+
+	/// Computes out[i] = m * in[i] for i in [0, count).
+	/// 'in' and 'out' may point to the same array but must not otherwise overlap.
+	/// @see gtx_transform_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transform_batch(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "transform_batch.inl"
@@ -0,0 +1,89 @@
+/// @ref gtx_transform_batch
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/matrix.h"
+#endif
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q>
+	struct compute_transform_batch
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = m * in[i];
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	struct compute_transform_batch<float, Q>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, float, Q> const& m, vec<4, float, Q> const* in, vec<4, float, Q>* out, std::size_t count)
+		{
+			GLM_STATIC_ASSERT(sizeof(vec<4, float, Q>) == sizeof(float) * 4, "Specialization requires tightly packed vec4");
+
+			glm_vec4 const Columns[4] = {
+				_mm_loadu_ps(&m[0][0]),
+				_mm_loadu_ps(&m[1][0]),
+				_mm_loadu_ps(&m[2][0]),
+				_mm_loadu_ps(&m[3][0])};
+
+			glm_mat4_mul_vec4_batch(Columns, reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+		}
+	};
+#	elif GLM_ARCH & GLM_ARCH_NEON_BIT
+	template<qualifier Q>
+	struct compute_transform_batch<float, Q>
+	{
+		GLM_FUNC_QUALIFIER static float32x4_t mul(float32x4_t const c[4], float32x4_t v)
+		{
+			float32x4_t r = neon::mul_lane(c[0], v, 0);
+			r = neon::madd_lane(r, c[1], v, 1);
+			r = neon::madd_lane(r, c[2], v, 2);
+			r = neon::madd_lane(r, c[3], v, 3);
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, float, Q> const& m, vec<4, float, Q> const* in, vec<4, float, Q>* out, std::size_t count)
+		{
+			GLM_STATIC_ASSERT(sizeof(vec<4, float, Q>) == sizeof(float) * 4, "Specialization requires tightly packed vec4");
+
+			float32x4_t const Columns[4] = {
+				vld1q_f32(&m[0][0]),
+				vld1q_f32(&m[1][0]),
+				vld1q_f32(&m[2][0]),
+				vld1q_f32(&m[3][0])};
+
+			float const* const In = reinterpret_cast<float const*>(in);
+			float* const Out = reinterpret_cast<float*>(out);
+
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4)
+			{
+				float32x4_t const v0 = vld1q_f32(In + i * 4 + 0);
+				float32x4_t const v1 = vld1q_f32(In + i * 4 + 4);
+				float32x4_t const v2 = vld1q_f32(In + i * 4 + 8);
+				float32x4_t const v3 = vld1q_f32(In + i * 4 + 12);
+
+				vst1q_f32(Out + i * 4 + 0, mul(Columns, v0));
+				vst1q_f32(Out + i * 4 + 4, mul(Columns, v1));
+				vst1q_f32(Out + i * 4 + 8, mul(Columns, v2));
+				vst1q_f32(Out + i * 4 + 12, mul(Columns, v3));
+			}
+
+			for(; i < count; ++i)
+				vst1q_f32(Out + i * 4, mul(Columns, vld1q_f32(In + i * 4)));
+		}
+	};
+#	endif
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transform_batch(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count)
+	{
+		detail::compute_transform_batch<T, Q>::call(m, in, out, count);
+	}
+}//namespace glm
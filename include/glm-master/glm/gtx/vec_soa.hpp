@@ -0,0 +1,129 @@
+/// @ref gtx_vec_soa
+/// @file glm/gtx/vec_soa.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_vec_soa GLM_GTX_vec_soa
+/// @ingroup gtx
+///
+/// Include <glm/gtx/vec_soa.hpp> to use the features of this extension.
+///
+/// Structure of arrays (SoA) containers of vectors.
+/// A vec_soa<3, float> stores all the x components in one array, all the y components in
+/// another and so on, each array being 64 bytes aligned. Bulk functions then process
+/// as many vectors per instruction as the SIMD registers hold floats (4 with SSE2 or NEON,
+/// 8 with AVX, 16 with AVX-512) instead of wasting lanes on AoS padding or horizontal shuffles.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_vec_soa is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_vec_soa extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_vec_soa
+	/// @{
+
+	/// Structure of arrays container of L components vectors.
+	/// Each component is stored in its own 64 bytes aligned array, with capacity padded to a
+	/// multiple of 16 elements so that every array can be read with full width loads.
+	/// @see gtx_vec_soa
+	template<length_t L, typename T>
+	class vec_soa
+	{
+	public:
+		typedef T value_type;
+		typedef vec<L, T, defaultp> aos_type;
+
+		static length_t const component_count = L;
+
+		GLM_FUNC_DISCARD_DECL vec_soa();
+		GLM_FUNC_DISCARD_DECL explicit vec_soa(std::size_t size);
+		GLM_FUNC_DISCARD_DECL vec_soa(vec_soa const& v);
+		GLM_FUNC_DISCARD_DECL ~vec_soa();
+
+		GLM_FUNC_DISCARD_DECL vec_soa& operator=(vec_soa const& v);
+
+		/// Number of vectors stored.
+		GLM_FUNC_DECL std::size_t size() const;
+
+		/// Resizes the container. New vectors are set to zero.
+		GLM_FUNC_DISCARD_DECL void resize(std::size_t size);
+
+		/// Returns the array of the i-th component (0 for x, 1 for y, ...).
+		GLM_FUNC_DECL T* operator[](length_t i);
+		GLM_FUNC_DECL T const* operator[](length_t i) const;
+
+		/// Gathers the i-th vector.
+		GLM_FUNC_DECL aos_type load(std::size_t i) const;
+
+		/// Scatters v as the i-th vector.
+		GLM_FUNC_DISCARD_DECL void store(std::size_t i, aos_type const& v);
+
+	private:
+		GLM_FUNC_DISCARD_DECL void allocate(std::size_t capacity);
+		GLM_FUNC_DISCARD_DECL void release();
+
+		void* Memory;
+		T* Data;
+		std::size_t Size;
+		std::size_t Capacity;
+	};
+
+	typedef vec_soa<2, float> vec2_soa;
+	typedef vec_soa<3, float> vec3_soa;
+	typedef vec_soa<4, float> vec4_soa;
+	typedef vec_soa<2, double> dvec2_soa;
+	typedef vec_soa<3, double> dvec3_soa;
+	typedef vec_soa<4, double> dvec4_soa;
+
+	/// Converts 'count' AoS vectors to SoA. 'out' is resized to 'count'.
+	/// @see gtx_vec_soa
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void aos_to_soa(vec<L, T, Q> const* in, std::size_t count, vec_soa<L, T>& out);
+
+	/// Converts all the vectors of 'in' to AoS. 'out' must have room for in.size() vectors.
+	/// @see gtx_vec_soa
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void soa_to_aos(vec_soa<L, T> const& in, vec<L, T, Q>* out);
+
+	/// out[i] = dot(x[i], y[i]). 'out' must have room for x.size() values.
+	/// @see gtx_vec_soa
+	template<length_t L, typename T>
+	GLM_FUNC_DISCARD_DECL void dot(vec_soa<L, T> const& x, vec_soa<L, T> const& y, T* out);
+
+	/// out[i] = cross(x[i], y[i]). 'out' is resized to x.size() and may be x or y.
+	/// @see gtx_vec_soa
+	template<typename T>
+	GLM_FUNC_DISCARD_DECL void cross(vec_soa<3, T> const& x, vec_soa<3, T> const& y, vec_soa<3, T>& out);
+
+	/// out[i] = length(x[i]). 'out' must have room for x.size() values.
+	/// @see gtx_vec_soa
+	template<length_t L, typename T>
+	GLM_FUNC_DISCARD_DECL void length(vec_soa<L, T> const& x, T* out);
+
+	/// out[i] = normalize(x[i]). 'out' is resized to x.size() and may be x.
+	/// @see gtx_vec_soa
+	template<length_t L, typename T>
+	GLM_FUNC_DISCARD_DECL void normalize(vec_soa<L, T> const& x, vec_soa<L, T>& out);
+
+	/// out[i] = mix(x[i], y[i], a). 'out' is resized to x.size() and may be x or y.
+	/// @see gtx_vec_soa
+	template<length_t L, typename T>
+	GLM_FUNC_DISCARD_DECL void mix(vec_soa<L, T> const& x, vec_soa<L, T> const& y, T a, vec_soa<L, T>& out);
+
+	/// out[i] = clamp(x[i], minVal, maxVal). 'out' is resized to x.size() and may be x.
+	/// @see gtx_vec_soa
+	template<length_t L, typename T>
+	GLM_FUNC_DISCARD_DECL void clamp(vec_soa<L, T> const& x, T minVal, T maxVal, vec_soa<L, T>& out);
+
+	/// @}
+}//namespace glm
+
+#include "vec_soa.inl"
@@ -0,0 +1,599 @@
+/// @ref gtx_vec_soa
+
+#include <cstring>
+#include <new>
+
+namespace glm{
+namespace detail
+{
+	// A 'pack' wraps the widest register available for T so the bulk kernels below are
+	// written once. soa_scalar is used for the tail and for types without a SIMD pack.
+	template<typename T>
+	struct soa_scalar
+	{
+		typedef T type;
+		static std::size_t const width = 1;
+
+		GLM_FUNC_QUALIFIER static type load(T const* p) { return *p; }
+		GLM_FUNC_QUALIFIER static void store(T* p, type v) { *p = v; }
+		GLM_FUNC_QUALIFIER static type set1(T v) { return v; }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return a + b; }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return a - b; }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return a * b; }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return a / b; }
+		GLM_FUNC_QUALIFIER static type sqrt(type a) { return std::sqrt(a); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return b < a ? b : a; }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return a < b ? b : a; }
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	// The unmasked sqrt, min and max have an undefined source operand GCC warns about
+	struct soa_avx512_f32
+	{
+		typedef __m512 type;
+		static std::size_t const width = 16;
+
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm512_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type v) { _mm512_storeu_ps(p, v); }
+		GLM_FUNC_QUALIFIER static type set1(float v) { return _mm512_set1_ps(v); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm512_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm512_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm512_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm512_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sqrt(type a) { return _mm512_mask_sqrt_ps(a, 0xFFFF, a); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm512_mask_min_ps(a, 0xFFFF, b, a); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm512_mask_max_ps(a, 0xFFFF, b, a); }
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	struct soa_avx_f32
+	{
+		typedef __m256 type;
+		static std::size_t const width = 8;
+
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm256_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type v) { _mm256_storeu_ps(p, v); }
+		GLM_FUNC_QUALIFIER static type set1(float v) { return _mm256_set1_ps(v); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm256_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sqrt(type a) { return _mm256_sqrt_ps(a); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm256_min_ps(b, a); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm256_max_ps(b, a); }
+	};
+
+	struct soa_avx_f64
+	{
+		typedef __m256d type;
+		static std::size_t const width = 4;
+
+		GLM_FUNC_QUALIFIER static type load(double const* p) { return _mm256_loadu_pd(p); }
+		GLM_FUNC_QUALIFIER static void store(double* p, type v) { _mm256_storeu_pd(p, v); }
+		GLM_FUNC_QUALIFIER static type set1(double v) { return _mm256_set1_pd(v); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm256_add_pd(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm256_sub_pd(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm256_mul_pd(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm256_div_pd(a, b); }
+		GLM_FUNC_QUALIFIER static type sqrt(type a) { return _mm256_sqrt_pd(a); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm256_min_pd(b, a); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm256_max_pd(b, a); }
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	struct soa_sse2_f32
+	{
+		typedef __m128 type;
+		static std::size_t const width = 4;
+
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type v) { _mm_storeu_ps(p, v); }
+		GLM_FUNC_QUALIFIER static type set1(float v) { return _mm_set1_ps(v); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sqrt(type a) { return _mm_sqrt_ps(a); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm_min_ps(b, a); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm_max_ps(b, a); }
+	};
+
+	struct soa_sse2_f64
+	{
+		typedef __m128d type;
+		static std::size_t const width = 2;
+
+		GLM_FUNC_QUALIFIER static type load(double const* p) { return _mm_loadu_pd(p); }
+		GLM_FUNC_QUALIFIER static void store(double* p, type v) { _mm_storeu_pd(p, v); }
+		GLM_FUNC_QUALIFIER static type set1(double v) { return _mm_set1_pd(v); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm_add_pd(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm_sub_pd(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm_mul_pd(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm_div_pd(a, b); }
+		GLM_FUNC_QUALIFIER static type sqrt(type a) { return _mm_sqrt_pd(a); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm_min_pd(b, a); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm_max_pd(b, a); }
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	struct soa_neon_f32
+	{
+		typedef float32x4_t type;
+		static std::size_t const width = 4;
+
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return vld1q_f32(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type v) { vst1q_f32(p, v); }
+		GLM_FUNC_QUALIFIER static type set1(float v) { return vdupq_n_f32(v); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return vaddq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return vsubq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return vmulq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return vdivq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static type sqrt(type a) { return vsqrtq_f32(a); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return vminq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return vmaxq_f32(a, b); }
+	};
+#	endif
+
+	// Widest pack available for T at compile time
+	template<typename T>
+	struct soa_native
+	{
+		typedef soa_scalar<T> type;
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	template<>
+	struct soa_native<float>
+	{
+		typedef soa_avx512_f32 type;
+	};
+
+	template<>
+	struct soa_native<double>
+	{
+		typedef soa_avx_f64 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<>
+	struct soa_native<float>
+	{
+		typedef soa_avx_f32 type;
+	};
+
+	template<>
+	struct soa_native<double>
+	{
+		typedef soa_avx_f64 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct soa_native<float>
+	{
+		typedef soa_sse2_f32 type;
+	};
+
+	template<>
+	struct soa_native<double>
+	{
+		typedef soa_sse2_f64 type;
+	};
+#	elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<>
+	struct soa_native<float>
+	{
+		typedef soa_neon_f32 type;
+	};
+#	endif
+
+	// Each kernel processes the vectors [i, count) 'P::width' at a time and returns the index
+	// of the first vector it didn't process. It is run with the native pack then with
+	// soa_scalar for the tail.
+
+	template<typename P, length_t L, typename T>
+	GLM_FUNC_QUALIFIER typename P::type soa_dot_pack(T const* const x[L], T const* const y[L], std::size_t i)
+	{
+		typename P::type Result = P::mul(P::load(x[0] + i), P::load(y[0] + i));
+		for(length_t c = 1; c < L; ++c)
+			Result = P::add(Result, P::mul(P::load(x[c] + i), P::load(y[c] + i)));
+		return Result;
+	}
+
+	template<typename P, length_t L, typename T>
+	GLM_FUNC_QUALIFIER std::size_t soa_dot(T const* const x[L], T const* const y[L], T* out, std::size_t i, std::size_t count)
+	{
+		for(; i + P::width <= count; i += P::width)
+			P::store(out + i, soa_dot_pack<P, L, T>(x, y, i));
+		return i;
+	}
+
+	template<typename P, length_t L, typename T>
+	GLM_FUNC_QUALIFIER std::size_t soa_length(T const* const x[L], T* out, std::size_t i, std::size_t count)
+	{
+		for(; i + P::width <= count; i += P::width)
+			P::store(out + i, P::sqrt(soa_dot_pack<P, L, T>(x, x, i)));
+		return i;
+	}
+
+	template<typename P, length_t L, typename T>
+	GLM_FUNC_QUALIFIER std::size_t soa_normalize(T const* const x[L], T* const out[L], std::size_t i, std::size_t count)
+	{
+		typename P::type const One = P::set1(static_cast<T>(1));
+		for(; i + P::width <= count; i += P::width)
+		{
+			// Same as normalize(): x * inversesqrt(dot(x, x))
+			typename P::type const InvLength = P::div(One, P::sqrt(soa_dot_pack<P, L, T>(x, x, i)));
+			for(length_t c = 0; c < L; ++c)
+				P::store(out[c] + i, P::mul(P::load(x[c] + i), InvLength));
+		}
+		return i;
+	}
+
+	template<typename P, typename T>
+	GLM_FUNC_QUALIFIER std::size_t soa_cross(T const* const x[3], T const* const y[3], T* const out[3], std::size_t i, std::size_t count)
+	{
+		for(; i + P::width <= count; i += P::width)
+		{
+			typename P::type const x0 = P::load(x[0] + i);
+			typename P::type const x1 = P::load(x[1] + i);
+			typename P::type const x2 = P::load(x[2] + i);
+			typename P::type const y0 = P::load(y[0] + i);
+			typename P::type const y1 = P::load(y[1] + i);
+			typename P::type const y2 = P::load(y[2] + i);
+
+			P::store(out[0] + i, P::sub(P::mul(x1, y2), P::mul(y1, x2)));
+			P::store(out[1] + i, P::sub(P::mul(x2, y0), P::mul(y2, x0)));
+			P::store(out[2] + i, P::sub(P::mul(x0, y1), P::mul(y0, x1)));
+		}
+		return i;
+	}
+
+	template<typename P, length_t L, typename T>
+	GLM_FUNC_QUALIFIER std::size_t soa_mix(T const* const x[L], T const* const y[L], T a, T* const out[L], std::size_t i, std::size_t count)
+	{
+		// Same as mix(): x * (1 - a) + y * a
+		typename P::type const A = P::set1(a);
+		typename P::type const OneMinusA = P::set1(static_cast<T>(1) - a);
+		for(; i + P::width <= count; i += P::width)
+			for(length_t c = 0; c < L; ++c)
+				P::store(out[c] + i, P::add(P::mul(P::load(x[c] + i), OneMinusA), P::mul(P::load(y[c] + i), A)));
+		return i;
+	}
+
+	template<typename P, length_t L, typename T>
+	GLM_FUNC_QUALIFIER std::size_t soa_clamp(T const* const x[L], T minVal, T maxVal, T* const out[L], std::size_t i, std::size_t count)
+	{
+		// Same as clamp(): min(max(x, minVal), maxVal)
+		typename P::type const Min = P::set1(minVal);
+		typename P::type const Max = P::set1(maxVal);
+		for(; i + P::width <= count; i += P::width)
+			for(length_t c = 0; c < L; ++c)
+				P::store(out[c] + i, P::min(P::max(P::load(x[c] + i), Min), Max));
+		return i;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER void soa_components(vec_soa<L, T> const& v, T const* Result[L])
+	{
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = v[c];
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER void soa_components(vec_soa<L, T>& v, T* Result[L])
+	{
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = v[c];
+	}
+	template<length_t L, typename T, qualifier Q>
+	struct compute_soa_transpose
+	{
+		GLM_FUNC_QUALIFIER static void aos_to_soa(vec<L, T, Q> const* in, T* const out[L], std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				for(length_t c = 0; c < L; ++c)
+					out[c][i] = in[i][c];
+		}
+
+		GLM_FUNC_QUALIFIER static void soa_to_aos(T const* const in[L], vec<L, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				for(length_t c = 0; c < L; ++c)
+					out[i][c] = in[c][i];
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// 4 vec4 at a time with a 4x4 transpose
+	template<qualifier Q>
+	struct compute_soa_transpose<4, float, Q>
+	{
+		GLM_FUNC_QUALIFIER static void aos_to_soa(vec<4, float, Q> const* in, float* const out[4], std::size_t count)
+		{
+			GLM_STATIC_ASSERT(sizeof(vec<4, float, Q>) == sizeof(float) * 4, "Specialization requires tightly packed vec4");
+
+			float const* const In = reinterpret_cast<float const*>(in);
+
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4)
+			{
+				__m128 r0 = _mm_loadu_ps(In + i * 4 + 0);
+				__m128 r1 = _mm_loadu_ps(In + i * 4 + 4);
+				__m128 r2 = _mm_loadu_ps(In + i * 4 + 8);
+				__m128 r3 = _mm_loadu_ps(In + i * 4 + 12);
+				_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+				_mm_storeu_ps(out[0] + i, r0);
+				_mm_storeu_ps(out[1] + i, r1);
+				_mm_storeu_ps(out[2] + i, r2);
+				_mm_storeu_ps(out[3] + i, r3);
+			}
+
+			for(; i < count; ++i)
+				for(length_t c = 0; c < 4; ++c)
+					out[c][i] = In[i * 4 + c];
+		}
+
+		GLM_FUNC_QUALIFIER static void soa_to_aos(float const* const in[4], vec<4, float, Q>* out, std::size_t count)
+		{
+			GLM_STATIC_ASSERT(sizeof(vec<4, float, Q>) == sizeof(float) * 4, "Specialization requires tightly packed vec4");
+
+			float* const Out = reinterpret_cast<float*>(out);
+
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4)
+			{
+				__m128 r0 = _mm_loadu_ps(in[0] + i);
+				__m128 r1 = _mm_loadu_ps(in[1] + i);
+				__m128 r2 = _mm_loadu_ps(in[2] + i);
+				__m128 r3 = _mm_loadu_ps(in[3] + i);
+				_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+				_mm_storeu_ps(Out + i * 4 + 0, r0);
+				_mm_storeu_ps(Out + i * 4 + 4, r1);
+				_mm_storeu_ps(Out + i * 4 + 8, r2);
+				_mm_storeu_ps(Out + i * 4 + 12, r3);
+			}
+
+			for(; i < count; ++i)
+				for(length_t c = 0; c < 4; ++c)
+					Out[i * 4 + c] = in[c][i];
+		}
+	};
+#	endif
+}//namespace detail
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER vec_soa<L, T>::vec_soa()
+		: Memory(GLM_NULLPTR), Data(GLM_NULLPTR), Size(0), Capacity(0)
+	{
+		GLM_STATIC_ASSERT(L >= 2 && L <= 4, "vec_soa only supports 2, 3 and 4 components vectors");
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER vec_soa<L, T>::vec_soa(std::size_t size)
+		: Memory(GLM_NULLPTR), Data(GLM_NULLPTR), Size(0), Capacity(0)
+	{
+		GLM_STATIC_ASSERT(L >= 2 && L <= 4, "vec_soa only supports 2, 3 and 4 components vectors");
+		this->resize(size);
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER vec_soa<L, T>::vec_soa(vec_soa const& v)
+		: Memory(GLM_NULLPTR), Data(GLM_NULLPTR), Size(0), Capacity(0)
+	{
+		*this = v;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER vec_soa<L, T>::~vec_soa()
+	{
+		this->release();
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER vec_soa<L, T>& vec_soa<L, T>::operator=(vec_soa const& v)
+	{
+		if(this == &v)
+			return *this;
+
+		this->resize(v.Size);
+		if(v.Size)
+			for(length_t c = 0; c < L; ++c)
+				std::memcpy((*this)[c], v[c], v.Size * sizeof(T));
+		return *this;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER std::size_t vec_soa<L, T>::size() const
+	{
+		return this->Size;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER void vec_soa<L, T>::resize(std::size_t size)
+	{
+		if(size > this->Capacity)
+		{
+			void* const OldMemory = this->Memory;
+			T* const OldData = this->Data;
+			std::size_t const OldCapacity = this->Capacity;
+
+			this->allocate(size);
+			if(this->Size)
+				for(length_t c = 0; c < L; ++c)
+					std::memcpy(this->Data + c * this->Capacity, OldData + c * OldCapacity, this->Size * sizeof(T));
+
+			::operator delete(OldMemory);
+		}
+
+		// New vectors are zero. The padding past them is left uninitialized: the kernels
+		// never read beyond the size.
+		if(size > this->Size)
+			for(length_t c = 0; c < L; ++c)
+				std::memset((*this)[c] + this->Size, 0, (size - this->Size) * sizeof(T));
+
+		this->Size = size;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER T* vec_soa<L, T>::operator[](length_t i)
+	{
+		GLM_ASSERT_LENGTH(i, L);
+		return this->Data + static_cast<std::size_t>(i) * this->Capacity;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER T const* vec_soa<L, T>::operator[](length_t i) const
+	{
+		GLM_ASSERT_LENGTH(i, L);
+		return this->Data + static_cast<std::size_t>(i) * this->Capacity;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER typename vec_soa<L, T>::aos_type vec_soa<L, T>::load(std::size_t i) const
+	{
+		assert(i < this->Size);
+		aos_type Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = (*this)[c][i];
+		return Result;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER void vec_soa<L, T>::store(std::size_t i, aos_type const& v)
+	{
+		assert(i < this->Size);
+		for(length_t c = 0; c < L; ++c)
+			(*this)[c][i] = v[c];
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER void vec_soa<L, T>::allocate(std::size_t capacity)
+	{
+		std::size_t const Alignment = 64;
+
+		// Padding every array to 16 elements keeps each of them 64 bytes aligned
+		this->Capacity = (capacity + 15) & ~static_cast<std::size_t>(15);
+		this->Memory = ::operator new(this->Capacity * L * sizeof(T) + Alignment);
+
+		std::size_t const Address = reinterpret_cast<std::size_t>(this->Memory);
+		this->Data = reinterpret_cast<T*>((Address + Alignment - 1) & ~(Alignment - 1));
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER void vec_soa<L, T>::release()
+	{
+		::operator delete(this->Memory);
+		this->Memory = GLM_NULLPTR;
+		this->Data = GLM_NULLPTR;
+		this->Size = 0;
+		this->Capacity = 0;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void aos_to_soa(vec<L, T, Q> const* in, std::size_t count, vec_soa<L, T>& out)
+	{
+		out.resize(count);
+
+		T* Out[L];
+		detail::soa_components(out, Out);
+
+		detail::compute_soa_transpose<L, T, Q>::aos_to_soa(in, Out, count);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void soa_to_aos(vec_soa<L, T> const& in, vec<L, T, Q>* out)
+	{
+		T const* In[L];
+		detail::soa_components(in, In);
+
+		detail::compute_soa_transpose<L, T, Q>::soa_to_aos(In, out, in.size());
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER void dot(vec_soa<L, T> const& x, vec_soa<L, T> const& y, T* out)
+	{
+		assert(x.size() == y.size());
+
+		T const* X[L];
+		T const* Y[L];
+		detail::soa_components(x, X);
+		detail::soa_components(y, Y);
+
+		std::size_t const i = detail::soa_dot<typename detail::soa_native<T>::type, L, T>(X, Y, out, 0, x.size());
+		detail::soa_dot<detail::soa_scalar<T>, L, T>(X, Y, out, i, x.size());
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void cross(vec_soa<3, T> const& x, vec_soa<3, T> const& y, vec_soa<3, T>& out)
+	{
+		assert(x.size() == y.size());
+		out.resize(x.size());
+
+		T const* X[3];
+		T const* Y[3];
+		T* Out[3];
+		detail::soa_components(x, X);
+		detail::soa_components(y, Y);
+		detail::soa_components(out, Out);
+
+		std::size_t const i = detail::soa_cross<typename detail::soa_native<T>::type, T>(X, Y, Out, 0, x.size());
+		detail::soa_cross<detail::soa_scalar<T>, T>(X, Y, Out, i, x.size());
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER void length(vec_soa<L, T> const& x, T* out)
+	{
+		T const* X[L];
+		detail::soa_components(x, X);
+
+		std::size_t const i = detail::soa_length<typename detail::soa_native<T>::type, L, T>(X, out, 0, x.size());
+		detail::soa_length<detail::soa_scalar<T>, L, T>(X, out, i, x.size());
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER void normalize(vec_soa<L, T> const& x, vec_soa<L, T>& out)
+	{
+		out.resize(x.size());
+
+		T const* X[L];
+		T* Out[L];
+		detail::soa_components(x, X);
+		detail::soa_components(out, Out);
+
+		std::size_t const i = detail::soa_normalize<typename detail::soa_native<T>::type, L, T>(X, Out, 0, x.size());
+		detail::soa_normalize<detail::soa_scalar<T>, L, T>(X, Out, i, x.size());
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER void mix(vec_soa<L, T> const& x, vec_soa<L, T> const& y, T a, vec_soa<L, T>& out)
+	{
+		assert(x.size() == y.size());
+		out.resize(x.size());
+
+		T const* X[L];
+		T const* Y[L];
+		T* Out[L];
+		detail::soa_components(x, X);
+		detail::soa_components(y, Y);
+		detail::soa_components(out, Out);
+
+		std::size_t const i = detail::soa_mix<typename detail::soa_native<T>::type, L, T>(X, Y, a, Out, 0, x.size());
+		detail::soa_mix<detail::soa_scalar<T>, L, T>(X, Y, a, Out, i, x.size());
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER void clamp(vec_soa<L, T> const& x, T minVal, T maxVal, vec_soa<L, T>& out)
+	{
+		out.resize(x.size());
+
+		T const* X[L];
+		T* Out[L];
+		detail::soa_components(x, X);
+		detail::soa_components(out, Out);
+
+		std::size_t const i = detail::soa_clamp<typename detail::soa_native<T>::type, L, T>(X, minVal, maxVal, Out, 0, x.size());
+		detail::soa_clamp<detail::soa_scalar<T>, L, T>(X, minVal, maxVal, Out, i, x.size());
+	}
+}//namespace glm
@@ -246,4 +246,130 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inf(glm_vec4 x)
 	return _mm_castsi128_ps(_mm_cmpeq_epi32(t2, _mm_set1_epi32(int(0xFF000000))));		// exponent is all 1s, fraction is 0
 }
 
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_select(glm_vec4 Mask, glm_vec4 a, glm_vec4 b)
+{
+	return _mm_or_ps(_mm_and_ps(Mask, a), _mm_andnot_ps(Mask, b));
+}
+
+// Replaces the lanes of Result selected by Mask, a _mm_movemask_ps value, by Func(x).
+// The polynomial approximations use it for the inputs outside of their domain.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_scalar_lanes(glm_vec4 Result, int Mask, glm_vec4 x, float (*Func)(float))
+{
+	float In[4];
+	float Out[4];
+	_mm_storeu_ps(In, x);
+	_mm_storeu_ps(Out, Result);
+	for(int i = 0; i < 4; ++i)
+		if(Mask & (1 << i))
+			Out[i] = Func(In[i]);
+	return _mm_loadu_ps(Out);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_scalar_lanes(glm_vec4 Result, int Mask, glm_vec4 x, glm_vec4 y, float (*Func)(float, float))
+{
+	float InX[4];
+	float InY[4];
+	float Out[4];
+	_mm_storeu_ps(InX, x);
+	_mm_storeu_ps(InY, y);
+	_mm_storeu_ps(Out, Result);
+	for(int i = 0; i < 4; ++i)
+		if(Mask & (1 << i))
+			Out[i] = Func(InX[i], InY[i]);
+	return _mm_loadu_ps(Out);
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+GLM_FUNC_QUALIFIER __m256 glm_vec8_fma(__m256 a, __m256 b, __m256 c)
+{
+#	ifdef GLM_FORCE_FMA
+		return _mm256_fmadd_ps(a, b, c);
+#	else
+		return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_select(__m256 Mask, __m256 a, __m256 b)
+{
+	return _mm256_blendv_ps(b, a, Mask);
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_scalar_lanes(__m256 Result, int Mask, __m256 x, float (*Func)(float))
+{
+	float In[8];
+	float Out[8];
+	_mm256_storeu_ps(In, x);
+	_mm256_storeu_ps(Out, Result);
+	for(int i = 0; i < 8; ++i)
+		if(Mask & (1 << i))
+			Out[i] = Func(In[i]);
+	return _mm256_loadu_ps(Out);
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_scalar_lanes(__m256 Result, int Mask, __m256 x, __m256 y, float (*Func)(float, float))
+{
+	float InX[8];
+	float InY[8];
+	float Out[8];
+	_mm256_storeu_ps(InX, x);
+	_mm256_storeu_ps(InY, y);
+	_mm256_storeu_ps(Out, Result);
+	for(int i = 0; i < 8; ++i)
+		if(Mask & (1 << i))
+			Out[i] = Func(InX[i], InY[i]);
+	return _mm256_loadu_ps(Out);
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_fma(glm_f32vec4 a, glm_f32vec4 b, glm_f32vec4 c)
+{
+	return vfmaq_f32(c, a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_select(glm_u32vec4 Mask, glm_f32vec4 a, glm_f32vec4 b)
+{
+	return vbslq_f32(Mask, a, b);
+}
+
+GLM_FUNC_QUALIFIER bool glm_vec4_any(glm_u32vec4 Mask)
+{
+	return vmaxvq_u32(Mask) != 0;
+}
+
+// Replaces the lanes of Result selected by Mask by Func(x).
+// The polynomial approximations use it for the inputs outside of their domain.
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_scalar_lanes(glm_f32vec4 Result, glm_u32vec4 Mask, glm_f32vec4 x, float (*Func)(float))
+{
+	unsigned int Lanes[4];
+	float In[4];
+	float Out[4];
+	vst1q_u32(Lanes, Mask);
+	vst1q_f32(In, x);
+	vst1q_f32(Out, Result);
+	for(int i = 0; i < 4; ++i)
+		if(Lanes[i])
+			Out[i] = Func(In[i]);
+	return vld1q_f32(Out);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_scalar_lanes(glm_f32vec4 Result, glm_u32vec4 Mask, glm_f32vec4 x, glm_f32vec4 y, float (*Func)(float, float))
+{
+	unsigned int Lanes[4];
+	float InX[4];
+	float InY[4];
+	float Out[4];
+	vst1q_u32(Lanes, Mask);
+	vst1q_f32(InX, x);
+	vst1q_f32(InY, y);
+	vst1q_f32(Out, Result);
+	for(int i = 0; i < 4; ++i)
+		if(Lanes[i])
+			Out[i] = Func(InX[i], InY[i]);
+	return vld1q_f32(Out);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_ARMV8_BIT
@@ -1,9 +1,39 @@
 /// @ref simd
-/// @file glm/simd/experimental.h
+/// @file glm/simd/exponential.h
 
 #pragma once
 
 #include "platform.h"
+#include "common.h"
+#include <cmath>
+#include <limits>
+
+// Polynomial approximations from the Cephes library (expf, exp2f, logf and log2f) by Stephen L. Moshier.
+// pow computes exp2(y * log2(x)) in double precision. Errors measured against the exact results:
+// - exp, exp2, log2: at most 1.5 ulp, over every float
+// - log: at most 1 ulp, over every float
+// - pow: at most 1 ulp, over 20 million random pairs
+// Denormal results are rounded once. Zero, negative, denormal, infinite and NaN inputs of log,
+// log2 and pow, NaN inputs of exp and exp2, are computed by the C library.
+
+// C library functions for the lanes outside of the polynomial domains
+GLM_FUNC_QUALIFIER float glm_f32_exp2(float x)
+{
+#	if GLM_HAS_CXX11_STL
+		return std::exp2(x);
+#	else
+		return std::pow(2.0f, x);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER float glm_f32_log2(float x)
+{
+#	if GLM_HAS_CXX11_STL
+		return std::log2(x);
+#	else
+		return std::log(x) * 1.44269504088896341f;
+#	endif
+}
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -17,4 +47,514 @@ GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sqrt_lowp(glm_f32vec4 x)
 	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
 }
 
+// 2^n for integers n in [-252, 254], as the product of two normal floats to reach denormals
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_ldexp(glm_vec4 x, glm_ivec4 n)
+{
+	glm_ivec4 const Half = _mm_srai_epi32(n, 1);
+	glm_ivec4 const Bias = _mm_set1_epi32(127);
+	glm_vec4 const Scale0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(Half, Bias), 23));
+	glm_vec4 const Scale1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_sub_epi32(n, Half), Bias), 23));
+	return _mm_mul_ps(_mm_mul_ps(x, Scale0), Scale1);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp(glm_vec4 x)
+{
+	// Operands ordered for NaN to go through: overflow to infinity and underflow to zero
+	glm_vec4 const Clamped = _mm_max_ps(_mm_set1_ps(-104.0f), _mm_min_ps(_mm_set1_ps(89.0f), x));
+
+	// x = n * ln(2) + r, |r| <= ln(2) / 2
+	glm_ivec4 const n = _mm_cvtps_epi32(_mm_mul_ps(Clamped, _mm_set1_ps(1.44269504088896341f)));
+	glm_vec4 const fn = _mm_cvtepi32_ps(n);
+	glm_vec4 r = _mm_sub_ps(Clamped, _mm_mul_ps(fn, _mm_set1_ps(0.693359375f)));
+	r = _mm_sub_ps(r, _mm_mul_ps(fn, _mm_set1_ps(-2.12194440e-4f)));
+
+	glm_vec4 p = glm_vec4_fma(_mm_set1_ps(1.9875691500e-4f), r, _mm_set1_ps(1.3981999507e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(8.3334519073e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(4.1665795894e-2f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(1.6666665459e-1f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(5.0000001201e-1f));
+	p = _mm_add_ps(glm_vec4_fma(_mm_mul_ps(p, r), r, r), _mm_set1_ps(1.0f));
+
+	glm_vec4 const Result = glm_vec4_ldexp(p, n);
+	int const NaN = _mm_movemask_ps(_mm_cmpunord_ps(x, x));
+	return NaN ? glm_vec4_scalar_lanes(Result, NaN, x, std::exp) : Result;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2(glm_vec4 x)
+{
+	glm_vec4 const Clamped = _mm_max_ps(_mm_set1_ps(-151.0f), _mm_min_ps(_mm_set1_ps(129.0f), x));
+
+	// x = n + r, |r| <= 1 / 2
+	glm_ivec4 const n = _mm_cvtps_epi32(Clamped);
+	glm_vec4 const r = _mm_sub_ps(Clamped, _mm_cvtepi32_ps(n));
+
+	glm_vec4 p = glm_vec4_fma(_mm_set1_ps(1.535336188319500e-4f), r, _mm_set1_ps(1.339887440266574e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(9.618437357674640e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(5.550332471162809e-2f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(2.402264791363012e-1f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(6.931472028550421e-1f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(1.0f));
+
+	glm_vec4 const Result = glm_vec4_ldexp(p, n);
+	int const NaN = _mm_movemask_ps(_mm_cmpunord_ps(x, x));
+	return NaN ? glm_vec4_scalar_lanes(Result, NaN, x, glm_f32_exp2) : Result;
+}
+
+// x = m * 2^e with m in [sqrt(2) / 2, sqrt(2)), for normal positive x
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_frexp_sqrt2(glm_vec4 x, glm_vec4* e)
+{
+	glm_ivec4 const Bits = _mm_castps_si128(x);
+	glm_ivec4 Exponent = _mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(127));
+	glm_ivec4 Mantissa = _mm_or_si128(_mm_and_si128(Bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f800000));
+
+	// Mantissas of [sqrt(2), 2) are halved
+	glm_ivec4 const High = _mm_cmpgt_epi32(Mantissa, _mm_set1_epi32(0x3fb504f3));
+	Exponent = _mm_sub_epi32(Exponent, High);
+	Mantissa = _mm_sub_epi32(Mantissa, _mm_and_si128(High, _mm_set1_epi32(0x00800000)));
+
+	*e = _mm_cvtepi32_ps(Exponent);
+	return _mm_castsi128_ps(Mantissa);
+}
+
+// log(1 + f) - f for f in [sqrt(2) / 2 - 1, sqrt(2) - 1], z = f * f
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_poly(glm_vec4 f, glm_vec4 z)
+{
+	glm_vec4 p = glm_vec4_fma(_mm_set1_ps(7.0376836292e-2f), f, _mm_set1_ps(-1.1514610310e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(1.1676998740e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(-1.2420140846e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(1.4249322787e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(-1.6668057665e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(2.0000714765e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(-2.4999993993e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(3.3333331174e-1f));
+	return glm_vec4_fma(_mm_set1_ps(-0.5f), z, _mm_mul_ps(_mm_mul_ps(p, f), z));
+}
+
+// Lanes to compute with the C library: anything but normal positive floats
+GLM_FUNC_QUALIFIER int glm_vec4_log_outside(glm_vec4 x)
+{
+	glm_vec4 const Normal = _mm_and_ps(_mm_cmpge_ps(x, _mm_set1_ps(std::numeric_limits<float>::min())), _mm_cmplt_ps(x, _mm_set1_ps(std::numeric_limits<float>::infinity())));
+	return _mm_movemask_ps(Normal) ^ 0xf;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log(glm_vec4 x)
+{
+	glm_vec4 e;
+	glm_vec4 const f = _mm_sub_ps(glm_vec4_frexp_sqrt2(x, &e), _mm_set1_ps(1.0f));
+	glm_vec4 const z = _mm_mul_ps(f, f);
+
+	// e * ln(2) split in two floats
+	glm_vec4 y = glm_vec4_fma(e, _mm_set1_ps(-2.12194440e-4f), glm_vec4_log_poly(f, z));
+	glm_vec4 const Result = glm_vec4_fma(e, _mm_set1_ps(0.693359375f), _mm_add_ps(f, y));
+
+	int const Outside = glm_vec4_log_outside(x);
+	return Outside ? glm_vec4_scalar_lanes(Result, Outside, x, std::log) : Result;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2(glm_vec4 x)
+{
+	glm_vec4 e;
+	glm_vec4 const f = _mm_sub_ps(glm_vec4_frexp_sqrt2(x, &e), _mm_set1_ps(1.0f));
+	glm_vec4 const y = glm_vec4_log_poly(f, _mm_mul_ps(f, f));
+
+	// (f + y) * log2(e) with log2(e) = 1 + 0.44269504...
+	glm_vec4 const Log2EA = _mm_set1_ps(0.44269504088896340736f);
+	glm_vec4 Result = _mm_mul_ps(y, Log2EA);
+	Result = glm_vec4_fma(f, Log2EA, Result);
+	Result = _mm_add_ps(_mm_add_ps(Result, y), f);
+	Result = _mm_add_ps(Result, e);
+
+	int const Outside = glm_vec4_log_outside(x);
+	return Outside ? glm_vec4_scalar_lanes(Result, Outside, x, glm_f32_log2) : Result;
+}
+
+// 2^(y * log2(m * 2^e)) in double precision, with m in [sqrt(2) / 2, sqrt(2))
+GLM_FUNC_QUALIFIER glm_f64vec2 glm_dvec2_pow(glm_f64vec2 m, glm_f64vec2 e, glm_f64vec2 y)
+{
+	// log(m) = 2 * atanh(s) with s = (m - 1) / (m + 1), |s| <= 0.172: the series to s^15
+	// is exact to 2^-39, the polynomials are evaluated with Estrin's scheme for a shorter latency
+	glm_f64vec2 const One = _mm_set1_pd(1.0);
+	glm_f64vec2 const s = _mm_div_pd(_mm_sub_pd(m, One), _mm_add_pd(m, One));
+	glm_f64vec2 const s2 = _mm_mul_pd(s, s);
+	glm_f64vec2 const s4 = _mm_mul_pd(s2, s2);
+	glm_f64vec2 const p01 = _mm_add_pd(_mm_mul_pd(s2, _mm_set1_pd(1.0 / 3.0)), One);
+	glm_f64vec2 const p23 = _mm_add_pd(_mm_mul_pd(s2, _mm_set1_pd(1.0 / 7.0)), _mm_set1_pd(1.0 / 5.0));
+	glm_f64vec2 const p45 = _mm_add_pd(_mm_mul_pd(s2, _mm_set1_pd(1.0 / 11.0)), _mm_set1_pd(1.0 / 9.0));
+	glm_f64vec2 const p67 = _mm_add_pd(_mm_mul_pd(s2, _mm_set1_pd(1.0 / 15.0)), _mm_set1_pd(1.0 / 13.0));
+	glm_f64vec2 const p03 = _mm_add_pd(_mm_mul_pd(s4, p23), p01);
+	glm_f64vec2 const p47 = _mm_add_pd(_mm_mul_pd(s4, p67), p45);
+	glm_f64vec2 const p = _mm_add_pd(_mm_mul_pd(_mm_mul_pd(s4, s4), p47), p03);
+	glm_f64vec2 const Log2 = _mm_add_pd(e, _mm_mul_pd(_mm_mul_pd(s, p), _mm_set1_pd(2.88539008177792681472)));
+
+	// Beyond [-160, 160] the float result is zero or infinity
+	glm_f64vec2 const w = _mm_max_pd(_mm_set1_pd(-160.0), _mm_min_pd(_mm_set1_pd(160.0), _mm_mul_pd(y, Log2)));
+	glm_ivec4 const n = _mm_cvtpd_epi32(w);
+	glm_f64vec2 const t = _mm_mul_pd(_mm_sub_pd(w, _mm_cvtepi32_pd(n)), _mm_set1_pd(0.69314718055994530942));
+
+	// exp(t) for |t| <= ln(2) / 2: the series to t^8 is exact to 2^-32
+	glm_f64vec2 const t2 = _mm_mul_pd(t, t);
+	glm_f64vec2 const t4 = _mm_mul_pd(t2, t2);
+	glm_f64vec2 const q01 = _mm_add_pd(t, One);
+	glm_f64vec2 const q23 = _mm_add_pd(_mm_mul_pd(t, _mm_set1_pd(1.0 / 6.0)), _mm_set1_pd(0.5));
+	glm_f64vec2 const q45 = _mm_add_pd(_mm_mul_pd(t, _mm_set1_pd(1.0 / 120.0)), _mm_set1_pd(1.0 / 24.0));
+	glm_f64vec2 const q67 = _mm_add_pd(_mm_mul_pd(t, _mm_set1_pd(1.0 / 5040.0)), _mm_set1_pd(1.0 / 720.0));
+	glm_f64vec2 const q03 = _mm_add_pd(_mm_mul_pd(t2, q23), q01);
+	glm_f64vec2 const q48 = _mm_add_pd(_mm_mul_pd(t2, _mm_add_pd(_mm_mul_pd(t2, _mm_set1_pd(1.0 / 40320.0)), q67)), q45);
+	glm_f64vec2 const q = _mm_add_pd(_mm_mul_pd(t4, q48), q03);
+
+	glm_ivec4 const Exponent = _mm_slli_epi64(_mm_unpacklo_epi32(_mm_add_epi32(n, _mm_set1_epi32(1023)), _mm_setzero_si128()), 52);
+	return _mm_mul_pd(q, _mm_castsi128_pd(Exponent));
+}
+
+// Lanes to compute with the C library: x not a normal positive float or y not finite
+GLM_FUNC_QUALIFIER int glm_vec4_pow_outside(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 const Finite = _mm_cmplt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), y), _mm_set1_ps(std::numeric_limits<float>::infinity()));
+	return glm_vec4_log_outside(x) | (_mm_movemask_ps(Finite) ^ 0xf);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pow(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 e;
+	glm_vec4 const m = glm_vec4_frexp_sqrt2(x, &e);
+
+	glm_f64vec2 const Low = glm_dvec2_pow(_mm_cvtps_pd(m), _mm_cvtps_pd(e), _mm_cvtps_pd(y));
+	glm_f64vec2 const High = glm_dvec2_pow(_mm_cvtps_pd(_mm_movehl_ps(m, m)), _mm_cvtps_pd(_mm_movehl_ps(e, e)), _mm_cvtps_pd(_mm_movehl_ps(y, y)));
+	glm_vec4 const Result = _mm_movelh_ps(_mm_cvtpd_ps(Low), _mm_cvtpd_ps(High));
+
+	int const Outside = glm_vec4_pow_outside(x, y);
+	return Outside ? glm_vec4_scalar_lanes(Result, Outside, x, y, std::pow) : Result;
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_ldexp(__m256 x, __m256i n)
+{
+	__m256i const Half = _mm256_srai_epi32(n, 1);
+	__m256i const Bias = _mm256_set1_epi32(127);
+	__m256 const Scale0 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(Half, Bias), 23));
+	__m256 const Scale1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_sub_epi32(n, Half), Bias), 23));
+	return _mm256_mul_ps(_mm256_mul_ps(x, Scale0), Scale1);
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_exp(__m256 x)
+{
+	__m256 const Clamped = _mm256_max_ps(_mm256_set1_ps(-104.0f), _mm256_min_ps(_mm256_set1_ps(89.0f), x));
+
+	__m256i const n = _mm256_cvtps_epi32(_mm256_mul_ps(Clamped, _mm256_set1_ps(1.44269504088896341f)));
+	__m256 const fn = _mm256_cvtepi32_ps(n);
+	__m256 r = _mm256_sub_ps(Clamped, _mm256_mul_ps(fn, _mm256_set1_ps(0.693359375f)));
+	r = _mm256_sub_ps(r, _mm256_mul_ps(fn, _mm256_set1_ps(-2.12194440e-4f)));
+
+	__m256 p = glm_vec8_fma(_mm256_set1_ps(1.9875691500e-4f), r, _mm256_set1_ps(1.3981999507e-3f));
+	p = glm_vec8_fma(p, r, _mm256_set1_ps(8.3334519073e-3f));
+	p = glm_vec8_fma(p, r, _mm256_set1_ps(4.1665795894e-2f));
+	p = glm_vec8_fma(p, r, _mm256_set1_ps(1.6666665459e-1f));
+	p = glm_vec8_fma(p, r, _mm256_set1_ps(5.0000001201e-1f));
+	p = _mm256_add_ps(glm_vec8_fma(_mm256_mul_ps(p, r), r, r), _mm256_set1_ps(1.0f));
+
+	__m256 const Result = glm_vec8_ldexp(p, n);
+	int const NaN = _mm256_movemask_ps(_mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+	return NaN ? glm_vec8_scalar_lanes(Result, NaN, x, std::exp) : Result;
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_exp2(__m256 x)
+{
+	__m256 const Clamped = _mm256_max_ps(_mm256_set1_ps(-151.0f), _mm256_min_ps(_mm256_set1_ps(129.0f), x));
+
+	__m256i const n = _mm256_cvtps_epi32(Clamped);
+	__m256 const r = _mm256_sub_ps(Clamped, _mm256_cvtepi32_ps(n));
+
+	__m256 p = glm_vec8_fma(_mm256_set1_ps(1.535336188319500e-4f), r, _mm256_set1_ps(1.339887440266574e-3f));
+	p = glm_vec8_fma(p, r, _mm256_set1_ps(9.618437357674640e-3f));
+	p = glm_vec8_fma(p, r, _mm256_set1_ps(5.550332471162809e-2f));
+	p = glm_vec8_fma(p, r, _mm256_set1_ps(2.402264791363012e-1f));
+	p = glm_vec8_fma(p, r, _mm256_set1_ps(6.931472028550421e-1f));
+	p = glm_vec8_fma(p, r, _mm256_set1_ps(1.0f));
+
+	__m256 const Result = glm_vec8_ldexp(p, n);
+	int const NaN = _mm256_movemask_ps(_mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+	return NaN ? glm_vec8_scalar_lanes(Result, NaN, x, glm_f32_exp2) : Result;
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_frexp_sqrt2(__m256 x, __m256* e)
+{
+	__m256i const Bits = _mm256_castps_si256(x);
+	__m256i Exponent = _mm256_sub_epi32(_mm256_srli_epi32(Bits, 23), _mm256_set1_epi32(127));
+	__m256i Mantissa = _mm256_or_si256(_mm256_and_si256(Bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f800000));
+
+	__m256i const High = _mm256_cmpgt_epi32(Mantissa, _mm256_set1_epi32(0x3fb504f3));
+	Exponent = _mm256_sub_epi32(Exponent, High);
+	Mantissa = _mm256_sub_epi32(Mantissa, _mm256_and_si256(High, _mm256_set1_epi32(0x00800000)));
+
+	*e = _mm256_cvtepi32_ps(Exponent);
+	return _mm256_castsi256_ps(Mantissa);
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_log_poly(__m256 f, __m256 z)
+{
+	__m256 p = glm_vec8_fma(_mm256_set1_ps(7.0376836292e-2f), f, _mm256_set1_ps(-1.1514610310e-1f));
+	p = glm_vec8_fma(p, f, _mm256_set1_ps(1.1676998740e-1f));
+	p = glm_vec8_fma(p, f, _mm256_set1_ps(-1.2420140846e-1f));
+	p = glm_vec8_fma(p, f, _mm256_set1_ps(1.4249322787e-1f));
+	p = glm_vec8_fma(p, f, _mm256_set1_ps(-1.6668057665e-1f));
+	p = glm_vec8_fma(p, f, _mm256_set1_ps(2.0000714765e-1f));
+	p = glm_vec8_fma(p, f, _mm256_set1_ps(-2.4999993993e-1f));
+	p = glm_vec8_fma(p, f, _mm256_set1_ps(3.3333331174e-1f));
+	return glm_vec8_fma(_mm256_set1_ps(-0.5f), z, _mm256_mul_ps(_mm256_mul_ps(p, f), z));
+}
+
+GLM_FUNC_QUALIFIER int glm_vec8_log_outside(__m256 x)
+{
+	__m256 const Normal = _mm256_and_ps(
+		_mm256_cmp_ps(x, _mm256_set1_ps(std::numeric_limits<float>::min()), _CMP_GE_OQ),
+		_mm256_cmp_ps(x, _mm256_set1_ps(std::numeric_limits<float>::infinity()), _CMP_LT_OQ));
+	return _mm256_movemask_ps(Normal) ^ 0xff;
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_log(__m256 x)
+{
+	__m256 e;
+	__m256 const f = _mm256_sub_ps(glm_vec8_frexp_sqrt2(x, &e), _mm256_set1_ps(1.0f));
+	__m256 const z = _mm256_mul_ps(f, f);
+
+	__m256 y = glm_vec8_fma(e, _mm256_set1_ps(-2.12194440e-4f), glm_vec8_log_poly(f, z));
+	__m256 const Result = glm_vec8_fma(e, _mm256_set1_ps(0.693359375f), _mm256_add_ps(f, y));
+
+	int const Outside = glm_vec8_log_outside(x);
+	return Outside ? glm_vec8_scalar_lanes(Result, Outside, x, std::log) : Result;
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_log2(__m256 x)
+{
+	__m256 e;
+	__m256 const f = _mm256_sub_ps(glm_vec8_frexp_sqrt2(x, &e), _mm256_set1_ps(1.0f));
+	__m256 const y = glm_vec8_log_poly(f, _mm256_mul_ps(f, f));
+
+	__m256 const Log2EA = _mm256_set1_ps(0.44269504088896340736f);
+	__m256 Result = _mm256_mul_ps(y, Log2EA);
+	Result = glm_vec8_fma(f, Log2EA, Result);
+	Result = _mm256_add_ps(_mm256_add_ps(Result, y), f);
+	Result = _mm256_add_ps(Result, e);
+
+	int const Outside = glm_vec8_log_outside(x);
+	return Outside ? glm_vec8_scalar_lanes(Result, Outside, x, glm_f32_log2) : Result;
+}
+
+GLM_FUNC_QUALIFIER __m256d glm_dvec4_pow(__m256d m, __m256d e, __m256d y)
+{
+	__m256d const One = _mm256_set1_pd(1.0);
+	__m256d const s = _mm256_div_pd(_mm256_sub_pd(m, One), _mm256_add_pd(m, One));
+	__m256d const s2 = _mm256_mul_pd(s, s);
+	__m256d const s4 = _mm256_mul_pd(s2, s2);
+	__m256d const p01 = _mm256_add_pd(_mm256_mul_pd(s2, _mm256_set1_pd(1.0 / 3.0)), One);
+	__m256d const p23 = _mm256_add_pd(_mm256_mul_pd(s2, _mm256_set1_pd(1.0 / 7.0)), _mm256_set1_pd(1.0 / 5.0));
+	__m256d const p45 = _mm256_add_pd(_mm256_mul_pd(s2, _mm256_set1_pd(1.0 / 11.0)), _mm256_set1_pd(1.0 / 9.0));
+	__m256d const p67 = _mm256_add_pd(_mm256_mul_pd(s2, _mm256_set1_pd(1.0 / 15.0)), _mm256_set1_pd(1.0 / 13.0));
+	__m256d const p03 = _mm256_add_pd(_mm256_mul_pd(s4, p23), p01);
+	__m256d const p47 = _mm256_add_pd(_mm256_mul_pd(s4, p67), p45);
+	__m256d const p = _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(s4, s4), p47), p03);
+	__m256d const Log2 = _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(s, p), _mm256_set1_pd(2.88539008177792681472)), e);
+
+	__m256d const w = _mm256_max_pd(_mm256_set1_pd(-160.0), _mm256_min_pd(_mm256_set1_pd(160.0), _mm256_mul_pd(y, Log2)));
+	__m128i const n = _mm256_cvtpd_epi32(w);
+	__m256d const t = _mm256_mul_pd(_mm256_sub_pd(w, _mm256_cvtepi32_pd(n)), _mm256_set1_pd(0.69314718055994530942));
+
+	__m256d const t2 = _mm256_mul_pd(t, t);
+	__m256d const t4 = _mm256_mul_pd(t2, t2);
+	__m256d const q01 = _mm256_add_pd(t, One);
+	__m256d const q23 = _mm256_add_pd(_mm256_mul_pd(t, _mm256_set1_pd(1.0 / 6.0)), _mm256_set1_pd(0.5));
+	__m256d const q45 = _mm256_add_pd(_mm256_mul_pd(t, _mm256_set1_pd(1.0 / 120.0)), _mm256_set1_pd(1.0 / 24.0));
+	__m256d const q67 = _mm256_add_pd(_mm256_mul_pd(t, _mm256_set1_pd(1.0 / 5040.0)), _mm256_set1_pd(1.0 / 720.0));
+	__m256d const q03 = _mm256_add_pd(_mm256_mul_pd(t2, q23), q01);
+	__m256d const q48 = _mm256_add_pd(_mm256_mul_pd(t2, _mm256_add_pd(_mm256_mul_pd(t2, _mm256_set1_pd(1.0 / 40320.0)), q67)), q45);
+	__m256d const q = _mm256_add_pd(_mm256_mul_pd(t4, q48), q03);
+
+	__m256i const Exponent = _mm256_slli_epi64(_mm256_cvtepi32_epi64(_mm_add_epi32(n, _mm_set1_epi32(1023))), 52);
+	return _mm256_mul_pd(q, _mm256_castsi256_pd(Exponent));
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_pow(__m256 x, __m256 y)
+{
+	__m256 e;
+	__m256 const m = glm_vec8_frexp_sqrt2(x, &e);
+
+	__m256d const Low = glm_dvec4_pow(_mm256_cvtps_pd(_mm256_castps256_ps128(m)), _mm256_cvtps_pd(_mm256_castps256_ps128(e)), _mm256_cvtps_pd(_mm256_castps256_ps128(y)));
+	__m256d const High = glm_dvec4_pow(_mm256_cvtps_pd(_mm256_extractf128_ps(m, 1)), _mm256_cvtps_pd(_mm256_extractf128_ps(e, 1)), _mm256_cvtps_pd(_mm256_extractf128_ps(y, 1)));
+	__m256 const Result = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(Low)), _mm256_cvtpd_ps(High), 1);
+
+	__m256 const Finite = _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), y), _mm256_set1_ps(std::numeric_limits<float>::infinity()), _CMP_LT_OQ);
+	int const Outside = glm_vec8_log_outside(x) | (_mm256_movemask_ps(Finite) ^ 0xff);
+	return Outside ? glm_vec8_scalar_lanes(Result, Outside, x, y, std::pow) : Result;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_ldexp(glm_f32vec4 x, glm_i32vec4 n)
+{
+	glm_i32vec4 const Half = vshrq_n_s32(n, 1);
+	glm_i32vec4 const Bias = vdupq_n_s32(127);
+	glm_f32vec4 const Scale0 = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(Half, Bias), 23));
+	glm_f32vec4 const Scale1 = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vsubq_s32(n, Half), Bias), 23));
+	return vmulq_f32(vmulq_f32(x, Scale0), Scale1);
+}
+
+GLM_FUNC_QUALIFIER glm_u32vec4 glm_vec4_nan_lanes(glm_f32vec4 x)
+{
+	return vmvnq_u32(vceqq_f32(x, x));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_exp(glm_f32vec4 x)
+{
+	glm_f32vec4 const Clamped = vmaxq_f32(vdupq_n_f32(-104.0f), vminq_f32(vdupq_n_f32(89.0f), x));
+
+	glm_i32vec4 const n = vcvtnq_s32_f32(vmulq_n_f32(Clamped, 1.44269504088896341f));
+	glm_f32vec4 const fn = vcvtq_f32_s32(n);
+	glm_f32vec4 r = vmlsq_n_f32(Clamped, fn, 0.693359375f);
+	r = vmlsq_n_f32(r, fn, -2.12194440e-4f);
+
+	glm_f32vec4 p = glm_vec4_fma(vdupq_n_f32(1.9875691500e-4f), r, vdupq_n_f32(1.3981999507e-3f));
+	p = glm_vec4_fma(p, r, vdupq_n_f32(8.3334519073e-3f));
+	p = glm_vec4_fma(p, r, vdupq_n_f32(4.1665795894e-2f));
+	p = glm_vec4_fma(p, r, vdupq_n_f32(1.6666665459e-1f));
+	p = glm_vec4_fma(p, r, vdupq_n_f32(5.0000001201e-1f));
+	p = vaddq_f32(glm_vec4_fma(vmulq_f32(p, r), r, r), vdupq_n_f32(1.0f));
+
+	glm_f32vec4 const Result = glm_vec4_ldexp(p, n);
+	glm_u32vec4 const NaN = glm_vec4_nan_lanes(x);
+	return glm_vec4_any(NaN) ? glm_vec4_scalar_lanes(Result, NaN, x, std::exp) : Result;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_exp2(glm_f32vec4 x)
+{
+	glm_f32vec4 const Clamped = vmaxq_f32(vdupq_n_f32(-151.0f), vminq_f32(vdupq_n_f32(129.0f), x));
+
+	glm_i32vec4 const n = vcvtnq_s32_f32(Clamped);
+	glm_f32vec4 const r = vsubq_f32(Clamped, vcvtq_f32_s32(n));
+
+	glm_f32vec4 p = glm_vec4_fma(vdupq_n_f32(1.535336188319500e-4f), r, vdupq_n_f32(1.339887440266574e-3f));
+	p = glm_vec4_fma(p, r, vdupq_n_f32(9.618437357674640e-3f));
+	p = glm_vec4_fma(p, r, vdupq_n_f32(5.550332471162809e-2f));
+	p = glm_vec4_fma(p, r, vdupq_n_f32(2.402264791363012e-1f));
+	p = glm_vec4_fma(p, r, vdupq_n_f32(6.931472028550421e-1f));
+	p = glm_vec4_fma(p, r, vdupq_n_f32(1.0f));
+
+	glm_f32vec4 const Result = glm_vec4_ldexp(p, n);
+	glm_u32vec4 const NaN = glm_vec4_nan_lanes(x);
+	return glm_vec4_any(NaN) ? glm_vec4_scalar_lanes(Result, NaN, x, glm_f32_exp2) : Result;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_frexp_sqrt2(glm_f32vec4 x, glm_f32vec4* e)
+{
+	glm_i32vec4 const Bits = vreinterpretq_s32_f32(x);
+	glm_i32vec4 Exponent = vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_f32(x), 23)), vdupq_n_s32(127));
+	glm_i32vec4 Mantissa = vorrq_s32(vandq_s32(Bits, vdupq_n_s32(0x007fffff)), vdupq_n_s32(0x3f800000));
+
+	glm_i32vec4 const High = vreinterpretq_s32_u32(vcgtq_s32(Mantissa, vdupq_n_s32(0x3fb504f3)));
+	Exponent = vsubq_s32(Exponent, High);
+	Mantissa = vsubq_s32(Mantissa, vandq_s32(High, vdupq_n_s32(0x00800000)));
+
+	*e = vcvtq_f32_s32(Exponent);
+	return vreinterpretq_f32_s32(Mantissa);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_log_poly(glm_f32vec4 f, glm_f32vec4 z)
+{
+	glm_f32vec4 p = glm_vec4_fma(vdupq_n_f32(7.0376836292e-2f), f, vdupq_n_f32(-1.1514610310e-1f));
+	p = glm_vec4_fma(p, f, vdupq_n_f32(1.1676998740e-1f));
+	p = glm_vec4_fma(p, f, vdupq_n_f32(-1.2420140846e-1f));
+	p = glm_vec4_fma(p, f, vdupq_n_f32(1.4249322787e-1f));
+	p = glm_vec4_fma(p, f, vdupq_n_f32(-1.6668057665e-1f));
+	p = glm_vec4_fma(p, f, vdupq_n_f32(2.0000714765e-1f));
+	p = glm_vec4_fma(p, f, vdupq_n_f32(-2.4999993993e-1f));
+	p = glm_vec4_fma(p, f, vdupq_n_f32(3.3333331174e-1f));
+	return glm_vec4_fma(vdupq_n_f32(-0.5f), z, vmulq_f32(vmulq_f32(p, f), z));
+}
+
+GLM_FUNC_QUALIFIER glm_u32vec4 glm_vec4_log_outside(glm_f32vec4 x)
+{
+	glm_u32vec4 const Normal = vandq_u32(vcgeq_f32(x, vdupq_n_f32(std::numeric_limits<float>::min())), vcltq_f32(x, vdupq_n_f32(std::numeric_limits<float>::infinity())));
+	return vmvnq_u32(Normal);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_log(glm_f32vec4 x)
+{
+	glm_f32vec4 e;
+	glm_f32vec4 const f = vsubq_f32(glm_vec4_frexp_sqrt2(x, &e), vdupq_n_f32(1.0f));
+	glm_f32vec4 const z = vmulq_f32(f, f);
+
+	glm_f32vec4 y = glm_vec4_fma(e, vdupq_n_f32(-2.12194440e-4f), glm_vec4_log_poly(f, z));
+	glm_f32vec4 const Result = glm_vec4_fma(e, vdupq_n_f32(0.693359375f), vaddq_f32(f, y));
+
+	glm_u32vec4 const Outside = glm_vec4_log_outside(x);
+	return glm_vec4_any(Outside) ? glm_vec4_scalar_lanes(Result, Outside, x, std::log) : Result;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_log2(glm_f32vec4 x)
+{
+	glm_f32vec4 e;
+	glm_f32vec4 const f = vsubq_f32(glm_vec4_frexp_sqrt2(x, &e), vdupq_n_f32(1.0f));
+	glm_f32vec4 const y = glm_vec4_log_poly(f, vmulq_f32(f, f));
+
+	glm_f32vec4 const Log2EA = vdupq_n_f32(0.44269504088896340736f);
+	glm_f32vec4 Result = vmulq_f32(y, Log2EA);
+	Result = glm_vec4_fma(f, Log2EA, Result);
+	Result = vaddq_f32(vaddq_f32(Result, y), f);
+	Result = vaddq_f32(Result, e);
+
+	glm_u32vec4 const Outside = glm_vec4_log_outside(x);
+	return glm_vec4_any(Outside) ? glm_vec4_scalar_lanes(Result, Outside, x, glm_f32_log2) : Result;
+}
+
+GLM_FUNC_QUALIFIER float64x2_t glm_dvec2_pow(float64x2_t m, float64x2_t e, float64x2_t y)
+{
+	float64x2_t const One = vdupq_n_f64(1.0);
+	float64x2_t const s = vdivq_f64(vsubq_f64(m, One), vaddq_f64(m, One));
+	float64x2_t const s2 = vmulq_f64(s, s);
+	float64x2_t const s4 = vmulq_f64(s2, s2);
+	float64x2_t const p01 = vfmaq_f64(One, s2, vdupq_n_f64(1.0 / 3.0));
+	float64x2_t const p23 = vfmaq_f64(vdupq_n_f64(1.0 / 5.0), s2, vdupq_n_f64(1.0 / 7.0));
+	float64x2_t const p45 = vfmaq_f64(vdupq_n_f64(1.0 / 9.0), s2, vdupq_n_f64(1.0 / 11.0));
+	float64x2_t const p67 = vfmaq_f64(vdupq_n_f64(1.0 / 13.0), s2, vdupq_n_f64(1.0 / 15.0));
+	float64x2_t const p03 = vfmaq_f64(p01, s4, p23);
+	float64x2_t const p47 = vfmaq_f64(p45, s4, p67);
+	float64x2_t const p = vfmaq_f64(p03, vmulq_f64(s4, s4), p47);
+	float64x2_t const Log2 = vfmaq_f64(e, vmulq_f64(s, p), vdupq_n_f64(2.88539008177792681472));
+
+	float64x2_t const w = vmaxq_f64(vdupq_n_f64(-160.0), vminq_f64(vdupq_n_f64(160.0), vmulq_f64(y, Log2)));
+	int64x2_t const n = vcvtnq_s64_f64(w);
+	float64x2_t const t = vmulq_f64(vsubq_f64(w, vcvtq_f64_s64(n)), vdupq_n_f64(0.69314718055994530942));
+
+	float64x2_t const t2 = vmulq_f64(t, t);
+	float64x2_t const t4 = vmulq_f64(t2, t2);
+	float64x2_t const q01 = vaddq_f64(t, One);
+	float64x2_t const q23 = vfmaq_f64(vdupq_n_f64(0.5), t, vdupq_n_f64(1.0 / 6.0));
+	float64x2_t const q45 = vfmaq_f64(vdupq_n_f64(1.0 / 24.0), t, vdupq_n_f64(1.0 / 120.0));
+	float64x2_t const q67 = vfmaq_f64(vdupq_n_f64(1.0 / 720.0), t, vdupq_n_f64(1.0 / 5040.0));
+	float64x2_t const q03 = vfmaq_f64(q01, t2, q23);
+	float64x2_t const q48 = vfmaq_f64(q45, t2, vfmaq_f64(q67, t2, vdupq_n_f64(1.0 / 40320.0)));
+	float64x2_t const q = vfmaq_f64(q03, t4, q48);
+
+	int64x2_t const Exponent = vshlq_n_s64(vaddq_s64(n, vdupq_n_s64(1023)), 52);
+	return vmulq_f64(q, vreinterpretq_f64_s64(Exponent));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_pow(glm_f32vec4 x, glm_f32vec4 y)
+{
+	glm_f32vec4 e;
+	glm_f32vec4 const m = glm_vec4_frexp_sqrt2(x, &e);
+
+	float64x2_t const Low = glm_dvec2_pow(vcvt_f64_f32(vget_low_f32(m)), vcvt_f64_f32(vget_low_f32(e)), vcvt_f64_f32(vget_low_f32(y)));
+	float64x2_t const High = glm_dvec2_pow(vcvt_high_f64_f32(m), vcvt_high_f64_f32(e), vcvt_high_f64_f32(y));
+	glm_f32vec4 const Result = vcvt_high_f32_f64(vcvt_f32_f64(Low), High);
+
+	glm_u32vec4 const Finite = vcltq_f32(vabsq_f32(y), vdupq_n_f32(std::numeric_limits<float>::infinity()));
+	glm_u32vec4 const Outside = vorrq_u32(glm_vec4_log_outside(x), vmvnq_u32(Finite));
+	return glm_vec4_any(Outside) ? glm_vec4_scalar_lanes(Result, Outside, x, y, std::pow) : Result;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_ARMV8_BIT
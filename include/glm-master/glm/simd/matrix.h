@@ -77,7 +77,7 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_mul_mat4(glm_vec4 v, glm_vec4 const m[4])
 	return f2;
 }
 
-GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+GLM_FUNC_QUALIFIER void glm_mat4_mul_sse2(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
 {
 	{
 		__m128 e0 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(0, 0, 0, 0));
@@ -518,7 +518,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_determinant(glm_vec4 const m[4])
 	return glm_vec4_dot(m[0], DetCof);
 }
 
-GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
+GLM_FUNC_QUALIFIER void glm_mat4_inverse_sse2(glm_vec4 const in[4], glm_vec4 out[4])
 {
 	__m128 Fac0;
 	{
@@ -1037,4 +1037,161 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const& c, __m128 const& r,
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+// Same as glm_mat4_mul_vec4 but on two vec4 at once, one per 128 bits lane.
+// Each column of m must be duplicated in both lanes.
+GLM_FUNC_QUALIFIER __m256 glm_mat4_mul_vec4x2(__m256 const m[4], __m256 v)
+{
+	__m256 v0 = _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0));
+	__m256 v1 = _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1));
+	__m256 v2 = _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2));
+	__m256 v3 = _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3));
+
+#	ifdef GLM_FORCE_FMA
+		__m256 a0 = _mm256_fmadd_ps(m[1], v1, _mm256_mul_ps(m[0], v0));
+		__m256 a1 = _mm256_fmadd_ps(m[3], v3, _mm256_mul_ps(m[2], v2));
+#	else
+		__m256 a0 = _mm256_add_ps(_mm256_mul_ps(m[0], v0), _mm256_mul_ps(m[1], v1));
+		__m256 a1 = _mm256_add_ps(_mm256_mul_ps(m[2], v2), _mm256_mul_ps(m[3], v3));
+#	endif
+
+	return _mm256_add_ps(a0, a1);
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+// Computes two columns of the product per instruction, one per 128 bits lane.
+GLM_FUNC_QUALIFIER void glm_mat4_mul_avx(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	__m256 const m[4] = {
+		_mm256_broadcast_ps(&in1[0]),
+		_mm256_broadcast_ps(&in1[1]),
+		_mm256_broadcast_ps(&in1[2]),
+		_mm256_broadcast_ps(&in1[3])};
+
+	__m256 const r01 = glm_mat4_mul_vec4x2(m, _mm256_loadu_ps(reinterpret_cast<float const*>(&in2[0])));
+	__m256 const r23 = glm_mat4_mul_vec4x2(m, _mm256_loadu_ps(reinterpret_cast<float const*>(&in2[2])));
+
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[0]), r01);
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[2]), r23);
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+// GCC 12 reports the _mm512_undefined_ps() used by its AVX-512 intrinsics as uninitialized once inlined
+#	if GLM_COMPILER & GLM_COMPILER_GCC
+#		pragma GCC diagnostic push
+#		pragma GCC diagnostic ignored "-Wuninitialized"
+#		pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#	endif
+
+// Computes the four columns of the product at once, one per 128 bits lane.
+GLM_FUNC_QUALIFIER void glm_mat4_mul_avx512(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	__m512 const b = _mm512_loadu_ps(reinterpret_cast<float const*>(in2));
+
+	__m512 const m0 = _mm512_broadcast_f32x4(in1[0]);
+	__m512 const m1 = _mm512_broadcast_f32x4(in1[1]);
+	__m512 const m2 = _mm512_broadcast_f32x4(in1[2]);
+	__m512 const m3 = _mm512_broadcast_f32x4(in1[3]);
+
+	__m512 const e0 = _mm512_permute_ps(b, _MM_SHUFFLE(0, 0, 0, 0));
+	__m512 const e1 = _mm512_permute_ps(b, _MM_SHUFFLE(1, 1, 1, 1));
+	__m512 const e2 = _mm512_permute_ps(b, _MM_SHUFFLE(2, 2, 2, 2));
+	__m512 const e3 = _mm512_permute_ps(b, _MM_SHUFFLE(3, 3, 3, 3));
+
+#	ifdef GLM_FORCE_FMA
+		__m512 const a0 = _mm512_fmadd_ps(m1, e1, _mm512_mul_ps(m0, e0));
+		__m512 const a1 = _mm512_fmadd_ps(m3, e3, _mm512_mul_ps(m2, e2));
+#	else
+		__m512 const a0 = _mm512_add_ps(_mm512_mul_ps(m0, e0), _mm512_mul_ps(m1, e1));
+		__m512 const a1 = _mm512_add_ps(_mm512_mul_ps(m2, e2), _mm512_mul_ps(m3, e3));
+#	endif
+
+	_mm512_storeu_ps(reinterpret_cast<float*>(out), _mm512_add_ps(a0, a1));
+}
+
+#	if GLM_COMPILER & GLM_COMPILER_GCC
+#		pragma GCC diagnostic pop
+#	endif
+#endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+#	define GLM_FUNC_AVX512_QUALIFIER GLM_FUNC_QUALIFIER
+#	include "matrix_avx512.inl"
+#endif
+
+// Uses the widest implementation GLM_ARCH allows. 'out' may not alias 'in1' or 'in2'.
+GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+		glm_mat4_mul_avx512(in1, in2, out);
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+		glm_mat4_mul_avx(in1, in2, out);
+#	else
+		glm_mat4_mul_sse2(in1, in2, out);
+#	endif
+}
+
+// Uses the widest implementation GLM_ARCH allows.
+// There is no AVX version: with two columns per __m256, gathering the sub-factors takes more
+// lane crossing permutes than the SSE2 version spends on shuffles and arithmetic together.
+GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
+{
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+		glm_mat4_inverse_avx512(in, out);
+#	else
+		glm_mat4_inverse_sse2(in, out);
+#	endif
+}
+
+// Transforms 'count' contiguous vec4 stored in 'in' and writes them to 'out'.
+// 'in' and 'out' don't need to be aligned and may be equal.
+// With AVX, 8 vectors are processed per iteration, otherwise 4, then the remaining vectors one by one.
+GLM_FUNC_QUALIFIER void glm_mat4_mul_vec4_batch(glm_vec4 const m[4], float const* in, float* out, std::size_t count)
+{
+	glm_vec4 const c[4] = {m[0], m[1], m[2], m[3]};
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	{
+		__m256 const c2[4] = {
+			_mm256_insertf128_ps(_mm256_castps128_ps256(c[0]), c[0], 1),
+			_mm256_insertf128_ps(_mm256_castps128_ps256(c[1]), c[1], 1),
+			_mm256_insertf128_ps(_mm256_castps128_ps256(c[2]), c[2], 1),
+			_mm256_insertf128_ps(_mm256_castps128_ps256(c[3]), c[3], 1)};
+
+		for(; i + 8 <= count; i += 8)
+		{
+			__m256 const v0 = _mm256_loadu_ps(in + i * 4 + 0);
+			__m256 const v1 = _mm256_loadu_ps(in + i * 4 + 8);
+			__m256 const v2 = _mm256_loadu_ps(in + i * 4 + 16);
+			__m256 const v3 = _mm256_loadu_ps(in + i * 4 + 24);
+
+			_mm256_storeu_ps(out + i * 4 + 0, glm_mat4_mul_vec4x2(c2, v0));
+			_mm256_storeu_ps(out + i * 4 + 8, glm_mat4_mul_vec4x2(c2, v1));
+			_mm256_storeu_ps(out + i * 4 + 16, glm_mat4_mul_vec4x2(c2, v2));
+			_mm256_storeu_ps(out + i * 4 + 24, glm_mat4_mul_vec4x2(c2, v3));
+		}
+	}
+#	endif
+
+	for(; i + 4 <= count; i += 4)
+	{
+		glm_vec4 const v0 = _mm_loadu_ps(in + i * 4 + 0);
+		glm_vec4 const v1 = _mm_loadu_ps(in + i * 4 + 4);
+		glm_vec4 const v2 = _mm_loadu_ps(in + i * 4 + 8);
+		glm_vec4 const v3 = _mm_loadu_ps(in + i * 4 + 12);
+
+		_mm_storeu_ps(out + i * 4 + 0, glm_mat4_mul_vec4(c, v0));
+		_mm_storeu_ps(out + i * 4 + 4, glm_mat4_mul_vec4(c, v1));
+		_mm_storeu_ps(out + i * 4 + 8, glm_mat4_mul_vec4(c, v2));
+		_mm_storeu_ps(out + i * 4 + 12, glm_mat4_mul_vec4(c, v3));
+	}
+
+	for(; i < count; ++i)
+		_mm_storeu_ps(out + i * 4, glm_mat4_mul_vec4(c, _mm_loadu_ps(in + i * 4)));
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
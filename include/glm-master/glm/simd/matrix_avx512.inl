@@ -0,0 +1,74 @@
+/// @ref simd
+/// @file glm/simd/matrix_avx512.inl
+
+// The AVX-512 inverse, included by simd/matrix.h when GLM_ARCH has AVX-512 and otherwise by
+// GLM_GTX_simd_dispatch, which builds it for a per function target. The includer defines
+// GLM_FUNC_AVX512_QUALIFIER.
+
+// GCC 12 reports the _mm512_undefined_ps() used by its AVX-512 intrinsics as uninitialized once inlined
+#	if GLM_COMPILER & GLM_COMPILER_GCC
+#		pragma GCC diagnostic push
+#		pragma GCC diagnostic ignored "-Wuninitialized"
+#		pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#	endif
+
+// Four of the sub-factors of glm_mat4_inverse_sse2 (Fac0 to Fac5), one per 128 bits lane.
+// p and q hold, for each lane, the rows of the 2x2 minors: Fac0 is (2, 3), Fac1 (1, 3), Fac2 (1, 2), Fac3 (0, 3), Fac4 (0, 2) and Fac5 (0, 1).
+// m holds the whole matrix, m[c][r] being the element c * 4 + r.
+GLM_FUNC_AVX512_QUALIFIER __m512 glm_mat4_inverse_factor_avx512(__m512 m, __m512i p, __m512i q)
+{
+	// [m[2], m[2], m[1], m[1]] and [m[3], m[3], m[3], m[2]]
+	__m512i const Base0 = _mm512_setr_epi32(8, 8, 4, 4, 8, 8, 4, 4, 8, 8, 4, 4, 8, 8, 4, 4);
+	__m512i const Base1 = _mm512_setr_epi32(12, 12, 12, 8, 12, 12, 12, 8, 12, 12, 12, 8, 12, 12, 12, 8);
+
+	__m512 const Swp00 = _mm512_permutexvar_ps(_mm512_add_epi32(Base0, p), m);
+	__m512 const Swp01 = _mm512_permutexvar_ps(_mm512_add_epi32(Base1, q), m);
+	__m512 const Swp02 = _mm512_permutexvar_ps(_mm512_add_epi32(Base1, p), m);
+	__m512 const Swp03 = _mm512_permutexvar_ps(_mm512_add_epi32(Base0, q), m);
+
+	return _mm512_sub_ps(_mm512_mul_ps(Swp00, Swp01), _mm512_mul_ps(Swp02, Swp03));
+}
+
+// Same operations as glm_mat4_inverse_sse2 in the same order, on the four columns at once.
+GLM_FUNC_AVX512_QUALIFIER void glm_mat4_inverse_avx512(__m128 const in[4], __m128 out[4])
+{
+	__m512 const m = _mm512_loadu_ps(reinterpret_cast<float const*>(in));
+
+	// Sub-factors in the order the columns of the inverse consume them: [Fac0, Fac0, Fac1, Fac2], [Fac1, Fac3, Fac3, Fac4] and [Fac2, Fac4, Fac5, Fac5]
+	__m512 const FacA = glm_mat4_inverse_factor_avx512(m,
+		_mm512_setr_epi32(2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1),
+		_mm512_setr_epi32(3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2));
+	__m512 const FacB = glm_mat4_inverse_factor_avx512(m,
+		_mm512_setr_epi32(1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0),
+		_mm512_setr_epi32(3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2));
+	__m512 const FacC = glm_mat4_inverse_factor_avx512(m,
+		_mm512_setr_epi32(1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0),
+		_mm512_setr_epi32(2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1));
+
+	// [Vec1, Vec0, Vec0, Vec0], [Vec2, Vec2, Vec1, Vec1] and [Vec3, Vec3, Vec3, Vec2] with VecN = [m[1][N], m[0][N], m[0][N], m[0][N]]
+	__m512 const VecA = _mm512_permutexvar_ps(_mm512_setr_epi32(5, 1, 1, 1, 4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0), m);
+	__m512 const VecB = _mm512_permutexvar_ps(_mm512_setr_epi32(6, 2, 2, 2, 6, 2, 2, 2, 5, 1, 1, 1, 5, 1, 1, 1), m);
+	__m512 const VecC = _mm512_permutexvar_ps(_mm512_setr_epi32(7, 3, 3, 3, 7, 3, 3, 3, 7, 3, 3, 3, 6, 2, 2, 2), m);
+
+	__m512 const Sign = _mm512_setr_ps(
+		 1.0f,-1.0f, 1.0f,-1.0f,
+		-1.0f, 1.0f,-1.0f, 1.0f,
+		 1.0f,-1.0f, 1.0f,-1.0f,
+		-1.0f, 1.0f,-1.0f, 1.0f);
+
+	__m512 const Sub = _mm512_sub_ps(_mm512_mul_ps(VecA, FacA), _mm512_mul_ps(VecB, FacB));
+	__m512 const Add = _mm512_add_ps(Sub, _mm512_mul_ps(VecC, FacC));
+	__m512 const Inv = _mm512_mul_ps(Sign, Add);
+
+	// [Inverse[0][0], Inverse[1][0], Inverse[2][0], Inverse[3][0]]
+	__m128 const Row2 = _mm512_castps512_ps128(_mm512_permutexvar_ps(_mm512_setr_epi32(0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 8, 12), Inv));
+
+	__m128 const Det0 = _mm_dp_ps(_mm512_castps512_ps128(m), Row2, 0xff);
+	__m512 const Rcp0 = _mm512_broadcastss_ps(_mm_div_ps(_mm_set1_ps(1.0f), Det0));
+
+	_mm512_storeu_ps(reinterpret_cast<float*>(out), _mm512_mul_ps(Inv, Rcp0));
+}
+
+#	if GLM_COMPILER & GLM_COMPILER_GCC
+#		pragma GCC diagnostic pop
+#	endif
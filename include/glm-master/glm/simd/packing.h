@@ -5,4 +5,435 @@
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+// F16C comes with AVX on GCC and Clang only with -mf16c. Visual C++ has no such define,
+// but every AVX2 CPU has F16C.
+#if (GLM_ARCH & GLM_ARCH_AVX_BIT) && (defined(__F16C__) || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2_BIT)))
+#	define GLM_SIMD_F16C
+#endif
+
+// Rounds half away from zero, like std::round, for |x| < 2^23.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_round_away(glm_vec4 x)
+{
+	glm_ivec4 const Trunc = _mm_cvttps_epi32(x);
+	// Exact: x and its truncation share the exponent
+	glm_vec4 const Fract = _mm_sub_ps(x, _mm_cvtepi32_ps(Trunc));
+	// Comparison masks are -1 where true
+	glm_ivec4 const Up = _mm_castps_si128(_mm_cmpge_ps(Fract, _mm_set1_ps(0.5f)));
+	glm_ivec4 const Down = _mm_castps_si128(_mm_cmple_ps(Fract, _mm_set1_ps(-0.5f)));
+	return _mm_add_epi32(_mm_sub_epi32(Trunc, Up), Down);
+}
+
+// round(clamp(x, Min, Max) * Scale), as done by the scalar packing functions
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_quantize(glm_vec4 x, glm_vec4 Min, glm_vec4 Max, glm_vec4 Scale)
+{
+	return glm_vec4_round_away(_mm_mul_ps(_mm_min_ps(_mm_max_ps(x, Min), Max), Scale));
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+GLM_FUNC_QUALIFIER __m256i glm_vec8_round_away(__m256 x)
+{
+	__m256i const Trunc = _mm256_cvttps_epi32(x);
+	__m256 const Fract = _mm256_sub_ps(x, _mm256_cvtepi32_ps(Trunc));
+	__m256i const Up = _mm256_castps_si256(_mm256_cmp_ps(Fract, _mm256_set1_ps(0.5f), _CMP_GE_OQ));
+	__m256i const Down = _mm256_castps_si256(_mm256_cmp_ps(Fract, _mm256_set1_ps(-0.5f), _CMP_LE_OQ));
+	return _mm256_add_epi32(_mm256_sub_epi32(Trunc, Up), Down);
+}
+#endif
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_select(glm_ivec4 Mask, glm_ivec4 a, glm_ivec4 b)
+{
+	return _mm_or_si128(_mm_and_si128(Mask, a), _mm_andnot_si128(Mask, b));
+}
+
+// float to half, rounding to nearest even like F16C. NaN stay NaN and are made quiet.
+// From "float_to_half_fast3_rtne" by Fabian Giesen.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_to_half(glm_vec4 x)
+{
+	glm_ivec4 const Bits = _mm_castps_si128(x);
+	glm_ivec4 const Sign = _mm_and_si128(Bits, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+	glm_ivec4 const Abs = _mm_xor_si128(Bits, Sign);
+
+	// |x| >= 65536: infinity, or NaN keeping the high significand bits
+	glm_ivec4 const IsInfNaN = _mm_cmpgt_epi32(Abs, _mm_set1_epi32(((127 + 16) << 23) - 1));
+	glm_ivec4 const IsNaN = _mm_cmpgt_epi32(Abs, _mm_set1_epi32(0x7f800000));
+	glm_ivec4 const InfNaN = _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(IsNaN, _mm_or_si128(_mm_set1_epi32(0x0200), _mm_srli_epi32(_mm_and_si128(Abs, _mm_set1_epi32(0x007fffff)), 13))));
+
+	// |x| < 2^-14: denormal or zero. Adding 0.5 aligns the 10 significand bits at the bottom
+	// and the FPU rounds them to nearest even.
+	glm_ivec4 const IsDenormal = _mm_cmplt_epi32(Abs, _mm_set1_epi32(113 << 23));
+	glm_vec4 const DenormalMagic = _mm_castsi128_ps(_mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23));
+	glm_ivec4 const Denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(Abs), DenormalMagic)), _mm_castps_si128(DenormalMagic));
+
+	// Normal: rebias the exponent and round to nearest even
+	glm_ivec4 const Odd = _mm_and_si128(_mm_srli_epi32(Abs, 13), _mm_set1_epi32(1));
+	glm_ivec4 const Normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(Abs, _mm_set1_epi32(0xfff - ((127 - 15) << 23))), Odd), 13);
+
+	glm_ivec4 const Result = glm_vec4_select(IsInfNaN, InfNaN, glm_vec4_select(IsDenormal, Denormal, Normal));
+	return _mm_or_si128(Result, _mm_srli_epi32(Sign, 16));
+}
+
+// half to float, exact. From "half_to_float_fast5" by Fabian Giesen.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_from_half(glm_ivec4 h)
+{
+	glm_ivec4 const ExpMask = _mm_set1_epi32(0x7c00 << 13);
+	glm_ivec4 const Shifted = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+	glm_ivec4 const Exp = _mm_and_si128(Shifted, ExpMask);
+	glm_ivec4 const Rebiased = _mm_add_epi32(Shifted, _mm_set1_epi32((127 - 15) << 23));
+
+	// Infinity and NaN: the exponent gets all ones
+	glm_ivec4 const InfNaN = _mm_add_epi32(Rebiased, _mm_set1_epi32((128 - 16) << 23));
+	// Zero and denormal: renormalized by the FPU
+	glm_vec4 const Magic = _mm_castsi128_ps(_mm_set1_epi32(113 << 23));
+	glm_ivec4 const Denormal = _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(Rebiased, _mm_set1_epi32(1 << 23))), Magic));
+
+	glm_ivec4 const Result = glm_vec4_select(_mm_cmpeq_epi32(Exp, ExpMask), InfNaN,
+		glm_vec4_select(_mm_cmpeq_epi32(Exp, _mm_setzero_si128()), Denormal, Rebiased));
+	return _mm_castsi128_ps(_mm_or_si128(Result, _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16)));
+}
+
+// Converts 'count' floats to halfs. 'in' and 'out' don't need to be aligned.
+// With F16C, 8 values are converted per instruction, otherwise 4 with SSE2 integer arithmetic.
+// The remaining values go through a zero padded block.
+GLM_FUNC_QUALIFIER void glm_f32_to_f16_batch(float const* in, glm::uint16* out, std::size_t count)
+{
+	std::size_t i = 0;
+
+#	ifdef GLM_SIMD_F16C
+		for(; i + 8 <= count; i += 8)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+#	endif
+
+	for(; i + 8 <= count; i += 8)
+	{
+		glm_ivec4 const a = glm_vec4_to_half(_mm_loadu_ps(in + i + 0));
+		glm_ivec4 const b = glm_vec4_to_half(_mm_loadu_ps(in + i + 4));
+		// The values fit in 16 bits but packs_epi32 saturates signed: sign extend them first
+		glm_ivec4 const Packed = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), Packed);
+	}
+
+	for(; i < count; i += 4)
+	{
+		std::size_t const n = count - i < 4 ? count - i : 4;
+		float Block[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+		for(std::size_t j = 0; j < n; ++j)
+			Block[j] = in[i + j];
+
+		glm::uint32 Result[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Result), glm_vec4_to_half(_mm_loadu_ps(Block)));
+		for(std::size_t j = 0; j < n; ++j)
+			out[i + j] = static_cast<glm::uint16>(Result[j]);
+	}
+}
+
+// Converts 'count' halfs to floats. 'in' and 'out' don't need to be aligned.
+GLM_FUNC_QUALIFIER void glm_f16_to_f32_batch(glm::uint16 const* in, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+
+#	ifdef GLM_SIMD_F16C
+		for(; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i))));
+#	endif
+
+	for(; i + 8 <= count; i += 8)
+	{
+		glm_ivec4 const h = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+		_mm_storeu_ps(out + i + 0, glm_vec4_from_half(_mm_unpacklo_epi16(h, _mm_setzero_si128())));
+		_mm_storeu_ps(out + i + 4, glm_vec4_from_half(_mm_unpackhi_epi16(h, _mm_setzero_si128())));
+	}
+
+	for(; i < count; i += 4)
+	{
+		std::size_t const n = count - i < 4 ? count - i : 4;
+		glm::uint32 Block[4] = {0, 0, 0, 0};
+		for(std::size_t j = 0; j < n; ++j)
+			Block[j] = in[i + j];
+
+		float Result[4];
+		_mm_storeu_ps(Result, glm_vec4_from_half(_mm_loadu_si128(reinterpret_cast<__m128i const*>(Block))));
+		for(std::size_t j = 0; j < n; ++j)
+			out[i + j] = Result[j];
+	}
+}
+
+// Packs 'count' vec4 stored in 'in' as 4 bytes each, like packUnorm4x8 (Signed == false)
+// or packSnorm4x8 (Signed == true). Scale is 255 or 127.
+// With AVX2, 8 vectors are processed per iteration, otherwise 4, then the remaining vectors through a zero padded block.
+GLM_FUNC_QUALIFIER void glm_pack4x8_batch(float const* in, glm::uint32* out, std::size_t count, bool Signed)
+{
+	glm_vec4 const Min = _mm_set1_ps(Signed ? -1.0f : 0.0f);
+	glm_vec4 const Max = _mm_set1_ps(1.0f);
+	glm_vec4 const Scale = _mm_set1_ps(Signed ? 127.0f : 255.0f);
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	{
+		__m256 const Min2 = _mm256_set1_ps(Signed ? -1.0f : 0.0f);
+		__m256 const Max2 = _mm256_set1_ps(1.0f);
+		__m256 const Scale2 = _mm256_set1_ps(Signed ? 127.0f : 255.0f);
+		// Packing works within each 128 bit lane: vector 0 2 4 6 end up in the low lane
+		__m256i const Order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+		for(; i + 8 <= count; i += 8)
+		{
+			__m256i Quantized[4];
+			for(std::size_t j = 0; j < 4; ++j)
+				Quantized[j] = glm_vec8_round_away(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(in + (i + j * 2) * 4), Min2), Max2), Scale2));
+
+			__m256i const Words01 = _mm256_packs_epi32(Quantized[0], Quantized[1]);
+			__m256i const Words23 = _mm256_packs_epi32(Quantized[2], Quantized[3]);
+			__m256i const Bytes = Signed ? _mm256_packs_epi16(Words01, Words23) : _mm256_packus_epi16(Words01, Words23);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permutevar8x32_epi32(Bytes, Order));
+		}
+	}
+#	endif
+
+	for(; i + 4 <= count; i += 4)
+	{
+		glm_ivec4 const Words01 = _mm_packs_epi32(
+			glm_vec4_quantize(_mm_loadu_ps(in + i * 4 + 0), Min, Max, Scale),
+			glm_vec4_quantize(_mm_loadu_ps(in + i * 4 + 4), Min, Max, Scale));
+		glm_ivec4 const Words23 = _mm_packs_epi32(
+			glm_vec4_quantize(_mm_loadu_ps(in + i * 4 + 8), Min, Max, Scale),
+			glm_vec4_quantize(_mm_loadu_ps(in + i * 4 + 12), Min, Max, Scale));
+		glm_ivec4 const Bytes = Signed ? _mm_packs_epi16(Words01, Words23) : _mm_packus_epi16(Words01, Words23);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), Bytes);
+	}
+
+	if(i < count)
+	{
+		glm_vec4 v[4] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps()};
+		for(std::size_t j = 0; i + j < count; ++j)
+			v[j] = _mm_loadu_ps(in + (i + j) * 4);
+
+		glm_ivec4 const Words01 = _mm_packs_epi32(glm_vec4_quantize(v[0], Min, Max, Scale), glm_vec4_quantize(v[1], Min, Max, Scale));
+		glm_ivec4 const Words23 = _mm_packs_epi32(glm_vec4_quantize(v[2], Min, Max, Scale), glm_vec4_quantize(v[3], Min, Max, Scale));
+		glm::uint32 Result[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Result), Signed ? _mm_packs_epi16(Words01, Words23) : _mm_packus_epi16(Words01, Words23));
+		for(std::size_t j = 0; i + j < count; ++j)
+			out[i + j] = Result[j];
+	}
+}
+
+// Unpacks 4 words of 4 bytes into 4 vectors.
+GLM_FUNC_QUALIFIER void glm_vec4_unpack4x8(glm_ivec4 Bytes, glm_vec4 v[4], bool Signed, glm_vec4 Min, glm_vec4 Max, glm_vec4 Scale)
+{
+	glm_ivec4 Ints[4];
+	if(Signed)
+	{
+		// Widen by placing the values in the high half and shifting them down
+		glm_ivec4 const Lo = _mm_unpacklo_epi8(Bytes, Bytes);
+		glm_ivec4 const Hi = _mm_unpackhi_epi8(Bytes, Bytes);
+		Ints[0] = _mm_srai_epi32(_mm_unpacklo_epi16(Lo, Lo), 24);
+		Ints[1] = _mm_srai_epi32(_mm_unpackhi_epi16(Lo, Lo), 24);
+		Ints[2] = _mm_srai_epi32(_mm_unpacklo_epi16(Hi, Hi), 24);
+		Ints[3] = _mm_srai_epi32(_mm_unpackhi_epi16(Hi, Hi), 24);
+	}
+	else
+	{
+		glm_ivec4 const Zero = _mm_setzero_si128();
+		glm_ivec4 const Lo = _mm_unpacklo_epi8(Bytes, Zero);
+		glm_ivec4 const Hi = _mm_unpackhi_epi8(Bytes, Zero);
+		Ints[0] = _mm_unpacklo_epi16(Lo, Zero);
+		Ints[1] = _mm_unpackhi_epi16(Lo, Zero);
+		Ints[2] = _mm_unpacklo_epi16(Hi, Zero);
+		Ints[3] = _mm_unpackhi_epi16(Hi, Zero);
+	}
+
+	for(std::size_t j = 0; j < 4; ++j)
+		v[j] = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(Ints[j]), Scale), Min), Max);
+}
+
+// Unpacks 4 bytes per vector, like unpackUnorm4x8 (Signed == false) or unpackSnorm4x8 (Signed == true).
+GLM_FUNC_QUALIFIER void glm_unpack4x8_batch(glm::uint32 const* in, float* out, std::size_t count, bool Signed)
+{
+	// Same constants and clamp as the scalar functions, so the results are identical
+	glm_vec4 const Scale = _mm_set1_ps(Signed ? 0.0078740157480315f : 0.0039215686274509803921568627451f);
+	glm_vec4 const Min = _mm_set1_ps(Signed ? -1.0f : 0.0f);
+	glm_vec4 const Max = _mm_set1_ps(1.0f);
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	{
+		__m256 const Scale2 = _mm256_set1_ps(Signed ? 0.0078740157480315f : 0.0039215686274509803921568627451f);
+		__m256 const Min2 = _mm256_set1_ps(Signed ? -1.0f : 0.0f);
+		__m256 const Max2 = _mm256_set1_ps(1.0f);
+
+		// Each 8 bytes widen to 2 vectors
+		for(; i + 2 <= count; i += 2)
+		{
+			__m128i const Bytes = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(in + i));
+			__m256i const Ints = Signed ? _mm256_cvtepi8_epi32(Bytes) : _mm256_cvtepu8_epi32(Bytes);
+			__m256 const v = _mm256_mul_ps(_mm256_cvtepi32_ps(Ints), Scale2);
+			_mm256_storeu_ps(out + i * 4, _mm256_min_ps(_mm256_max_ps(v, Min2), Max2));
+		}
+	}
+#	endif
+
+	for(; i + 4 <= count; i += 4)
+	{
+		glm_vec4 v[4];
+		glm_vec4_unpack4x8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i)), v, Signed, Min, Max, Scale);
+		_mm_storeu_ps(out + i * 4 + 0, v[0]);
+		_mm_storeu_ps(out + i * 4 + 4, v[1]);
+		_mm_storeu_ps(out + i * 4 + 8, v[2]);
+		_mm_storeu_ps(out + i * 4 + 12, v[3]);
+	}
+
+	if(i < count)
+	{
+		glm::uint32 Block[4] = {0, 0, 0, 0};
+		for(std::size_t j = 0; i + j < count; ++j)
+			Block[j] = in[i + j];
+
+		glm_vec4 v[4];
+		glm_vec4_unpack4x8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(Block)), v, Signed, Min, Max, Scale);
+		for(std::size_t j = 0; i + j < count; ++j)
+			_mm_storeu_ps(out + (i + j) * 4, v[j]);
+	}
+}
+
+// Packs 4 vectors transposed into x, y, z and w as 10:10:10:2 bits.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_pack3x10_1x2(glm_vec4 v[4], glm_vec4 Min, glm_vec4 Max, glm_vec4 ScaleXYZ, glm_vec4 ScaleW)
+{
+	_MM_TRANSPOSE4_PS(v[0], v[1], v[2], v[3]);
+
+	glm_ivec4 const Mask = _mm_set1_epi32(0x3ff);
+	glm_ivec4 const x = _mm_and_si128(glm_vec4_quantize(v[0], Min, Max, ScaleXYZ), Mask);
+	glm_ivec4 const y = _mm_and_si128(glm_vec4_quantize(v[1], Min, Max, ScaleXYZ), Mask);
+	glm_ivec4 const z = _mm_and_si128(glm_vec4_quantize(v[2], Min, Max, ScaleXYZ), Mask);
+	glm_ivec4 const w = glm_vec4_quantize(v[3], Min, Max, ScaleW);
+
+	return _mm_or_si128(_mm_or_si128(x, _mm_slli_epi32(y, 10)), _mm_or_si128(_mm_slli_epi32(z, 20), _mm_slli_epi32(w, 30)));
+}
+
+// Packs 'count' vec4 stored in 'in' as 10:10:10:2 bits each, like packUnorm3x10_1x2 (Signed == false)
+// or packSnorm3x10_1x2 (Signed == true).
+// With AVX2, 8 vectors are processed per iteration, otherwise 4, then the remaining vectors through a zero padded block.
+GLM_FUNC_QUALIFIER void glm_pack3x10_1x2_batch(float const* in, glm::uint32* out, std::size_t count, bool Signed)
+{
+	glm_vec4 const Min = _mm_set1_ps(Signed ? -1.0f : 0.0f);
+	glm_vec4 const Max = _mm_set1_ps(1.0f);
+	glm_vec4 const ScaleXYZ = _mm_set1_ps(Signed ? 511.0f : 1023.0f);
+	glm_vec4 const ScaleW = _mm_set1_ps(Signed ? 1.0f : 3.0f);
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	{
+		__m256 const Min2 = _mm256_set1_ps(Signed ? -1.0f : 0.0f);
+		__m256 const Max2 = _mm256_set1_ps(1.0f);
+		__m256 const Scale2[4] = {
+			_mm256_set1_ps(Signed ? 511.0f : 1023.0f),
+			_mm256_set1_ps(Signed ? 511.0f : 1023.0f),
+			_mm256_set1_ps(Signed ? 511.0f : 1023.0f),
+			_mm256_set1_ps(Signed ? 1.0f : 3.0f)};
+		__m256i const Mask = _mm256_set1_epi32(0x3ff);
+		// The transpose works within each 128 bit lane: vector 0 2 4 6 end up in the low lane
+		__m256i const Order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+		for(; i + 8 <= count; i += 8)
+		{
+			__m256 const r0 = _mm256_loadu_ps(in + i * 4 + 0);
+			__m256 const r1 = _mm256_loadu_ps(in + i * 4 + 8);
+			__m256 const r2 = _mm256_loadu_ps(in + i * 4 + 16);
+			__m256 const r3 = _mm256_loadu_ps(in + i * 4 + 24);
+
+			__m256 const t0 = _mm256_unpacklo_ps(r0, r1);
+			__m256 const t1 = _mm256_unpackhi_ps(r0, r1);
+			__m256 const t2 = _mm256_unpacklo_ps(r2, r3);
+			__m256 const t3 = _mm256_unpackhi_ps(r2, r3);
+			__m256 const Components[4] = {
+				_mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)),
+				_mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)),
+				_mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)),
+				_mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2))};
+
+			__m256i Quantized[4];
+			for(std::size_t j = 0; j < 4; ++j)
+				Quantized[j] = glm_vec8_round_away(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(Components[j], Min2), Max2), Scale2[j]));
+
+			__m256i const Packed = _mm256_or_si256(
+				_mm256_or_si256(_mm256_and_si256(Quantized[0], Mask), _mm256_slli_epi32(_mm256_and_si256(Quantized[1], Mask), 10)),
+				_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(Quantized[2], Mask), 20), _mm256_slli_epi32(Quantized[3], 30)));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permutevar8x32_epi32(Packed, Order));
+		}
+	}
+#	endif
+
+	for(; i + 4 <= count; i += 4)
+	{
+		glm_vec4 v[4] = {
+			_mm_loadu_ps(in + i * 4 + 0),
+			_mm_loadu_ps(in + i * 4 + 4),
+			_mm_loadu_ps(in + i * 4 + 8),
+			_mm_loadu_ps(in + i * 4 + 12)};
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), glm_vec4_pack3x10_1x2(v, Min, Max, ScaleXYZ, ScaleW));
+	}
+
+	if(i < count)
+	{
+		glm_vec4 v[4] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps()};
+		for(std::size_t j = 0; i + j < count; ++j)
+			v[j] = _mm_loadu_ps(in + (i + j) * 4);
+
+		glm::uint32 Result[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Result), glm_vec4_pack3x10_1x2(v, Min, Max, ScaleXYZ, ScaleW));
+		for(std::size_t j = 0; i + j < count; ++j)
+			out[i + j] = Result[j];
+	}
+}
+
+// Unpacks 4 words of 10:10:10:2 bits into 4 vectors.
+GLM_FUNC_QUALIFIER void glm_vec4_unpack3x10_1x2(glm_ivec4 p, glm_vec4 v[4], bool Signed, glm_vec4 Min, glm_vec4 Max, glm_vec4 ScaleXYZ, glm_vec4 ScaleW)
+{
+	glm_ivec4 const Mask = _mm_set1_epi32(0x3ff);
+	// Signed fields are shifted to the top and back to extend their sign
+	glm_ivec4 const x = Signed ? _mm_srai_epi32(_mm_slli_epi32(p, 22), 22) : _mm_and_si128(p, Mask);
+	glm_ivec4 const y = Signed ? _mm_srai_epi32(_mm_slli_epi32(p, 12), 22) : _mm_and_si128(_mm_srli_epi32(p, 10), Mask);
+	glm_ivec4 const z = Signed ? _mm_srai_epi32(_mm_slli_epi32(p, 2), 22) : _mm_and_si128(_mm_srli_epi32(p, 20), Mask);
+	glm_ivec4 const w = Signed ? _mm_srai_epi32(p, 30) : _mm_srli_epi32(p, 30);
+
+	v[0] = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(x), ScaleXYZ), Min), Max);
+	v[1] = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(y), ScaleXYZ), Min), Max);
+	v[2] = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(z), ScaleXYZ), Min), Max);
+	v[3] = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(w), ScaleW), Min), Max);
+
+	_MM_TRANSPOSE4_PS(v[0], v[1], v[2], v[3]);
+}
+
+// Unpacks 10:10:10:2 bits per vector, like unpackUnorm3x10_1x2 (Signed == false)
+// or unpackSnorm3x10_1x2 (Signed == true).
+GLM_FUNC_QUALIFIER void glm_unpack3x10_1x2_batch(glm::uint32 const* in, float* out, std::size_t count, bool Signed)
+{
+	// Same constants and clamp as the scalar functions, so the results are identical
+	glm_vec4 const Min = _mm_set1_ps(Signed ? -1.0f : 0.0f);
+	glm_vec4 const Max = _mm_set1_ps(1.0f);
+	glm_vec4 const ScaleXYZ = _mm_set1_ps(Signed ? 1.f / 511.f : 1.0f / 1023.f);
+	glm_vec4 const ScaleW = _mm_set1_ps(Signed ? 1.f : 1.0f / 3.f);
+
+	std::size_t i = 0;
+	for(; i + 4 <= count; i += 4)
+	{
+		glm_vec4 v[4];
+		glm_vec4_unpack3x10_1x2(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i)), v, Signed, Min, Max, ScaleXYZ, ScaleW);
+		_mm_storeu_ps(out + i * 4 + 0, v[0]);
+		_mm_storeu_ps(out + i * 4 + 4, v[1]);
+		_mm_storeu_ps(out + i * 4 + 8, v[2]);
+		_mm_storeu_ps(out + i * 4 + 12, v[3]);
+	}
+
+	if(i < count)
+	{
+		glm::uint32 Block[4] = {0, 0, 0, 0};
+		for(std::size_t j = 0; i + j < count; ++j)
+			Block[j] = in[i + j];
+
+		glm_vec4 v[4];
+		glm_vec4_unpack3x10_1x2(_mm_loadu_si128(reinterpret_cast<__m128i const*>(Block)), v, Signed, Min, Max, ScaleXYZ, ScaleW);
+		for(std::size_t j = 0; i + j < count; ++j)
+			_mm_storeu_ps(out + (i + j) * 4, v[j]);
+	}
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
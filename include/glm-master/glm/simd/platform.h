@@ -304,7 +304,7 @@
 ///////////////////////////////////////////////////////////////////////////////////
 // Instruction sets
 
-// User defines: GLM_FORCE_PURE GLM_FORCE_INTRINSICS GLM_FORCE_SSE2 GLM_FORCE_SSE3 GLM_FORCE_AVX GLM_FORCE_AVX2 GLM_FORCE_AVX2
+// User defines: GLM_FORCE_PURE GLM_FORCE_INTRINSICS GLM_FORCE_SSE2 GLM_FORCE_SSE3 GLM_FORCE_AVX GLM_FORCE_AVX2 GLM_FORCE_AVX512
 
 #define GLM_ARCH_MIPS_BIT	  (0x10000000)
 #define GLM_ARCH_PPC_BIT	  (0x20000000)
@@ -323,6 +323,7 @@
 #define GLM_ARCH_SSE42_BIT	(0x00000040)
 #define GLM_ARCH_AVX_BIT	(0x00000080)
 #define GLM_ARCH_AVX2_BIT	(0x00000100)
+#define GLM_ARCH_AVX512_BIT	(0x00000200)
 
 #define GLM_ARCH_UNKNOWN	(0)
 #define GLM_ARCH_X86		(GLM_ARCH_X86_BIT)
@@ -334,6 +335,7 @@
 #define GLM_ARCH_SSE42		(GLM_ARCH_SSE42_BIT | GLM_ARCH_SSE41)
 #define GLM_ARCH_AVX		(GLM_ARCH_AVX_BIT | GLM_ARCH_SSE42)
 #define GLM_ARCH_AVX2		(GLM_ARCH_AVX2_BIT | GLM_ARCH_AVX)
+#define GLM_ARCH_AVX512		(GLM_ARCH_AVX512_BIT | GLM_ARCH_AVX2)
 #define GLM_ARCH_ARM		(GLM_ARCH_ARM_BIT)
 #define GLM_ARCH_ARMV8		(GLM_ARCH_NEON_BIT | GLM_ARCH_SIMD_BIT | GLM_ARCH_ARM | GLM_ARCH_ARMV8_BIT)
 #define GLM_ARCH_NEON		(GLM_ARCH_NEON_BIT | GLM_ARCH_SIMD_BIT | GLM_ARCH_ARM)
@@ -349,6 +351,9 @@
 #		define GLM_ARCH (GLM_ARCH_NEON)
 #	endif
 #	define GLM_FORCE_INTRINSICS
+#elif defined(GLM_FORCE_AVX512)
+#	define GLM_ARCH (GLM_ARCH_AVX512)
+#	define GLM_FORCE_INTRINSICS
 #elif defined(GLM_FORCE_AVX2)
 #	define GLM_ARCH (GLM_ARCH_AVX2)
 #	define GLM_FORCE_INTRINSICS
@@ -374,7 +379,9 @@
 #	define GLM_ARCH (GLM_ARCH_SSE)
 #	define GLM_FORCE_INTRINSICS
 #elif defined(GLM_FORCE_INTRINSICS) && !defined(GLM_FORCE_XYZW_ONLY)
-#	if defined(__AVX2__)
+#	if defined(__AVX512F__)
+#		define GLM_ARCH (GLM_ARCH_AVX512)
+#	elif defined(__AVX2__)
 #		define GLM_ARCH (GLM_ARCH_AVX2)
 #	elif defined(__AVX__)
 #		define GLM_ARCH (GLM_ARCH_AVX)
@@ -417,7 +424,9 @@
 #	endif
 #endif
 
-#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+#	include <immintrin.h>
+#elif GLM_ARCH & GLM_ARCH_AVX2_BIT
 #	include <immintrin.h>
 #elif GLM_ARCH & GLM_ARCH_AVX_BIT
 #	include <immintrin.h>
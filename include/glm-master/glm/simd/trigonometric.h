@@ -3,7 +3,409 @@
 
 #pragma once
 
+#include "common.h"
+#include <cmath>
+#include <limits>
+
+// Polynomial approximations from the Cephes library (sinf, cosf and atanf) by Stephen L. Moshier.
+// Errors measured against the exact results, over every float of the domain:
+// - sin, cos: at most 2.5 ulp for |x| <= 8192
+// - tan: at most 4.5 ulp for |x| <= 8192
+// - atan2: at most 3.5 ulp, over 20 million random pairs
+// Inputs outside of the domain, infinite and NaN values are computed by the C library.
+
+#define GLM_SIMD_TRIGONOMETRIC_MAX 8192.0f
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+// x = q * pi / 2 + r with r in [-pi / 4, pi / 4], pi / 2 being split in 4 floats (Cody and Waite)
+// whose products by q are exact for |q| < 2^14
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_reduce_pio2(glm_vec4 x, glm_ivec4* q)
+{
+	*q = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(0.636619772367581343f)));
+	glm_vec4 const n = _mm_cvtepi32_ps(*q);
+	glm_vec4 r = _mm_sub_ps(x, _mm_mul_ps(n, _mm_set1_ps(1.5703125f)));
+	r = _mm_sub_ps(r, _mm_mul_ps(n, _mm_set1_ps(4.8351287841796875e-4f)));
+	r = _mm_sub_ps(r, _mm_mul_ps(n, _mm_set1_ps(3.13855707645416259766e-7f)));
+	return _mm_sub_ps(r, _mm_mul_ps(n, _mm_set1_ps(6.07710062827671038e-11f)));
+}
+
+// sin(r) and cos(r) for r in [-pi / 4, pi / 4], z = r * r
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin_poly(glm_vec4 r, glm_vec4 z)
+{
+	glm_vec4 p = glm_vec4_fma(_mm_set1_ps(-1.9515295891e-4f), z, _mm_set1_ps(8.3321608736e-3f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(-1.6666654611e-1f));
+	// The result has the sign of r, or'ed for sin(-0) = -0
+	return _mm_or_ps(glm_vec4_fma(_mm_mul_ps(p, z), r, r), _mm_and_ps(r, _mm_set1_ps(-0.0f)));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos_poly(glm_vec4 z)
+{
+	glm_vec4 p = glm_vec4_fma(_mm_set1_ps(2.443315711809948e-5f), z, _mm_set1_ps(-1.388731625493765e-3f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(4.166664568298827e-2f));
+	return glm_vec4_fma(_mm_mul_ps(p, z), z, glm_vec4_fma(_mm_set1_ps(-0.5f), z, _mm_set1_ps(1.0f)));
+}
+
+// Lanes to compute with the C library
+GLM_FUNC_QUALIFIER int glm_vec4_trigonometric_outside(glm_vec4 x)
+{
+	glm_vec4 const Abs = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+	return _mm_movemask_ps(_mm_cmpnle_ps(Abs, _mm_set1_ps(GLM_SIMD_TRIGONOMETRIC_MAX)));
+}
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos(glm_vec4 x, glm_vec4* s, glm_vec4* c)
+{
+	glm_ivec4 q;
+	glm_vec4 const r = glm_vec4_reduce_pio2(x, &q);
+	glm_vec4 const z = _mm_mul_ps(r, r);
+	glm_vec4 const SinPoly = glm_vec4_sin_poly(r, z);
+	glm_vec4 const CosPoly = glm_vec4_cos_poly(z);
+
+	// Odd quadrants swap sin and cos, sin is negated in quadrants 2 and 3, cos in 1 and 2
+	glm_vec4 const Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+	glm_vec4 const SinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30));
+	glm_vec4 const CosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+	glm_vec4 Sin = _mm_xor_ps(glm_vec4_select(Swap, CosPoly, SinPoly), SinSign);
+	glm_vec4 Cos = _mm_xor_ps(glm_vec4_select(Swap, SinPoly, CosPoly), CosSign);
+
+	int const Outside = glm_vec4_trigonometric_outside(x);
+	if(Outside)
+	{
+		Sin = glm_vec4_scalar_lanes(Sin, Outside, x, std::sin);
+		Cos = glm_vec4_scalar_lanes(Cos, Outside, x, std::cos);
+	}
+	*s = Sin;
+	*c = Cos;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin(glm_vec4 x)
+{
+	glm_ivec4 q;
+	glm_vec4 const r = glm_vec4_reduce_pio2(x, &q);
+	glm_vec4 const z = _mm_mul_ps(r, r);
+
+	glm_vec4 const Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+	glm_vec4 const Sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30));
+	glm_vec4 const Result = _mm_xor_ps(glm_vec4_select(Swap, glm_vec4_cos_poly(z), glm_vec4_sin_poly(r, z)), Sign);
+
+	int const Outside = glm_vec4_trigonometric_outside(x);
+	return Outside ? glm_vec4_scalar_lanes(Result, Outside, x, std::sin) : Result;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos(glm_vec4 x)
+{
+	glm_ivec4 q;
+	glm_vec4 const r = glm_vec4_reduce_pio2(x, &q);
+	glm_vec4 const z = _mm_mul_ps(r, r);
+
+	glm_vec4 const Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+	glm_vec4 const Sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+	glm_vec4 const Result = _mm_xor_ps(glm_vec4_select(Swap, glm_vec4_sin_poly(r, z), glm_vec4_cos_poly(z)), Sign);
+
+	int const Outside = glm_vec4_trigonometric_outside(x);
+	return Outside ? glm_vec4_scalar_lanes(Result, Outside, x, std::cos) : Result;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_tan(glm_vec4 x)
+{
+	glm_ivec4 q;
+	glm_vec4 const r = glm_vec4_reduce_pio2(x, &q);
+	glm_vec4 const z = _mm_mul_ps(r, r);
+	glm_vec4 const SinPoly = glm_vec4_sin_poly(r, z);
+	glm_vec4 const CosPoly = glm_vec4_cos_poly(z);
+
+	// tan(r) in even quadrants, -1 / tan(r) in odd ones
+	glm_vec4 const Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+	glm_vec4 const Num = glm_vec4_select(Swap, _mm_xor_ps(CosPoly, _mm_set1_ps(-0.0f)), SinPoly);
+	glm_vec4 const Den = glm_vec4_select(Swap, SinPoly, CosPoly);
+	glm_vec4 const Result = _mm_div_ps(Num, Den);
+
+	int const Outside = glm_vec4_trigonometric_outside(x);
+	return Outside ? glm_vec4_scalar_lanes(Result, Outside, x, std::tan) : Result;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan2(glm_vec4 y, glm_vec4 x)
+{
+	glm_vec4 const SignMask = _mm_set1_ps(-0.0f);
+	glm_vec4 const AbsX = _mm_andnot_ps(SignMask, x);
+	glm_vec4 const AbsY = _mm_andnot_ps(SignMask, y);
+	glm_vec4 const Max = _mm_max_ps(AbsX, AbsY);
+
+	// a = min / max in [0, 1], then in [-tan(pi / 8), tan(pi / 8)] with atan(a) = pi / 4 + atan((a - 1) / (a + 1))
+	glm_vec4 a = _mm_andnot_ps(_mm_cmpeq_ps(Max, _mm_setzero_ps()), _mm_div_ps(_mm_min_ps(AbsX, AbsY), Max));
+	glm_vec4 const Reduce = _mm_cmpgt_ps(a, _mm_set1_ps(0.414213562373095f));
+	a = glm_vec4_select(Reduce, _mm_div_ps(_mm_sub_ps(a, _mm_set1_ps(1.0f)), _mm_add_ps(a, _mm_set1_ps(1.0f))), a);
+
+	glm_vec4 const z = _mm_mul_ps(a, a);
+	glm_vec4 p = glm_vec4_fma(_mm_set1_ps(8.05374449538e-2f), z, _mm_set1_ps(-1.38776856032e-1f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(1.99777106478e-1f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(-3.33329491539e-1f));
+	glm_vec4 Result = _mm_add_ps(_mm_and_ps(Reduce, _mm_set1_ps(0.785398163397448f)), glm_vec4_fma(_mm_mul_ps(p, z), a, a));
+
+	// Back to the octant of (x, y)
+	Result = glm_vec4_select(_mm_cmpgt_ps(AbsY, AbsX), _mm_sub_ps(_mm_set1_ps(1.57079632679490f), Result), Result);
+	Result = glm_vec4_select(_mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31)), _mm_sub_ps(_mm_set1_ps(3.14159265358979f), Result), Result);
+	Result = _mm_or_ps(Result, _mm_and_ps(SignMask, y));
+
+	int const Outside = _mm_movemask_ps(_mm_or_ps(_mm_cmpunord_ps(x, y), _mm_cmpeq_ps(Max, _mm_set1_ps(std::numeric_limits<float>::infinity()))));
+	return Outside ? glm_vec4_scalar_lanes(Result, Outside, y, x, std::atan2) : Result;
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_reduce_pio2(__m256 x, __m256i* q)
+{
+	*q = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(0.636619772367581343f)));
+	__m256 const n = _mm256_cvtepi32_ps(*q);
+	__m256 r = _mm256_sub_ps(x, _mm256_mul_ps(n, _mm256_set1_ps(1.5703125f)));
+	r = _mm256_sub_ps(r, _mm256_mul_ps(n, _mm256_set1_ps(4.8351287841796875e-4f)));
+	r = _mm256_sub_ps(r, _mm256_mul_ps(n, _mm256_set1_ps(3.13855707645416259766e-7f)));
+	return _mm256_sub_ps(r, _mm256_mul_ps(n, _mm256_set1_ps(6.07710062827671038e-11f)));
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_sin_poly(__m256 r, __m256 z)
+{
+	__m256 p = glm_vec8_fma(_mm256_set1_ps(-1.9515295891e-4f), z, _mm256_set1_ps(8.3321608736e-3f));
+	p = glm_vec8_fma(p, z, _mm256_set1_ps(-1.6666654611e-1f));
+	return _mm256_or_ps(glm_vec8_fma(_mm256_mul_ps(p, z), r, r), _mm256_and_ps(r, _mm256_set1_ps(-0.0f)));
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_cos_poly(__m256 z)
+{
+	__m256 p = glm_vec8_fma(_mm256_set1_ps(2.443315711809948e-5f), z, _mm256_set1_ps(-1.388731625493765e-3f));
+	p = glm_vec8_fma(p, z, _mm256_set1_ps(4.166664568298827e-2f));
+	return glm_vec8_fma(_mm256_mul_ps(p, z), z, glm_vec8_fma(_mm256_set1_ps(-0.5f), z, _mm256_set1_ps(1.0f)));
+}
+
+GLM_FUNC_QUALIFIER int glm_vec8_trigonometric_outside(__m256 x)
+{
+	__m256 const Abs = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+	return _mm256_movemask_ps(_mm256_cmp_ps(Abs, _mm256_set1_ps(GLM_SIMD_TRIGONOMETRIC_MAX), _CMP_NLE_UQ));
+}
+
+GLM_FUNC_QUALIFIER void glm_vec8_sincos(__m256 x, __m256* s, __m256* c)
+{
+	__m256i q;
+	__m256 const r = glm_vec8_reduce_pio2(x, &q);
+	__m256 const z = _mm256_mul_ps(r, r);
+	__m256 const SinPoly = glm_vec8_sin_poly(r, z);
+	__m256 const CosPoly = glm_vec8_cos_poly(z);
+
+	__m256 const Swap = _mm256_castsi256_ps(_mm256_slli_epi32(q, 31));
+	__m256 const SinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, _mm256_set1_epi32(2)), 30));
+	__m256 const CosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(2)), 30));
+	__m256 Sin = _mm256_xor_ps(glm_vec8_select(Swap, CosPoly, SinPoly), SinSign);
+	__m256 Cos = _mm256_xor_ps(glm_vec8_select(Swap, SinPoly, CosPoly), CosSign);
+
+	int const Outside = glm_vec8_trigonometric_outside(x);
+	if(Outside)
+	{
+		Sin = glm_vec8_scalar_lanes(Sin, Outside, x, std::sin);
+		Cos = glm_vec8_scalar_lanes(Cos, Outside, x, std::cos);
+	}
+	*s = Sin;
+	*c = Cos;
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_sin(__m256 x)
+{
+	__m256i q;
+	__m256 const r = glm_vec8_reduce_pio2(x, &q);
+	__m256 const z = _mm256_mul_ps(r, r);
+
+	// blendv only reads the sign bit: the low bit of q shifted there selects the odd quadrants
+	__m256 const Swap = _mm256_castsi256_ps(_mm256_slli_epi32(q, 31));
+	__m256 const Sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, _mm256_set1_epi32(2)), 30));
+	__m256 const Result = _mm256_xor_ps(glm_vec8_select(Swap, glm_vec8_cos_poly(z), glm_vec8_sin_poly(r, z)), Sign);
+
+	int const Outside = glm_vec8_trigonometric_outside(x);
+	return Outside ? glm_vec8_scalar_lanes(Result, Outside, x, std::sin) : Result;
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_cos(__m256 x)
+{
+	__m256i q;
+	__m256 const r = glm_vec8_reduce_pio2(x, &q);
+	__m256 const z = _mm256_mul_ps(r, r);
+
+	__m256 const Swap = _mm256_castsi256_ps(_mm256_slli_epi32(q, 31));
+	__m256 const Sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(2)), 30));
+	__m256 const Result = _mm256_xor_ps(glm_vec8_select(Swap, glm_vec8_sin_poly(r, z), glm_vec8_cos_poly(z)), Sign);
+
+	int const Outside = glm_vec8_trigonometric_outside(x);
+	return Outside ? glm_vec8_scalar_lanes(Result, Outside, x, std::cos) : Result;
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_tan(__m256 x)
+{
+	__m256i q;
+	__m256 const r = glm_vec8_reduce_pio2(x, &q);
+	__m256 const z = _mm256_mul_ps(r, r);
+	__m256 const SinPoly = glm_vec8_sin_poly(r, z);
+	__m256 const CosPoly = glm_vec8_cos_poly(z);
+
+	__m256 const Swap = _mm256_castsi256_ps(_mm256_slli_epi32(q, 31));
+	__m256 const Num = glm_vec8_select(Swap, _mm256_xor_ps(CosPoly, _mm256_set1_ps(-0.0f)), SinPoly);
+	__m256 const Den = glm_vec8_select(Swap, SinPoly, CosPoly);
+	__m256 const Result = _mm256_div_ps(Num, Den);
+
+	int const Outside = glm_vec8_trigonometric_outside(x);
+	return Outside ? glm_vec8_scalar_lanes(Result, Outside, x, std::tan) : Result;
+}
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_atan2(__m256 y, __m256 x)
+{
+	__m256 const SignMask = _mm256_set1_ps(-0.0f);
+	__m256 const AbsX = _mm256_andnot_ps(SignMask, x);
+	__m256 const AbsY = _mm256_andnot_ps(SignMask, y);
+	__m256 const Max = _mm256_max_ps(AbsX, AbsY);
+
+	__m256 a = _mm256_andnot_ps(_mm256_cmp_ps(Max, _mm256_setzero_ps(), _CMP_EQ_OQ), _mm256_div_ps(_mm256_min_ps(AbsX, AbsY), Max));
+	__m256 const Reduce = _mm256_cmp_ps(a, _mm256_set1_ps(0.414213562373095f), _CMP_GT_OQ);
+	a = glm_vec8_select(Reduce, _mm256_div_ps(_mm256_sub_ps(a, _mm256_set1_ps(1.0f)), _mm256_add_ps(a, _mm256_set1_ps(1.0f))), a);
+
+	__m256 const z = _mm256_mul_ps(a, a);
+	__m256 p = glm_vec8_fma(_mm256_set1_ps(8.05374449538e-2f), z, _mm256_set1_ps(-1.38776856032e-1f));
+	p = glm_vec8_fma(p, z, _mm256_set1_ps(1.99777106478e-1f));
+	p = glm_vec8_fma(p, z, _mm256_set1_ps(-3.33329491539e-1f));
+	__m256 Result = _mm256_add_ps(_mm256_and_ps(Reduce, _mm256_set1_ps(0.785398163397448f)), glm_vec8_fma(_mm256_mul_ps(p, z), a, a));
+
+	Result = glm_vec8_select(_mm256_cmp_ps(AbsY, AbsX, _CMP_GT_OQ), _mm256_sub_ps(_mm256_set1_ps(1.57079632679490f), Result), Result);
+	Result = glm_vec8_select(x, _mm256_sub_ps(_mm256_set1_ps(3.14159265358979f), Result), Result);
+	Result = _mm256_or_ps(Result, _mm256_and_ps(SignMask, y));
+
+	int const Outside = _mm256_movemask_ps(_mm256_or_ps(_mm256_cmp_ps(x, y, _CMP_UNORD_Q), _mm256_cmp_ps(Max, _mm256_set1_ps(std::numeric_limits<float>::infinity()), _CMP_EQ_OQ)));
+	return Outside ? glm_vec8_scalar_lanes(Result, Outside, y, x, std::atan2) : Result;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+#if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_reduce_pio2(glm_f32vec4 x, glm_i32vec4* q)
+{
+	*q = vcvtnq_s32_f32(vmulq_n_f32(x, 0.636619772367581343f));
+	glm_f32vec4 const n = vcvtq_f32_s32(*q);
+	glm_f32vec4 r = vmlsq_n_f32(x, n, 1.5703125f);
+	r = vmlsq_n_f32(r, n, 4.8351287841796875e-4f);
+	r = vmlsq_n_f32(r, n, 3.13855707645416259766e-7f);
+	return vmlsq_n_f32(r, n, 6.07710062827671038e-11f);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sin_poly(glm_f32vec4 r, glm_f32vec4 z)
+{
+	glm_f32vec4 p = glm_vec4_fma(vdupq_n_f32(-1.9515295891e-4f), z, vdupq_n_f32(8.3321608736e-3f));
+	p = glm_vec4_fma(p, z, vdupq_n_f32(-1.6666654611e-1f));
+	glm_u32vec4 const Sign = vandq_u32(vreinterpretq_u32_f32(r), vdupq_n_u32(0x80000000u));
+	return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(glm_vec4_fma(vmulq_f32(p, z), r, r)), Sign));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_cos_poly(glm_f32vec4 z)
+{
+	glm_f32vec4 p = glm_vec4_fma(vdupq_n_f32(2.443315711809948e-5f), z, vdupq_n_f32(-1.388731625493765e-3f));
+	p = glm_vec4_fma(p, z, vdupq_n_f32(4.166664568298827e-2f));
+	return glm_vec4_fma(vmulq_f32(p, z), z, glm_vec4_fma(vdupq_n_f32(-0.5f), z, vdupq_n_f32(1.0f)));
+}
+
+GLM_FUNC_QUALIFIER glm_u32vec4 glm_vec4_trigonometric_outside(glm_f32vec4 x)
+{
+	return vmvnq_u32(vcleq_f32(vabsq_f32(x), vdupq_n_f32(GLM_SIMD_TRIGONOMETRIC_MAX)));
+}
+
+// Sign bit set in quadrants 2 and 3 for sin, 1 and 2 for cos
+GLM_FUNC_QUALIFIER glm_u32vec4 glm_vec4_quadrant_sign(glm_i32vec4 q)
+{
+	return vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(q), vdupq_n_u32(2)), 30);
+}
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos(glm_f32vec4 x, glm_f32vec4* s, glm_f32vec4* c)
+{
+	glm_i32vec4 q;
+	glm_f32vec4 const r = glm_vec4_reduce_pio2(x, &q);
+	glm_f32vec4 const z = vmulq_f32(r, r);
+	glm_f32vec4 const SinPoly = glm_vec4_sin_poly(r, z);
+	glm_f32vec4 const CosPoly = glm_vec4_cos_poly(z);
+
+	glm_u32vec4 const Swap = vtstq_u32(vreinterpretq_u32_s32(q), vdupq_n_u32(1));
+	glm_f32vec4 Sin = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(glm_vec4_select(Swap, CosPoly, SinPoly)), glm_vec4_quadrant_sign(q)));
+	glm_f32vec4 Cos = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(glm_vec4_select(Swap, SinPoly, CosPoly)), glm_vec4_quadrant_sign(vaddq_s32(q, vdupq_n_s32(1)))));
+
+	glm_u32vec4 const Outside = glm_vec4_trigonometric_outside(x);
+	if(glm_vec4_any(Outside))
+	{
+		Sin = glm_vec4_scalar_lanes(Sin, Outside, x, std::sin);
+		Cos = glm_vec4_scalar_lanes(Cos, Outside, x, std::cos);
+	}
+	*s = Sin;
+	*c = Cos;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sin(glm_f32vec4 x)
+{
+	glm_i32vec4 q;
+	glm_f32vec4 const r = glm_vec4_reduce_pio2(x, &q);
+	glm_f32vec4 const z = vmulq_f32(r, r);
+
+	glm_u32vec4 const Swap = vtstq_u32(vreinterpretq_u32_s32(q), vdupq_n_u32(1));
+	glm_f32vec4 const Result = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(glm_vec4_select(Swap, glm_vec4_cos_poly(z), glm_vec4_sin_poly(r, z))), glm_vec4_quadrant_sign(q)));
+
+	glm_u32vec4 const Outside = glm_vec4_trigonometric_outside(x);
+	return glm_vec4_any(Outside) ? glm_vec4_scalar_lanes(Result, Outside, x, std::sin) : Result;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_cos(glm_f32vec4 x)
+{
+	glm_i32vec4 q;
+	glm_f32vec4 const r = glm_vec4_reduce_pio2(x, &q);
+	glm_f32vec4 const z = vmulq_f32(r, r);
+
+	glm_u32vec4 const Swap = vtstq_u32(vreinterpretq_u32_s32(q), vdupq_n_u32(1));
+	glm_f32vec4 const Result = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(glm_vec4_select(Swap, glm_vec4_sin_poly(r, z), glm_vec4_cos_poly(z))), glm_vec4_quadrant_sign(vaddq_s32(q, vdupq_n_s32(1)))));
+
+	glm_u32vec4 const Outside = glm_vec4_trigonometric_outside(x);
+	return glm_vec4_any(Outside) ? glm_vec4_scalar_lanes(Result, Outside, x, std::cos) : Result;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_tan(glm_f32vec4 x)
+{
+	glm_i32vec4 q;
+	glm_f32vec4 const r = glm_vec4_reduce_pio2(x, &q);
+	glm_f32vec4 const z = vmulq_f32(r, r);
+	glm_f32vec4 const SinPoly = glm_vec4_sin_poly(r, z);
+	glm_f32vec4 const CosPoly = glm_vec4_cos_poly(z);
+
+	glm_u32vec4 const Swap = vtstq_u32(vreinterpretq_u32_s32(q), vdupq_n_u32(1));
+	glm_f32vec4 const Result = vdivq_f32(glm_vec4_select(Swap, vnegq_f32(CosPoly), SinPoly), glm_vec4_select(Swap, SinPoly, CosPoly));
+
+	glm_u32vec4 const Outside = glm_vec4_trigonometric_outside(x);
+	return glm_vec4_any(Outside) ? glm_vec4_scalar_lanes(Result, Outside, x, std::tan) : Result;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_atan2(glm_f32vec4 y, glm_f32vec4 x)
+{
+	glm_f32vec4 const AbsX = vabsq_f32(x);
+	glm_f32vec4 const AbsY = vabsq_f32(y);
+	glm_f32vec4 const Max = vmaxq_f32(AbsX, AbsY);
+
+	glm_f32vec4 a = glm_vec4_select(vceqzq_f32(Max), vdupq_n_f32(0.0f), vdivq_f32(vminq_f32(AbsX, AbsY), Max));
+	glm_u32vec4 const Reduce = vcgtq_f32(a, vdupq_n_f32(0.414213562373095f));
+	a = glm_vec4_select(Reduce, vdivq_f32(vsubq_f32(a, vdupq_n_f32(1.0f)), vaddq_f32(a, vdupq_n_f32(1.0f))), a);
+
+	glm_f32vec4 const z = vmulq_f32(a, a);
+	glm_f32vec4 p = glm_vec4_fma(vdupq_n_f32(8.05374449538e-2f), z, vdupq_n_f32(-1.38776856032e-1f));
+	p = glm_vec4_fma(p, z, vdupq_n_f32(1.99777106478e-1f));
+	p = glm_vec4_fma(p, z, vdupq_n_f32(-3.33329491539e-1f));
+	glm_f32vec4 Result = vaddq_f32(glm_vec4_select(Reduce, vdupq_n_f32(0.785398163397448f), vdupq_n_f32(0.0f)), glm_vec4_fma(vmulq_f32(p, z), a, a));
+
+	Result = glm_vec4_select(vcgtq_f32(AbsY, AbsX), vsubq_f32(vdupq_n_f32(1.57079632679490f), Result), Result);
+	Result = glm_vec4_select(vcltzq_s32(vreinterpretq_s32_f32(x)), vsubq_f32(vdupq_n_f32(3.14159265358979f), Result), Result);
+	Result = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(Result), vandq_u32(vreinterpretq_u32_f32(y), vdupq_n_u32(0x80000000u))));
+
+	glm_u32vec4 const NaN = vmvnq_u32(vandq_u32(vceqq_f32(x, x), vceqq_f32(y, y)));
+	glm_u32vec4 const Outside = vorrq_u32(NaN, vceqq_f32(Max, vdupq_n_f32(std::numeric_limits<float>::infinity())));
+	return glm_vec4_any(Outside) ? glm_vec4_scalar_lanes(Result, Outside, y, x, std::atan2) : Result;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_ARMV8_BIT
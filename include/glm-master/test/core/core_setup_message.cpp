@@ -245,6 +245,8 @@ static int test_instruction_set()
 		std::printf("ARM ");
 #	elif(GLM_ARCH & GLM_ARCH_NEON_BIT)
 		std::printf("NEON ");
+#	elif(GLM_ARCH & GLM_ARCH_AVX512_BIT)
+		std::printf("AVX512 ");
 #	elif(GLM_ARCH & GLM_ARCH_AVX2_BIT)
 		std::printf("AVX2 ");
 #	elif(GLM_ARCH & GLM_ARCH_AVX_BIT)
@@ -0,0 +1,293 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/bvh.hpp>
+#include <glm/gtx/intersect.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <limits>
+#include <vector>
+
+static unsigned int Seed = 1;
+
+template<typename T>
+static T rand_range(T Min, T Max)
+{
+	Seed = Seed * 1664525u + 1013904223u;
+	return Min + (Max - Min) * static_cast<T>(Seed >> 8) / static_cast<T>(1 << 24);
+}
+
+template<typename T>
+static glm::vec<3, T> rand_vec(T Min, T Max)
+{
+	T const x = rand_range(Min, Max);
+	T const y = rand_range(Min, Max);
+	T const z = rand_range(Min, Max);
+	return glm::vec<3, T>(x, y, z);
+}
+
+template<typename T>
+static glm::bvh_hit<T> make_hit()
+{
+	glm::bvh_hit<T> Hit;
+	Hit.baryPosition = glm::vec<2, T>(0);
+	Hit.distance = static_cast<T>(0);
+	Hit.triangle = 0;
+	return Hit;
+}
+
+template<typename T>
+struct scene
+{
+	std::vector<glm::vec<3, T> > Vertices;
+	std::vector<glm::uint32> Indices;
+
+	glm::vec<3, T> corner(std::size_t Triangle, std::size_t Corner) const
+	{
+		return this->Vertices[this->Indices.empty() ? Triangle * 3 + Corner : this->Indices[Triangle * 3 + Corner]];
+	}
+
+	std::size_t size() const
+	{
+		return (this->Indices.empty() ? this->Vertices.size() : this->Indices.size()) / 3;
+	}
+
+	void build(glm::bvh<T>& Tree, unsigned Threads) const
+	{
+		if(this->Indices.empty())
+			Tree.build(this->Vertices.data(), this->size(), Threads);
+		else
+			Tree.build(this->Vertices.data(), this->Indices.data(), this->size(), Threads);
+	}
+
+	// Whether the ray hits triangle i scaled by Scale around its centroid, at a distance >= 0
+	bool hits(glm::vec<3, T> const& Orig, glm::vec<3, T> const& Dir, std::size_t i, T Scale, glm::vec<2, T>& BaryPosition, T& Distance) const
+	{
+		glm::vec<3, T> const Center = (this->corner(i, 0) + this->corner(i, 1) + this->corner(i, 2)) / static_cast<T>(3);
+		glm::vec<3, T> Corners[3];
+		for(std::size_t Corner = 0; Corner < 3; ++Corner)
+			Corners[Corner] = Center + (this->corner(i, Corner) - Center) * Scale;
+		return glm::intersectRayTriangle(Orig, Dir, Corners[0], Corners[1], Corners[2], BaryPosition, Distance) && Distance >= static_cast<T>(0);
+	}
+
+	// The BVH and intersectRayTriangle may round differently, for instance when the compiler
+	// contracts one of them into fused multiply-adds, so rays grazing an edge can go either way.
+	// A BVH hit must be on a triangle hit once grown by Epsilon, no farther than the closest
+	// triangle hit once shrunk by Epsilon, and match intersectRayTriangle when it hits too.
+	bool check(glm::vec<3, T> const& Orig, glm::vec<3, T> const& Dir, bool Hit, glm::vec<2, T> const& BaryPosition, T Distance, glm::uint32 Triangle) const
+	{
+		T const Epsilon = static_cast<T>(1e-4);
+
+		bool SureHit = false;
+		T Closest = std::numeric_limits<T>::max();
+		for(std::size_t i = 0; i < this->size(); ++i)
+		{
+			glm::vec<2, T> TriangleBary(0);
+			T TriangleDistance = static_cast<T>(0);
+			if(this->hits(Orig, Dir, i, static_cast<T>(1) - Epsilon, TriangleBary, TriangleDistance) && TriangleDistance < Closest)
+			{
+				Closest = TriangleDistance;
+				SureHit = true;
+			}
+		}
+
+		if(!Hit)
+			return !SureHit && Triangle == glm::bvh<T>::none;
+		if(Triangle >= this->size())
+			return false;
+
+		glm::vec<2, T> TriangleBary(0);
+		T TriangleDistance = static_cast<T>(0);
+		if(!this->hits(Orig, Dir, Triangle, static_cast<T>(1) + Epsilon, TriangleBary, TriangleDistance))
+			return false;
+		if(!glm::equal(Distance, TriangleDistance, Epsilon * glm::max(static_cast<T>(1), Distance)))
+			return false;
+		if(SureHit && Distance > Closest + Epsilon * glm::max(static_cast<T>(1), Closest))
+			return false;
+
+		if(!glm::intersectRayTriangle(Orig, Dir, this->corner(Triangle, 0), this->corner(Triangle, 1), this->corner(Triangle, 2), TriangleBary, TriangleDistance))
+			return true;
+		return glm::all(glm::equal(BaryPosition, TriangleBary, Epsilon)) && glm::equal(Distance, TriangleDistance, Epsilon * glm::max(static_cast<T>(1), Distance));
+	}
+};
+
+// Small triangles scattered in a box
+template<typename T>
+static scene<T> make_soup(std::size_t Count)
+{
+	scene<T> Scene;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec<3, T> const Center = rand_vec<T>(static_cast<T>(-10), static_cast<T>(10));
+		for(int Corner = 0; Corner < 3; ++Corner)
+			Scene.Vertices.push_back(Center + rand_vec<T>(static_cast<T>(-1), static_cast<T>(1)));
+	}
+	return Scene;
+}
+
+// Indexed terrain of Size x Size vertices on the y = height(x, z) surface
+template<typename T>
+static scene<T> make_heightfield(int Size)
+{
+	scene<T> Scene;
+	for(int z = 0; z < Size; ++z)
+	for(int x = 0; x < Size; ++x)
+		Scene.Vertices.push_back(glm::vec<3, T>(static_cast<T>(x), glm::sin(static_cast<T>(x) * static_cast<T>(0.3)) * glm::cos(static_cast<T>(z) * static_cast<T>(0.2)) * static_cast<T>(4), static_cast<T>(z)));
+
+	for(int z = 0; z < Size - 1; ++z)
+	for(int x = 0; x < Size - 1; ++x)
+	{
+		glm::uint32 const i = static_cast<glm::uint32>(z * Size + x);
+		glm::uint32 const Quad[6] = {i, i + static_cast<glm::uint32>(Size), i + 1, i + 1, i + static_cast<glm::uint32>(Size), i + static_cast<glm::uint32>(Size) + 1};
+		Scene.Indices.insert(Scene.Indices.end(), Quad, Quad + 6);
+	}
+	return Scene;
+}
+
+template<typename T>
+static int test_rays(scene<T> const& Scene, glm::bvh<T> const& Tree, std::vector<glm::vec<3, T> > const& Orig, std::vector<glm::vec<3, T> > const& Dir)
+{
+	std::size_t Mismatches = 0;
+
+	for(std::size_t i = 0; i < Orig.size(); ++i)
+	{
+		glm::vec<2, T> BaryPosition(0);
+		T Distance = static_cast<T>(0);
+		glm::uint32 Triangle = glm::bvh<T>::none;
+		bool const Hit = Tree.intersect(Orig[i], Dir[i], BaryPosition, Distance, Triangle);
+		Mismatches += Scene.check(Orig[i], Dir[i], Hit, BaryPosition, Distance, Triangle) ? 0 : 1;
+	}
+
+	std::vector<glm::bvh_hit<T> > Hits(Orig.size(), make_hit<T>());
+	Tree.intersect(Orig.data(), Dir.data(), Orig.size(), Hits.data());
+	for(std::size_t i = 0; i < Orig.size(); ++i)
+		Mismatches += Scene.check(Orig[i], Dir[i], Hits[i].triangle != glm::bvh<T>::none, Hits[i].baryPosition, Hits[i].distance, Hits[i].triangle) ? 0 : 1;
+
+	return Mismatches == 0 ? 0 : 1;
+}
+
+template<typename T>
+static int test_soup()
+{
+	int Error = 0;
+
+	scene<T> const Scene = make_soup<T>(2000);
+	glm::bvh<T> Tree;
+	Scene.build(Tree, 1);
+	Error += Tree.size() == Scene.size() ? 0 : 1;
+	Error += Tree.node_count() > 1 ? 0 : 1;
+
+	// Rays from inside and outside of the soup, some of them missing everything
+	std::vector<glm::vec<3, T> > Orig;
+	std::vector<glm::vec<3, T> > Dir;
+	for(std::size_t i = 0; i < 1003; ++i)
+	{
+		Orig.push_back(rand_vec<T>(static_cast<T>(-15), static_cast<T>(15)));
+		Dir.push_back(rand_vec<T>(static_cast<T>(-1), static_cast<T>(1)));
+	}
+	Error += test_rays(Scene, Tree, Orig, Dir);
+
+	return Error;
+}
+
+static int test_heightfield()
+{
+	int Error = 0;
+
+	scene<float> const Scene = make_heightfield<float>(64);
+	glm::bvh<float> Tree;
+	Scene.build(Tree, 1);
+
+	// Axis aligned rays, which hit vertices and edges, and oblique rays from the sky
+	std::vector<glm::vec3> Orig;
+	std::vector<glm::vec3> Dir;
+	for(int z = -1; z < 65; z += 3)
+	for(int x = -1; x < 65; x += 2)
+	{
+		Orig.push_back(glm::vec3(static_cast<float>(x) * 0.97f, 10.0f, static_cast<float>(z)));
+		Dir.push_back(glm::vec3(0, -1, 0));
+		Orig.push_back(glm::vec3(-5.0f, static_cast<float>(x % 7) - 3.0f, static_cast<float>(z)));
+		Dir.push_back(glm::vec3(1, 0, 0));
+		Orig.push_back(glm::vec3(32.0f, 20.0f, 32.0f));
+		Dir.push_back(glm::vec3(static_cast<float>(x) - 32.0f, -20.0f, static_cast<float>(z) - 32.0f));
+	}
+	Error += test_rays(Scene, Tree, Orig, Dir);
+
+	// Threaded builds give the same tree
+	for(unsigned Threads = 0; Threads < 4; Threads += 3)
+	{
+		glm::bvh<float> Threaded;
+		Scene.build(Threaded, Threads);
+		Error += Threaded.node_count() == Tree.node_count() ? 0 : 1;
+
+		std::vector<glm::bvh_hit<float> > Expected(Orig.size(), make_hit<float>());
+		std::vector<glm::bvh_hit<float> > Hits(Orig.size(), make_hit<float>());
+		Tree.intersect(Orig.data(), Dir.data(), Orig.size(), Expected.data());
+		Threaded.intersect(Orig.data(), Dir.data(), Orig.size(), Hits.data());
+		for(std::size_t i = 0; i < Orig.size(); ++i)
+		{
+			Error += Hits[i].triangle == Expected[i].triangle ? 0 : 1;
+			Error += glm::equal(Hits[i].distance, Expected[i].distance, 0.0f) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+static int test_degenerate()
+{
+	int Error = 0;
+
+	// Empty trees hit nothing
+	{
+		glm::bvh<float> Tree;
+		Tree.build(static_cast<glm::vec3 const*>(NULL), 0);
+		Error += Tree.size() == 0 ? 0 : 1;
+
+		glm::vec3 const Orig(0);
+		glm::vec3 const Dir(0, 0, 1);
+		glm::vec2 BaryPosition(-1);
+		float Distance = -1.0f;
+		glm::uint32 Triangle = 0;
+		Error += Tree.intersect(Orig, Dir, BaryPosition, Distance, Triangle) ? 1 : 0;
+		Error += Triangle == 0 ? 0 : 1;
+
+		glm::bvh_hit<float> Hit = make_hit<float>();
+		Tree.intersect(&Orig, &Dir, 1, &Hit);
+		Error += Hit.triangle == glm::bvh<float>::none ? 0 : 1;
+	}
+
+	// Many copies of a triangle, which can't be split
+	{
+		scene<float> Scene;
+		for(int i = 0; i < 100; ++i)
+		{
+			Scene.Vertices.push_back(glm::vec3(0, 0, 0));
+			Scene.Vertices.push_back(glm::vec3(-1, -1, 0));
+			Scene.Vertices.push_back(glm::vec3(1, -1, 0));
+		}
+		glm::bvh<float> Tree;
+		Scene.build(Tree, 1);
+
+		std::vector<glm::vec3> Orig;
+		std::vector<glm::vec3> Dir;
+		for(int i = 0; i < 20; ++i)
+		{
+			Orig.push_back(glm::vec3(static_cast<float>(i) * 0.1f - 1.0f, -0.5f, 2.0f));
+			Dir.push_back(glm::vec3(0, 0, -1));
+		}
+		Error += test_rays(Scene, Tree, Orig, Dir);
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_soup<float>();
+	Error += test_soup<double>();
+	Error += test_heightfield();
+	Error += test_degenerate();
+
+	return Error;
+}
@@ -1,9 +1,82 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/fast_exponential.hpp>
+#include <cmath>
+#include <vector>
+
+// The array fastExp computes the scalar approximation
+static int test_fastExp()
+{
+	int Error = 0;
+
+	std::size_t const Count = 100003;
+	std::vector<float> In(Count), Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = -1.0f + 2.0f * static_cast<float>(i) / static_cast<float>(Count - 1);
+	glm::fastExp(In.data(), Out.data(), Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		double const Exact = std::exp(static_cast<double>(In[i]));
+		Error += std::fabs(Out[i] - glm::fastExp(In[i])) <= 1e-6f ? 0 : 1;
+		Error += std::fabs(static_cast<double>(Out[i]) - Exact) <= 3.3e-3 * Exact ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// The array fastLog over every binade of the positive normal floats
+static int test_fastLog()
+{
+	int Error = 0;
+
+	std::size_t const Count = 100003;
+	std::vector<float> In(Count), Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = std::ldexp(1.0f + static_cast<float>(i % 1009) / 1009.0f, static_cast<int>(i % 253) - 126);
+	In[0] = 1.0f;
+	In[1] = 0.99999994f;
+	In[2] = 1.00000012f;
+	glm::fastLog(In.data(), Out.data(), Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		double const Exact = std::log(static_cast<double>(In[i]));
+		Error += std::fabs(static_cast<double>(Out[i]) - Exact) <= 2.2e-7 * std::fabs(Exact) ? 0 : 1;
+	}
+	Error += Out[0] == 0.0f ? 0 : 1;
+
+	return Error;
+}
+
+// Every array length gives the values of the full array, whatever the values left over
+static int test_tail()
+{
+	int Error = 0;
+
+	std::size_t const Count = 37;
+	std::vector<float> In(Count), Expected(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = 0.25f + static_cast<float>(i);
+	glm::fastLog(In.data(), Expected.data(), Count);
+
+	for(std::size_t Length = 0; Length <= Count; ++Length)
+	{
+		std::vector<float> Out(Count, -1.0f);
+		glm::fastLog(In.data(), Out.data(), Length);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Out[i] == (i < Length ? Expected[i] : -1.0f) ? 0 : 1;
+	}
+
+	return Error;
+}
 
 int main()
 {
 	int Error(0);
 
+	Error += test_fastExp();
+	Error += test_fastLog();
+	Error += test_tail();
+
 	return Error;
 }
@@ -573,6 +573,100 @@ namespace taylor2
 
 }//namespace taylor2
 
+// The array functions compute the scalar approximations within their documented errors
+namespace batch
+{
+	static std::vector<float> make_values(float Begin, float End, std::size_t Count)
+	{
+		std::vector<float> Result(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = Begin + (End - Begin) * static_cast<float>(i) / static_cast<float>(Count - 1);
+		return Result;
+	}
+
+	static int test_sincos()
+	{
+		int Error = 0;
+
+		std::size_t const Count = 100003;
+		std::vector<float> const In = make_values(-100.0f, 100.0f, Count);
+		std::vector<float> Sin(Count), Cos(Count);
+		glm::fastSin(In.data(), Sin.data(), Count);
+		glm::fastCos(In.data(), Cos.data(), Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += std::fabs(Sin[i] - glm::fastSin(In[i])) <= 1e-6f ? 0 : 1;
+			Error += std::fabs(Cos[i] - glm::fastCos(In[i])) <= 1e-6f ? 0 : 1;
+			Error += std::fabs(static_cast<double>(Sin[i]) - std::sin(static_cast<double>(In[i]))) <= 1.6e-5 ? 0 : 1;
+			Error += std::fabs(static_cast<double>(Cos[i]) - std::cos(static_cast<double>(In[i]))) <= 1.6e-5 ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	static int test_atan()
+	{
+		int Error = 0;
+
+		std::size_t const Count = 100003;
+		std::vector<float> const In = make_values(-1.0f, 1.0f, Count);
+		std::vector<float> Out(Count);
+		glm::fastAtan(In.data(), Out.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += std::fabs(Out[i] - glm::fastAtan(In[i])) <= 1e-6f ? 0 : 1;
+			Error += std::fabs(static_cast<double>(Out[i]) - std::atan(static_cast<double>(In[i]))) <= 4.2e-2 ? 0 : 1;
+		}
+
+		// Both signs of y and x, abs(y) <= abs(x), and a zero
+		std::vector<float> Y(Count), X(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			X[i] = (i % 2 ? -1.0f : 1.0f) * (1.0f + static_cast<float>(i % 7));
+			Y[i] = In[i] * glm::abs(X[i]);
+		}
+		glm::fastAtan(Y.data(), X.data(), Out.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += std::fabs(Out[i] - glm::fastAtan(Y[i], X[i])) <= 1e-6f ? 0 : 1;
+		Error += Out[Count / 2] == 0.0f ? 0 : 1;
+
+		return Error;
+	}
+
+	// Every array length gives the values of the full array, whatever the values left over
+	static int test_tail()
+	{
+		int Error = 0;
+
+		std::size_t const Count = 37;
+		std::vector<float> const In = make_values(-7.0f, 9.0f, Count);
+		std::vector<float> Expected(Count);
+		glm::fastCos(In.data(), Expected.data(), Count);
+
+		for(std::size_t Length = 0; Length <= Count; ++Length)
+		{
+			std::vector<float> Out(Count, -2.0f);
+			glm::fastCos(In.data(), Out.data(), Length);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += Out[i] == (i < Length ? Expected[i] : -2.0f) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test_sincos();
+		Error += test_atan();
+		Error += test_tail();
+
+		return Error;
+	}
+}//namespace batch
+
 int main()
 {
 	int Error(0);
@@ -580,6 +674,7 @@ int main()
 	Error += ::taylor2::perf(1000);
 	Error += ::taylorCos::test();
 	Error += ::taylorCos::perf(1000);
+	Error += ::batch::test();
 
 	::fastCos::perf(false);
 	::fastSin::perf(false);
@@ -0,0 +1,156 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/frustum.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <vector>
+
+static unsigned int Seed = 1;
+
+template<typename T>
+static T rand_range(T Min, T Max)
+{
+	Seed = Seed * 1664525u + 1013904223u;
+	return Min + (Max - Min) * static_cast<T>(Seed >> 8) / static_cast<T>(1 << 24);
+}
+
+template<typename T>
+static T distance(glm::vec<4, T> const& Plane, glm::vec<3, T> const& Point)
+{
+	return glm::dot(glm::vec<3, T>(Plane), Point) + Plane.w;
+}
+
+template<typename T>
+static glm::mat<4, 4, T> view()
+{
+	return glm::lookAt(glm::vec<3, T>(1, 2, 5), glm::vec<3, T>(0), glm::vec<3, T>(0, 1, 0));
+}
+
+template<typename T>
+static int test_planes()
+{
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(1e-4);
+	T const Near = static_cast<T>(1);
+	T const Far = static_cast<T>(100);
+	glm::vec<3, T> const Eye(1, 2, 5);
+	glm::vec<3, T> const Forward(glm::normalize(-Eye));
+
+	glm::vec<4, T> PlanesZO[6];
+	glm::vec<4, T> PlanesNO[6];
+	glm::frustumPlanesZO(glm::perspectiveZO(glm::radians(static_cast<T>(60)), static_cast<T>(1.5), Near, Far) * view<T>(), PlanesZO);
+	glm::frustumPlanesNO(glm::perspectiveNO(glm::radians(static_cast<T>(60)), static_cast<T>(1.5), Near, Far) * view<T>(), PlanesNO);
+
+	for(int p = 0; p < 6; ++p)
+	{
+		// Normalized, with the point looked at inside
+		Error += glm::equal(glm::length(glm::vec<3, T>(PlanesZO[p])), static_cast<T>(1), Epsilon) ? 0 : 1;
+		Error += distance(PlanesZO[p], glm::vec<3, T>(0)) > static_cast<T>(0) ? 0 : 1;
+		Error += glm::equal(distance(PlanesZO[p], glm::vec<3, T>(0)), distance(PlanesNO[p], glm::vec<3, T>(0)), Epsilon * Far) ? 0 : 1;
+
+		// Between the eye and the near plane, only the near plane sees the point outside
+		Error += (distance(PlanesZO[p], Eye + Forward * static_cast<T>(0.5)) < static_cast<T>(0)) == (p == 4) ? 0 : 1;
+	}
+
+	// Near and far planes at their distance from the eye
+	Error += glm::equal(distance(PlanesZO[4], Eye), -Near, Epsilon) ? 0 : 1;
+	Error += glm::equal(distance(PlanesNO[4], Eye), -Near, Epsilon) ? 0 : 1;
+	Error += glm::equal(distance(PlanesZO[5], Eye), Far, Epsilon * Far) ? 0 : 1;
+	Error += glm::equal(distance(PlanesNO[5], Eye), Far, Epsilon * Far) ? 0 : 1;
+
+	// Left and right planes of an orthographic projection
+	glm::vec<4, T> Ortho[6];
+	glm::frustumPlanes(glm::ortho(static_cast<T>(-2), static_cast<T>(3), static_cast<T>(-1), static_cast<T>(1), Near, Far), Ortho);
+	Error += glm::equal(distance(Ortho[0], glm::vec<3, T>(0)), static_cast<T>(2), Epsilon) ? 0 : 1;
+	Error += glm::equal(distance(Ortho[1], glm::vec<3, T>(0)), static_cast<T>(3), Epsilon) ? 0 : 1;
+
+	return Error;
+}
+
+// Visible volumes must be listed, volumes entirely outside of a plane must not, and volumes
+// within rounding errors of a plane may be either
+template<typename T>
+static int check(std::vector<T> const& Distance, std::vector<glm::uint32> const& Visible, std::size_t VisibleCount)
+{
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(1e-4);
+	std::vector<bool> Listed(Distance.size(), false);
+	for(std::size_t k = 0; k < VisibleCount; ++k)
+	{
+		Error += Visible[k] < Distance.size() ? 0 : 1;
+		Error += k == 0 || Visible[k - 1] < Visible[k] ? 0 : 1;
+		if(Visible[k] < Distance.size())
+			Listed[Visible[k]] = true;
+	}
+
+	for(std::size_t i = 0; i < Distance.size(); ++i)
+	{
+		if(Distance[i] > Epsilon)
+			Error += Listed[i] ? 0 : 1;
+		else if(Distance[i] < -Epsilon)
+			Error += Listed[i] ? 1 : 0;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_cull()
+{
+	int Error = 0;
+
+	glm::vec<4, T> Planes[6];
+	glm::frustumPlanes(glm::perspective(glm::radians(static_cast<T>(50)), static_cast<T>(1.5), static_cast<T>(1), static_cast<T>(50)) * view<T>(), Planes);
+
+	// Every tail length and the SIMD loops, with volumes inside, outside and across the planes
+	for(std::size_t Count = 0; Count < 1000; Count += Count < 37 ? 1 : 321)
+	{
+		glm::vec_soa<3, T> Min(Count);
+		glm::vec_soa<3, T> Max(Count);
+		glm::vec_soa<3, T> Center(Count);
+		std::vector<T> Radius(Count);
+		std::vector<T> BoxDistance(Count);
+		std::vector<T> SphereDistance(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec<3, T> Position(0);
+			for(glm::length_t c = 0; c < 3; ++c)
+				Position[c] = rand_range(static_cast<T>(-30), static_cast<T>(30));
+			glm::vec<3, T> const Extent(rand_range(static_cast<T>(0), static_cast<T>(3)), rand_range(static_cast<T>(0), static_cast<T>(3)), rand_range(static_cast<T>(0), static_cast<T>(3)));
+
+			Min.store(i, Position - Extent);
+			Max.store(i, Position + Extent);
+			Center.store(i, Position);
+			Radius[i] = Extent.x;
+
+			BoxDistance[i] = std::numeric_limits<T>::max();
+			SphereDistance[i] = std::numeric_limits<T>::max();
+			for(int p = 0; p < 6; ++p)
+			{
+				glm::vec<3, T> const Normal(Planes[p]);
+				BoxDistance[i] = glm::min(BoxDistance[i], distance(Planes[p], Position) + glm::dot(glm::abs(Normal), Extent));
+				SphereDistance[i] = glm::min(SphereDistance[i], distance(Planes[p], Position) + Radius[i]);
+			}
+		}
+
+		std::vector<glm::uint32> Visible(Count + 1, 0);
+		Error += check(BoxDistance, Visible, glm::frustumCullBoxes(Planes, Min, Max, Visible.data()));
+		Error += check(SphereDistance, Visible, glm::frustumCullSpheres(Planes, Center, Radius.data(), Visible.data()));
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_planes<float>();
+	Error += test_planes<double>();
+	Error += test_cull<float>();
+	Error += test_cull<double>();
+
+	return Error;
+}
@@ -0,0 +1,169 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/noise_batch.hpp>
+#include <glm/gtc/noise.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <limits>
+#include <vector>
+
+static float const Epsilon = 1e-5f;
+
+// Compilers may contract the noise functions into fused multiply-adds, differently in the batch
+// and in the scalar code. The last bits of the coordinates then differ, which moves the result by
+// a few ulps of the coordinates times the noise slope, summed over the octaves.
+template<glm::length_t L, typename T>
+static T tolerance(glm::vec<L, T> const& Position, int Octaves, T Lacunarity, T Gain)
+{
+	T Coordinate = static_cast<T>(0);
+	for(glm::length_t c = 0; c < L; ++c)
+		Coordinate = glm::max(Coordinate, glm::abs(Position[c]));
+
+	T Scale = static_cast<T>(0);
+	T Frequency = static_cast<T>(1);
+	T Amplitude = static_cast<T>(1);
+	for(int o = 0; o < Octaves; ++o)
+	{
+		Scale += Amplitude * Frequency;
+		Frequency *= Lacunarity;
+		Amplitude *= Gain;
+	}
+
+	return static_cast<T>(Epsilon) + Coordinate * Scale * std::numeric_limits<T>::epsilon() * static_cast<T>(16);
+}
+
+// 3D Perlin noise picks a gradient with step(gz, 0) where gz is exactly 0 for some hashes, so the
+// rounding of the hash, hence contraction, decides between two gradients on up to a tenth of the
+// points. The other functions have no such edge and must match everywhere.
+static std::size_t const PerlinOutlierPercent = 10;
+
+static int outliers(std::size_t Mismatches, std::size_t Count, std::size_t OutlierPercent)
+{
+	return Mismatches * 100 > Count * OutlierPercent ? 1 : 0;
+}
+
+template<glm::length_t L, typename T>
+static std::vector<glm::vec<L, T> > make_points(std::size_t Count)
+{
+	// Includes negative coordinates and coordinates beyond the 289 period
+	std::vector<glm::vec<L, T> > Result(Count, glm::vec<L, T>(0));
+	for(std::size_t i = 0; i < Count; ++i)
+		for(glm::length_t c = 0; c < L; ++c)
+			Result[i][c] = glm::sin(static_cast<T>(i * 5 + static_cast<std::size_t>(c) * 11)) * static_cast<T>(300) + static_cast<T>(i) * static_cast<T>(0.37);
+	return Result;
+}
+
+template<glm::length_t L, typename T>
+static T fbm(T (*Noise)(glm::vec<L, T> const&), glm::vec<L, T> const& Position, int Octaves, T Lacunarity, T Gain)
+{
+	T Result = static_cast<T>(0);
+	T Frequency = static_cast<T>(1);
+	T Amplitude = static_cast<T>(1);
+	for(int o = 0; o < Octaves; ++o)
+	{
+		Result += Amplitude * Noise(Position * Frequency);
+		Frequency *= Lacunarity;
+		Amplitude *= Gain;
+	}
+	return Result;
+}
+
+template<glm::length_t L, typename T>
+static int test_points(T (*Noise)(glm::vec<L, T> const&), void (*Batch)(glm::vec<L, T> const*, T*, std::size_t, int, T, T), std::size_t OutlierPercent)
+{
+	int Error = 0;
+
+	// Zero, one and two packs of the SIMD width, each followed by every tail length
+	std::size_t const Width = glm::detail::noise_native<T>::type::width;
+	std::size_t Mismatches = 0;
+	std::size_t Total = 0;
+	for(std::size_t Packs = 0; Packs < 3; ++Packs)
+	for(std::size_t Tail = 0; Tail < Width; ++Tail)
+	{
+		std::size_t const Count = Packs * Width + Tail;
+		std::vector<glm::vec<L, T> > const In = make_points<L, T>(Count);
+		std::vector<T> Out(Count, static_cast<T>(-10));
+		Batch(In.data(), Out.data(), Count, 1, static_cast<T>(2), static_cast<T>(0.5));
+		for(std::size_t i = 0; i < Count; ++i)
+			Mismatches += glm::equal(Out[i], Noise(In[i]), tolerance(In[i], 1, static_cast<T>(2), static_cast<T>(0.5))) ? 0 : 1;
+		Total += Count;
+	}
+	Error += outliers(Mismatches, Total, OutlierPercent);
+
+	std::vector<glm::vec<L, T> > const In = make_points<L, T>(1000);
+	std::vector<T> Out(In.size());
+	Batch(In.data(), Out.data(), In.size(), 5, static_cast<T>(1.9), static_cast<T>(0.45));
+	Mismatches = 0;
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Mismatches += glm::equal(Out[i], fbm(Noise, In[i], 5, static_cast<T>(1.9), static_cast<T>(0.45)), tolerance(In[i], 5, static_cast<T>(1.9), static_cast<T>(0.45))) ? 0 : 1;
+	Error += outliers(Mismatches, In.size(), OutlierPercent);
+
+	return Error;
+}
+
+template<glm::length_t L>
+static int test_grid(float (*Noise)(glm::vec<L, float> const&), void (*Grid)(glm::vec<L, float> const&, glm::vec<L, float> const&, glm::vec<L, int> const&, float*, int, float, float, unsigned), std::size_t OutlierPercent)
+{
+	int Error = 0;
+
+	glm::vec<L, float> const Origin(-3.7f);
+	glm::vec<L, float> const Step(0.173f);
+
+	// Rows shorter and longer than the SIMD width, split between more threads than rows
+	std::size_t Mismatches = 0;
+	std::size_t Total = 0;
+	for(int Width = 1; Width < 20; Width += 6)
+	{
+		glm::vec<L, int> Size(5);
+		Size.x = Width;
+
+		std::size_t Count = 1;
+		for(glm::length_t c = 0; c < L; ++c)
+			Count *= static_cast<std::size_t>(Size[c]);
+
+		for(unsigned Threads = 1; Threads < 40; Threads += 19)
+		{
+			std::vector<float> Out(Count, -10.0f);
+			Grid(Origin, Step, Size, Out.data(), 3, 2.0f, 0.5f, Threads);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				glm::vec<L, float> Index;
+				std::size_t Coordinate = i;
+				for(glm::length_t c = 0; c < L; ++c)
+				{
+					Index[c] = static_cast<float>(Coordinate % static_cast<std::size_t>(Size[c]));
+					Coordinate /= static_cast<std::size_t>(Size[c]);
+				}
+				glm::vec<L, float> const Position = Origin + Index * Step;
+				Mismatches += glm::equal(Out[i], fbm(Noise, Position, 3, 2.0f, 0.5f), tolerance(Position, 3, 2.0f, 0.5f)) ? 0 : 1;
+			}
+			Total += Count;
+		}
+	}
+	Error += outliers(Mismatches, Total, OutlierPercent);
+
+	// Empty grids write nothing
+	float Untouched = -10.0f;
+	Grid(Origin, Step, glm::vec<L, int>(0), &Untouched, 1, 2.0f, 0.5f, 0);
+	Error += glm::equal(Untouched, -10.0f, 0.0f) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_points<2, float>(glm::perlin, glm::perlin, 0);
+	Error += test_points<3, float>(glm::perlin, glm::perlin, PerlinOutlierPercent);
+	Error += test_points<2, float>(glm::simplex, glm::simplex, 0);
+	Error += test_points<3, float>(glm::simplex, glm::simplex, 0);
+	Error += test_points<2, double>(glm::perlin, glm::perlin, 0);
+	Error += test_points<3, double>(glm::simplex, glm::simplex, 0);
+
+	Error += test_grid<2>(glm::perlin, glm::perlinGrid, 0);
+	Error += test_grid<3>(glm::perlin, glm::perlinGrid, PerlinOutlierPercent);
+	Error += test_grid<2>(glm::simplex, glm::simplexGrid, 0);
+	Error += test_grid<3>(glm::simplex, glm::simplexGrid, 0);
+
+	return Error;
+}
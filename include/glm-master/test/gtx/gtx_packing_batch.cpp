@@ -0,0 +1,176 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/packing_batch.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <cstring>
+#include <vector>
+
+static std::vector<glm::vec4> make_vectors(std::size_t Count)
+{
+	// Includes values out of [-1, 1], which are clamped
+	std::vector<glm::vec4> Result(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		for(glm::length_t c = 0; c < 4; ++c)
+			Result[i][c] = glm::sin(static_cast<float>(i * 7 + static_cast<std::size_t>(c) * 3)) * 1.25f;
+	return Result;
+}
+
+// The kernels convert 8 values or vectors per iteration (F16C, AVX2, SSE2 for halfs), then 4
+// (SSE2, NEON), then end with a zero padded block or one at a time: take every mix of the three.
+static std::vector<std::size_t> tail_counts()
+{
+	std::vector<std::size_t> Result;
+	for(std::size_t Wide = 0; Wide < 3; ++Wide)
+	for(std::size_t Narrow = 0; Narrow < 2; ++Narrow)
+	for(std::size_t Tail = 0; Tail < 4; ++Tail)
+		Result.push_back(Wide * 8 + Narrow * 4 + Tail);
+	return Result;
+}
+
+static int test_packHalf()
+{
+	int Error = 0;
+
+	std::vector<std::size_t> const Counts = tail_counts();
+	for(std::size_t n = 0; n < Counts.size(); ++n)
+	{
+		std::size_t const Count = Counts[n];
+		std::vector<float> In(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = glm::sin(static_cast<float>(i)) * static_cast<float>(i * i * 10);
+
+		std::vector<glm::uint16> Out(Count, 0);
+		glm::packHalf(In.data(), Out.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Out[i] == glm::packHalf1x16(In[i]) ? 0 : 1;
+	}
+
+	// Every half: converting the float back gives the same bits, NaN excepted
+	std::vector<glm::uint16> Halfs(65536);
+	for(std::size_t i = 0; i < Halfs.size(); ++i)
+		Halfs[i] = static_cast<glm::uint16>(i);
+	std::vector<float> Floats(Halfs.size());
+	glm::unpackHalf(Halfs.data(), Floats.data(), Halfs.size());
+	std::vector<glm::uint16> Packed(Halfs.size());
+	glm::packHalf(Floats.data(), Packed.data(), Floats.size());
+	for(std::size_t i = 0; i < Halfs.size(); ++i)
+	{
+		bool const NaN = (Halfs[i] & 0x7c00) == 0x7c00 && (Halfs[i] & 0x03ff) != 0;
+		Error += NaN || Packed[i] == Halfs[i] ? 0 : 1;
+	}
+
+	// Ties round to even, where packHalf1x16 rounds them up
+	float const Ties[] = {1.0f + 1.0f / 2048.0f, 1.0f + 3.0f / 2048.0f, -(1.0f + 1.0f / 2048.0f), 65520.0f, 1.0f / 33554432.0f};
+	glm::uint16 const Expected[] = {0x3c00, 0x3c02, 0xbc00, 0x7c00, 0x0000};
+	glm::uint16 Rounded[5];
+	glm::packHalf(Ties, Rounded, 5);
+	for(std::size_t i = 0; i < 5; ++i)
+		Error += Rounded[i] == Expected[i] ? 0 : 1;
+
+	return Error;
+}
+
+static int test_unpackHalf()
+{
+	int Error = 0;
+
+	std::vector<glm::uint16> In(65536);
+	for(std::size_t i = 0; i < In.size(); ++i)
+		In[i] = static_cast<glm::uint16>(i);
+
+	std::vector<std::size_t> const Counts = tail_counts();
+	for(std::size_t n = 0; n < Counts.size(); ++n)
+	{
+		std::size_t const Count = Counts[n];
+		std::vector<float> Out(Count, -1.0f);
+		glm::unpackHalf(In.data() + 15360, Out.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Out[i] == glm::unpackHalf1x16(In[15360 + i]) ? 0 : 1;
+	}
+
+	// Bit exact for every half but NaN, whose quiet bit may be set
+	std::vector<float> Out(In.size());
+	glm::unpackHalf(In.data(), Out.data(), In.size());
+	for(std::size_t i = 0; i < In.size(); ++i)
+	{
+		float const Expected = glm::unpackHalf1x16(In[i]);
+		if(Expected != Expected)
+			Error += Out[i] != Out[i] ? 0 : 1;
+		else
+			Error += std::memcmp(&Out[i], &Expected, sizeof(float)) == 0 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<glm::uint32 (*Pack)(glm::vec4 const&), glm::vec4 (*Unpack)(glm::uint32)>
+static int test_pack(void (*PackBatch)(glm::vec4 const*, glm::uint32*, std::size_t), void (*UnpackBatch)(glm::uint32 const*, glm::vec4*, std::size_t))
+{
+	int Error = 0;
+
+	std::vector<std::size_t> const Counts = tail_counts();
+	for(std::size_t n = 0; n < Counts.size(); ++n)
+	{
+		std::size_t const Count = Counts[n];
+		std::vector<glm::vec4> const In = make_vectors(Count);
+
+		std::vector<glm::uint32> Packed(Count, 0);
+		PackBatch(In.data(), Packed.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Packed[i] == Pack(In[i]) ? 0 : 1;
+
+		std::vector<glm::vec4> Unpacked(Count, glm::vec4(-2.0f));
+		UnpackBatch(Packed.data(), Unpacked.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Unpacked[i] == Unpack(Packed[i]) ? 0 : 1;
+	}
+
+	// Every value of the first byte or field, with varying others. Compared with == rather than
+	// equal(x, y, 0.0f), whose subtraction the compiler may fuse with the scalar function's multiply.
+	std::vector<glm::uint32> Words(1024 * 3);
+	for(std::size_t i = 0; i < Words.size(); ++i)
+		Words[i] = static_cast<glm::uint32>(i) * 0x9E3779B9u;
+	std::vector<glm::vec4> Unpacked(Words.size());
+	UnpackBatch(Words.data(), Unpacked.data(), Words.size());
+	for(std::size_t i = 0; i < Words.size(); ++i)
+		Error += Unpacked[i] == Unpack(Words[i]) ? 0 : 1;
+
+	// Round trip
+	std::vector<glm::uint32> Repacked(Words.size());
+	PackBatch(Unpacked.data(), Repacked.data(), Unpacked.size());
+	for(std::size_t i = 0; i < Words.size(); ++i)
+		Error += Repacked[i] == Pack(Unpacked[i]) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_qualifier()
+{
+	int Error = 0;
+
+	typedef glm::vec<4, float, glm::lowp> vecType;
+	std::vector<vecType> In(13, vecType(0.25f, -0.5f, 0.75f, 1.0f));
+	std::vector<glm::uint32> Packed(In.size());
+	glm::packSnorm4x8(In.data(), Packed.data(), In.size());
+	std::vector<vecType> Out(In.size());
+	glm::unpackSnorm4x8(Packed.data(), Out.data(), Out.size());
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Error += glm::all(glm::equal(Out[i], In[i], 0.01f)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_packHalf();
+	Error += test_unpackHalf();
+	Error += test_pack<glm::packUnorm4x8, glm::unpackUnorm4x8>(glm::packUnorm4x8, glm::unpackUnorm4x8);
+	Error += test_pack<glm::packSnorm4x8, glm::unpackSnorm4x8>(glm::packSnorm4x8, glm::unpackSnorm4x8);
+	Error += test_pack<glm::packUnorm3x10_1x2, glm::unpackUnorm3x10_1x2>(glm::packUnorm3x10_1x2, glm::unpackUnorm3x10_1x2);
+	Error += test_pack<glm::packSnorm3x10_1x2, glm::unpackSnorm3x10_1x2>(glm::packSnorm3x10_1x2, glm::unpackSnorm3x10_1x2);
+	Error += test_qualifier();
+
+	return Error;
+}
@@ -1,88 +1,231 @@
-///////////////////////////////////////////////////////////////////////////////////////////////////
-// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
-///////////////////////////////////////////////////////////////////////////////////////////////////
-// Created : 2011-05-31
-// Updated : 2011-05-31
-// Licence : This source is under MIT licence
-// File    : test/gtx/random.cpp
-///////////////////////////////////////////////////////////////////////////////////////////////////
-
-#include <glm/glm.hpp>
+#define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/random.hpp>
-#include <glm/gtx/epsilon.hpp>
-#include <iostream>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
 
-int test_signedRand1()
+// Reference xoshiro128+ generators seeded as random_engine, one value of each per step
+class reference
 {
-	int Error = 0;
+public:
+	explicit reference(glm::uint64 Seed)
+		: Next(8)
+	{
+		glm::uint64 x = Seed;
+		for(int k = 0; k < 8; ++k)
+		for(int w = 0; w < 4; w += 2)
+		{
+			x += static_cast<glm::uint64>(0x9E3779B97F4A7C15ull);
+			glm::uint64 z = x;
+			z = (z ^ (z >> 30)) * static_cast<glm::uint64>(0xBF58476D1CE4E5B9ull);
+			z = (z ^ (z >> 27)) * static_cast<glm::uint64>(0x94D049BB133111EBull);
+			z = z ^ (z >> 31);
+			s[k][w] = static_cast<glm::uint32>(z);
+			s[k][w + 1] = static_cast<glm::uint32>(z >> 32);
+		}
+	}
 
+	glm::uint32 operator()()
 	{
-		float ResultFloat = 0.0f;
-		double ResultDouble = 0.0f;
-		for(std::size_t i = 0; i < 100000; ++i)
+		if(Next == 8)
 		{
-			ResultFloat += glm::signedRand1<float>();
-			ResultDouble += glm::signedRand1<double>();
+			for(int k = 0; k < 8; ++k)
+			{
+				Values[k] = s[k][0] + s[k][3];
+				glm::uint32 const t = s[k][1] << 9;
+				s[k][2] ^= s[k][0];
+				s[k][3] ^= s[k][1];
+				s[k][1] ^= s[k][2];
+				s[k][0] ^= s[k][3];
+				s[k][2] ^= t;
+				s[k][3] = (s[k][3] << 11) | (s[k][3] >> 21);
+			}
+			Next = 0;
 		}
+		return Values[Next++];
+	}
+
+private:
+	glm::uint32 s[8][4];
+	glm::uint32 Values[8];
+	int Next;
+};
+
+static int test_sequence()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1000;
 
-		Error += glm::equalEpsilon(ResultFloat, 0.0f, 0.0001f);
-		Error += glm::equalEpsilon(ResultDouble, 0.0, 0.0001);
+	reference Reference(42);
+	std::vector<glm::uint32> Expected(Count, 0);
+	for(std::size_t i = 0; i < Count; ++i)
+		Expected[i] = Reference();
+
+	// Same values whatever the split between the calls, so whatever the lanes left over
+	std::size_t const Splits[] = {1, 3, 8, 13, 100, Count};
+	for(std::size_t s = 0; s < sizeof(Splits) / sizeof(Splits[0]); ++s)
+	{
+		glm::random_engine Engine(42);
+		std::vector<glm::uint32> Values(Count, 0);
+		for(std::size_t i = 0; i < Count; i += Splits[s])
+			Engine.generate(&Values[i], glm::min(Splits[s], Count - i));
+		Error += Values == Expected ? 0 : 1;
+	}
+
+	// Reseeding restarts the sequence, other seeds give other sequences
+	glm::random_engine Engine(7);
+	std::vector<glm::uint32> Values(Count, 0);
+	Engine.generate(&Values[0], Count);
+	Error += Values != Expected ? 0 : 1;
+	Engine.seed(42);
+	Engine.generate(&Values[0], Count);
+	Error += Values == Expected ? 0 : 1;
+
+	// Floats from the 24 high bits, doubles from 2 consecutive integers
+	reference FloatReference(5);
+	glm::random_engine FloatEngine(5);
+	std::vector<float> Floats(Count, 0.0f);
+	FloatEngine.generate(&Floats[0], 3);
+	FloatEngine.generate(&Floats[3], Count - 3);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Floats[i] == static_cast<float>(FloatReference() >> 8) / 16777216.0f ? 0 : 1;
+
+	reference DoubleReference(6);
+	glm::random_engine DoubleEngine(6);
+	std::vector<double> Doubles(Count, 0.0);
+	DoubleEngine.generate(&Doubles[0], 5);
+	DoubleEngine.generate(&Doubles[5], Count - 5);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::uint64 const High = DoubleReference();
+		glm::uint64 const Low = DoubleReference();
+		Error += Doubles[i] == static_cast<double>(((High << 32) | Low) >> 11) / 9007199254740992.0 ? 0 : 1;
 	}
 
 	return Error;
 }
 
-int test_normalizedRand2()
+template<typename T>
+static int test_linearRand()
 {
 	int Error = 0;
 
+	std::size_t const Count = 100000;
+	glm::random_engine Engine(1);
+
+	std::vector<T> Values(Count, static_cast<T>(0));
+	glm::linearRand(Engine, static_cast<T>(-2), static_cast<T>(6), &Values[0], Count);
+	T Sum = static_cast<T>(0);
+	for(std::size_t i = 0; i < Count; ++i)
 	{
-		std::size_t Max = 100000;
-		float ResultFloat = 0.0f;
-		double ResultDouble = 0.0f;
-		for(std::size_t i = 0; i < Max; ++i)
-		{
-			ResultFloat += glm::length(glm::normalizedRand2<float>());
-			ResultDouble += glm::length(glm::normalizedRand2<double>());
-		}
+		Error += Values[i] >= static_cast<T>(-2) && Values[i] < static_cast<T>(6) ? 0 : 1;
+		Sum += Values[i];
+	}
+	Error += glm::equal(Sum / static_cast<T>(Count), static_cast<T>(2), static_cast<T>(0.05)) ? 0 : 1;
+
+	glm::vec<3, T> const Min(-1, 0, 10);
+	glm::vec<3, T> const Max(1, 4, 11);
+	std::vector<glm::vec<3, T> > Vectors(Count, glm::vec<3, T>(0));
+	glm::linearRand(Engine, Min, Max, &Vectors[0], Count);
+	glm::vec<3, T> VectorSum(0);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::all(glm::greaterThanEqual(Vectors[i], Min)) && glm::all(glm::lessThan(Vectors[i], Max)) ? 0 : 1;
+		VectorSum += Vectors[i];
+	}
+	Error += glm::all(glm::equal(VectorSum / static_cast<T>(Count), (Min + Max) / static_cast<T>(2), static_cast<T>(0.05))) ? 0 : 1;
 
-		Error += glm::equalEpsilon(ResultFloat, float(Max), 0.000001f) ? 0 : 1;
-		Error += glm::equalEpsilon(ResultDouble, double(Max), 0.000001) ? 0 : 1;
-		assert(!Error);
+	return Error;
+}
+
+template<typename T>
+static int test_gaussRand()
+{
+	int Error = 0;
+
+	std::size_t const Count = 100000;
+	glm::random_engine Engine(2);
+
+	std::vector<T> Values(Count, static_cast<T>(0));
+	glm::gaussRand(Engine, static_cast<T>(3), static_cast<T>(2), &Values[0], Count);
+	T Sum = static_cast<T>(0);
+	T SquareSum = static_cast<T>(0);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Sum += Values[i];
+		SquareSum += Values[i] * Values[i];
 	}
+	T const Mean = Sum / static_cast<T>(Count);
+	Error += glm::equal(Mean, static_cast<T>(3), static_cast<T>(0.05)) ? 0 : 1;
+	Error += glm::equal(glm::sqrt(SquareSum / static_cast<T>(Count) - Mean * Mean), static_cast<T>(2), static_cast<T>(0.05)) ? 0 : 1;
+
+	std::vector<glm::vec<2, T> > Vectors(Count, glm::vec<2, T>(0));
+	glm::gaussRand(Engine, glm::vec<2, T>(0, 10), glm::vec<2, T>(1, 0.5), &Vectors[0], Count);
+	glm::vec<2, T> VectorSum(0);
+	glm::vec<2, T> VectorSquareSum(0);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		VectorSum += Vectors[i];
+		VectorSquareSum += Vectors[i] * Vectors[i];
+	}
+	glm::vec<2, T> const VectorMean(VectorSum / static_cast<T>(Count));
+	Error += glm::all(glm::equal(VectorMean, glm::vec<2, T>(0, 10), static_cast<T>(0.05))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::sqrt(VectorSquareSum / static_cast<T>(Count) - VectorMean * VectorMean), glm::vec<2, T>(1, 0.5), static_cast<T>(0.05))) ? 0 : 1;
 
 	return Error;
 }
 
-int test_normalizedRand3()
+template<typename T>
+static int test_geometric()
 {
 	int Error = 0;
 
+	std::size_t const Count = 10000;
+	T const Radius = static_cast<T>(3);
+	T const Epsilon = static_cast<T>(1e-4);
+	glm::random_engine Engine(3);
+
+	std::vector<glm::vec<2, T> > Points2(Count, glm::vec<2, T>(0));
+	std::vector<glm::vec<3, T> > Points3(Count, glm::vec<3, T>(0));
+
+	// On the circle and sphere, centered on the origin
+	glm::circularRand(Engine, Radius, &Points2[0], Count);
+	glm::vec<2, T> Sum2(0);
+	for(std::size_t i = 0; i < Count; ++i)
 	{
-		std::size_t Max = 100000;
-		float ResultFloatA = 0.0f;
-		float ResultFloatB = 0.0f;
-		float ResultFloatC = 0.0f;
-		double ResultDoubleA = 0.0f;
-		double ResultDoubleB = 0.0f;
-		double ResultDoubleC = 0.0f;
-		for(std::size_t i = 0; i < Max; ++i)
-		{
-			ResultFloatA += glm::length(glm::normalizedRand3<float>());
-			ResultDoubleA += glm::length(glm::normalizedRand3<double>());
-			ResultFloatB += glm::length(glm::normalizedRand3(2.0f, 2.0f));
-			ResultDoubleB += glm::length(glm::normalizedRand3(2.0, 2.0));
-			ResultFloatC += glm::length(glm::normalizedRand3(1.0f, 3.0f));
-			ResultDoubleC += glm::length(glm::normalizedRand3(1.0, 3.0));
-		}
+		Error += glm::equal(glm::length(Points2[i]), Radius, Epsilon) ? 0 : 1;
+		Sum2 += Points2[i];
+	}
+	Error += glm::all(glm::equal(Sum2 / static_cast<T>(Count), glm::vec<2, T>(0), static_cast<T>(0.1))) ? 0 : 1;
 
-		Error += glm::equalEpsilon(ResultFloatA, float(Max), 0.0001f) ? 0 : 1;
-		Error += glm::equalEpsilon(ResultDoubleA, double(Max), 0.0001) ? 0 : 1;
-		Error += glm::equalEpsilon(ResultFloatB, float(Max * 2), 0.0001f) ? 0 : 1;
-		Error += glm::equalEpsilon(ResultDoubleB, double(Max * 2), 0.0001) ? 0 : 1;
-		Error += (ResultFloatC >= float(Max) && ResultFloatC <= float(Max * 3)) ? 0 : 1;
-		Error += (ResultDoubleC >= double(Max) && ResultDoubleC <= double(Max * 3)) ? 0 : 1;
+	glm::sphericalRand(Engine, Radius, &Points3[0], Count);
+	glm::vec<3, T> Sum3(0);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::equal(glm::length(Points3[i]), Radius, Epsilon) ? 0 : 1;
+		Sum3 += Points3[i];
+	}
+	Error += glm::all(glm::equal(Sum3 / static_cast<T>(Count), glm::vec<3, T>(0), static_cast<T>(0.1))) ? 0 : 1;
+
+	// In the disk and ball, with the mean squared distance of uniform densities: R^2 / 2 and 3 R^2 / 5
+	glm::diskRand(Engine, Radius, &Points2[0], Count);
+	T SquareSum = static_cast<T>(0);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::length(Points2[i]) <= Radius + Epsilon ? 0 : 1;
+		SquareSum += glm::dot(Points2[i], Points2[i]);
+	}
+	Error += glm::equal(SquareSum / static_cast<T>(Count), Radius * Radius / static_cast<T>(2), static_cast<T>(0.1)) ? 0 : 1;
+
+	glm::ballRand(Engine, Radius, &Points3[0], Count);
+	SquareSum = static_cast<T>(0);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::length(Points3[i]) <= Radius + Epsilon ? 0 : 1;
+		SquareSum += glm::dot(Points3[i], Points3[i]);
 	}
+	Error += glm::equal(SquareSum / static_cast<T>(Count), Radius * Radius * static_cast<T>(3) / static_cast<T>(5), static_cast<T>(0.1)) ? 0 : 1;
 
 	return Error;
 }
@@ -91,9 +234,13 @@ int main()
 {
 	int Error = 0;
 
-	Error += test_signedRand1();
-	Error += test_normalizedRand2();
-	Error += test_normalizedRand3();
+	Error += test_sequence();
+	Error += test_linearRand<float>();
+	Error += test_linearRand<double>();
+	Error += test_gaussRand<float>();
+	Error += test_gaussRand<double>();
+	Error += test_geometric<float>();
+	Error += test_geometric<double>();
 
 	return Error;
 }
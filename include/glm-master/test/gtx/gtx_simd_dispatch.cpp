@@ -0,0 +1,195 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/simd_dispatch.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cstring>
+#include <vector>
+
+static int test_level()
+{
+	int Error = 0;
+
+	glm::simd_level const Supported = glm::simd_level_supported();
+	Error += Supported < glm::simd_level_count ? 0 : 1;
+	Error += glm::simd_level_current() == Supported ? 0 : 1;
+
+	// Levels above the supported one are clamped
+	Error += glm::simd_level_force(glm::simd_level_avx512) == Supported ? 0 : 1;
+	Error += glm::simd_level_force(glm::simd_level_none) == glm::simd_level_none ? 0 : 1;
+	Error += glm::simd_level_current() == glm::simd_level_none ? 0 : 1;
+	Error += glm::simd_level_force(Supported) == Supported ? 0 : 1;
+
+	for(int Level = 0; Level < glm::simd_level_count; ++Level)
+		Error += std::strcmp(glm::simd_level_name(static_cast<glm::simd_level>(Level)), "unknown") != 0 ? 0 : 1;
+	Error += std::strcmp(glm::simd_level_name(glm::simd_level_count), "unknown") == 0 ? 0 : 1;
+
+	return Error;
+}
+
+// Vectors per iteration of each level's transform_batch kernel. The AVX-512 one ends with a masked
+// register; the others with one vector at a time. The SSE2 level and the code without dispatch run
+// glm::transform_batch, which takes 8 then 4.
+static std::size_t transform_width(glm::simd_level Level)
+{
+	switch(Level)
+	{
+	case glm::simd_level_avx512:
+		return 4;
+	default:
+		return 8;
+	}
+}
+
+static int test_transform_batch(glm::simd_level Level)
+{
+	int Error = 0;
+
+	glm::mat4 const M(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+
+	// Every tail length after zero, one and two full iterations
+	std::size_t const Width = transform_width(Level);
+	for(std::size_t Count = 0; Count < Width * 3; ++Count)
+	{
+		std::vector<glm::vec4> In(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = glm::vec4(static_cast<float>(i), static_cast<float>(i) * 0.5f, 1.0f - static_cast<float>(i), 1.0f);
+
+		std::vector<glm::vec4> Out(Count, glm::vec4(-1.0f));
+		glm::dispatch::transform_batch(M, In.data(), Out.data(), Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], M * In[i], 0.001f)) ? 0 : 1;
+
+		// In place
+		glm::dispatch::transform_batch(M, In.data(), In.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(In[i], Out[i], 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static std::vector<glm::mat4> make_matrices(std::size_t Count)
+{
+	std::vector<glm::mat4> Result(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float const f = static_cast<float>(i);
+		glm::mat4 const R = glm::rotate(glm::mat4(1.0f), 0.3f + f, glm::normalize(glm::vec3(1.0f, f, 2.0f)));
+		glm::mat4 const S = glm::scale(glm::mat4(1.0f), glm::vec3(1.0f + f, 2.0f, 0.5f));
+		Result[i] = glm::translate(R * S, glm::vec3(f, -1.0f, 3.0f));
+	}
+	return Result;
+}
+
+static int test_mul_batch()
+{
+	int Error = 0;
+
+	glm::mat4 const M(glm::perspective(1.0f, 1.5f, 0.1f, 100.0f));
+
+	for(std::size_t Count = 0; Count < 11; ++Count)
+	{
+		std::vector<glm::mat4> const In = make_matrices(Count);
+		std::vector<glm::mat4> Out(Count);
+		glm::dispatch::mul_batch(M, In.data(), Out.data(), Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], M * In[i], 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_inverse_batch()
+{
+	int Error = 0;
+
+	for(std::size_t Count = 0; Count < 11; ++Count)
+	{
+		std::vector<glm::mat4> In = make_matrices(Count);
+		std::vector<glm::mat4> Out(Count);
+		glm::dispatch::inverse_batch(In.data(), Out.data(), Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], glm::inverse(In[i]), 0.001f)) ? 0 : 1;
+
+		// In place
+		glm::dispatch::inverse_batch(In.data(), In.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(In[i], Out[i], 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Components per iteration of each level's soa_dot kernel before the scalar tail. Without dispatch,
+// glm::dot runs the widest vec_soa pack.
+static std::size_t dot_width(glm::simd_level Level)
+{
+	switch(Level)
+	{
+	case glm::simd_level_sse2:
+	case glm::simd_level_sse41:
+		return 4;
+	case glm::simd_level_avx2:
+		return 8;
+	case glm::simd_level_avx512:
+		return 16;
+	default:
+		return glm::detail::soa_native<float>::type::width;
+	}
+}
+
+template<glm::length_t L>
+static int test_dot(glm::simd_level Level)
+{
+	int Error = 0;
+
+	// Every tail length after zero, one and two full iterations
+	std::size_t const Width = dot_width(Level);
+	for(std::size_t Count = 0; Count < Width * 3; ++Count)
+	{
+		glm::vec_soa<L, float> X(Count);
+		glm::vec_soa<L, float> Y(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			X.store(i, glm::vec<L, float>(static_cast<float>(i) * 0.25f));
+			Y.store(i, glm::vec<L, float>(1.0f - static_cast<float>(i)));
+		}
+
+		std::vector<float> Out(Count, -1.0f);
+		glm::dispatch::dot(X, Y, Out.data());
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::equal(Out[i], glm::dot(X.load(i), Y.load(i)), 0.001f) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_level();
+
+	// Every level the machine supports must match the compile time code
+	glm::simd_level const Supported = glm::simd_level_supported();
+	for(int Level = glm::simd_level_none; Level <= Supported; ++Level)
+	{
+		glm::simd_level const Forced = glm::simd_level_force(static_cast<glm::simd_level>(Level));
+		Error += Forced == Level ? 0 : 1;
+
+		Error += test_transform_batch(Forced);
+		Error += test_mul_batch();
+		Error += test_inverse_batch();
+		Error += test_dot<2>(Forced);
+		Error += test_dot<3>(Forced);
+		Error += test_dot<4>(Forced);
+	}
+
+	return Error;
+}
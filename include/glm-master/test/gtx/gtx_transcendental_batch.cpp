@@ -0,0 +1,248 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/transcendental_batch.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// Distance between a float and an exact value, in units in the last place of the exact value
+static double ulp(float Value, double Exact)
+{
+	if(std::isnan(Exact))
+		return std::isnan(Value) ? 0.0 : std::numeric_limits<double>::infinity();
+	if(std::isinf(Value) || std::fabs(Exact) > static_cast<double>(std::numeric_limits<float>::max()))
+		return static_cast<double>(Value) == Exact || (std::isinf(Value) && Value * Exact > 0) ? 0.0 : std::numeric_limits<double>::infinity();
+
+	int Exponent = 0;
+	std::frexp(Exact, &Exponent);
+	return std::fabs(static_cast<double>(Value) - Exact) / std::ldexp(1.0, glm::max(Exponent, -125) - 24);
+}
+
+static std::vector<float> make_values(float Min, float Max, std::size_t Count)
+{
+	std::vector<float> Result(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Result[i] = Min + (Max - Min) * static_cast<float>(i) / static_cast<float>(Count - 1);
+	return Result;
+}
+
+static int check(std::vector<float> const& Out, std::vector<float> const& In, double (*Exact)(double), double MaxUlp)
+{
+	int Error = 0;
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Error += ulp(Out[i], Exact(static_cast<double>(In[i]))) <= MaxUlp ? 0 : 1;
+	return Error;
+}
+
+static double exp2_exact(double x)
+{
+	return std::pow(2.0, x);
+}
+
+static double log2_exact(double x)
+{
+	return std::log(x) / std::log(2.0);
+}
+
+static int test_trigonometric()
+{
+	int Error = 0;
+
+	std::size_t const Count = 100003;
+	std::vector<float> const In = make_values(-8192.0f, 8192.0f, Count);
+	std::vector<float> Sin(Count), Cos(Count), Tan(Count);
+
+	glm::sin(In.data(), Sin.data(), Count);
+	Error += check(Sin, In, std::sin, 2.5);
+	glm::cos(In.data(), Cos.data(), Count);
+	Error += check(Cos, In, std::cos, 2.5);
+	glm::tan(In.data(), Tan.data(), Count);
+	Error += check(Tan, In, std::tan, 4.5);
+
+	// sincos gives the values of sin and cos
+	std::vector<float> SinCos(Count), CosSin(Count);
+	glm::sincos(In.data(), SinCos.data(), CosSin.data(), Count);
+	Error += SinCos == Sin ? 0 : 1;
+	Error += CosSin == Cos ? 0 : 1;
+
+	// Small values, out of the polynomial domain and special values
+	float const Special[] = {0.0f, -0.0f, 1e-30f, -1e-8f, 3e4f, -1e20f, std::numeric_limits<float>::max(),
+		std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()};
+	std::vector<float> const SpecialIn(Special, Special + sizeof(Special) / sizeof(Special[0]));
+	std::vector<float> SpecialOut(SpecialIn.size());
+	glm::sin(SpecialIn.data(), SpecialOut.data(), SpecialIn.size());
+	Error += check(SpecialOut, SpecialIn, std::sin, 2.5);
+	Error += std::signbit(SpecialOut[1]) ? 0 : 1;
+	glm::cos(SpecialIn.data(), SpecialOut.data(), SpecialIn.size());
+	Error += check(SpecialOut, SpecialIn, std::cos, 2.5);
+	glm::tan(SpecialIn.data(), SpecialOut.data(), SpecialIn.size());
+	Error += check(SpecialOut, SpecialIn, std::tan, 4.5);
+
+	return Error;
+}
+
+static int test_atan()
+{
+	int Error = 0;
+
+	// Angles all around the circle, with radii from denormals to large values
+	std::size_t const Count = 100000;
+	std::vector<float> Y(Count), X(Count), Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		double const Angle = static_cast<double>(i) * 0.0123;
+		float const Radius = std::ldexp(1.0f, static_cast<int>(i % 250) - 140);
+		Y[i] = static_cast<float>(std::sin(Angle)) * Radius;
+		X[i] = static_cast<float>(std::cos(Angle)) * Radius;
+	}
+	glm::atan(Y.data(), X.data(), Out.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += ulp(Out[i], std::atan2(static_cast<double>(Y[i]), static_cast<double>(X[i]))) <= 3.5 ? 0 : 1;
+
+	// Signed zeros, infinities and NaN
+	float const Inf = std::numeric_limits<float>::infinity();
+	float const SpecialY[] = {0.0f, -0.0f, 0.0f, -0.0f, 1.0f, -1.0f, Inf, Inf, -Inf, 1.0f, std::numeric_limits<float>::quiet_NaN()};
+	float const SpecialX[] = {0.0f, 0.0f, -0.0f, -0.0f, Inf, -Inf, 1.0f, Inf, -Inf, 0.0f, 1.0f};
+	std::size_t const SpecialCount = sizeof(SpecialY) / sizeof(SpecialY[0]);
+	float SpecialOut[SpecialCount];
+	glm::atan(SpecialY, SpecialX, SpecialOut, SpecialCount);
+	for(std::size_t i = 0; i < SpecialCount; ++i)
+	{
+		double const Exact = std::atan2(static_cast<double>(SpecialY[i]), static_cast<double>(SpecialX[i]));
+		Error += ulp(SpecialOut[i], Exact) <= 3.5 && std::signbit(SpecialOut[i]) == std::signbit(Exact) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_exponential()
+{
+	int Error = 0;
+
+	std::size_t const Count = 100003;
+
+	// Down to denormal results and up to overflows
+	std::vector<float> const ExpIn = make_values(-110.0f, 90.0f, Count);
+	std::vector<float> Out(Count);
+	glm::exp(ExpIn.data(), Out.data(), Count);
+	Error += check(Out, ExpIn, std::exp, 1.5);
+
+	std::vector<float> const Exp2In = make_values(-155.0f, 130.0f, Count);
+	glm::exp2(Exp2In.data(), Out.data(), Count);
+	Error += check(Out, Exp2In, exp2_exact, 1.5);
+
+	// Every binade of the positive floats, denormals included
+	std::vector<float> LogIn(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		LogIn[i] = std::ldexp(1.0f + static_cast<float>(i % 1000) / 1000.0f, static_cast<int>(i % 277) - 149);
+	glm::log(LogIn.data(), Out.data(), Count);
+	Error += check(Out, LogIn, std::log, 1.0);
+	glm::log2(LogIn.data(), Out.data(), Count);
+	Error += check(Out, LogIn, log2_exact, 1.5);
+
+	float const Inf = std::numeric_limits<float>::infinity();
+	float const Special[] = {0.0f, -0.0f, -1.0f, 1.0f, Inf, -Inf, std::numeric_limits<float>::quiet_NaN()};
+	std::vector<float> const SpecialIn(Special, Special + sizeof(Special) / sizeof(Special[0]));
+	std::vector<float> SpecialOut(SpecialIn.size());
+	glm::exp(SpecialIn.data(), SpecialOut.data(), SpecialIn.size());
+	Error += check(SpecialOut, SpecialIn, std::exp, 1.5);
+	glm::exp2(SpecialIn.data(), SpecialOut.data(), SpecialIn.size());
+	Error += check(SpecialOut, SpecialIn, exp2_exact, 1.5);
+	glm::log(SpecialIn.data(), SpecialOut.data(), SpecialIn.size());
+	Error += check(SpecialOut, SpecialIn, std::log, 1.0);
+	glm::log2(SpecialIn.data(), SpecialOut.data(), SpecialIn.size());
+	Error += check(SpecialOut, SpecialIn, log2_exact, 1.5);
+
+	return Error;
+}
+
+static int test_pow()
+{
+	int Error = 0;
+
+	std::size_t const Count = 100000;
+	std::vector<float> Base(Count), Exponent(Count), Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Base[i] = std::ldexp(1.0f + static_cast<float>(i % 997) / 997.0f, static_cast<int>(i % 13) - 6);
+		Exponent[i] = static_cast<float>(static_cast<int>(i % 4001) - 2000) / 100.0f;
+	}
+	glm::pow(Base.data(), Exponent.data(), Out.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += ulp(Out[i], std::pow(static_cast<double>(Base[i]), static_cast<double>(Exponent[i]))) <= 1.0 ? 0 : 1;
+
+	// Negative bases, zeros, infinities and NaN
+	float const Inf = std::numeric_limits<float>::infinity();
+	float const SpecialBase[] = {-2.0f, -2.0f, 0.0f, 0.0f, -0.0f, 1.0f, 2.0f, 2.0f, Inf, std::numeric_limits<float>::quiet_NaN(), 1e-30f};
+	float const SpecialExponent[] = {3.0f, 0.5f, 2.0f, -1.0f, 3.0f, Inf, 200.0f, -200.0f, 0.5f, 0.0f, 5.0f};
+	std::size_t const SpecialCount = sizeof(SpecialBase) / sizeof(SpecialBase[0]);
+	float SpecialOut[SpecialCount];
+	glm::pow(SpecialBase, SpecialExponent, SpecialOut, SpecialCount);
+	for(std::size_t i = 0; i < SpecialCount; ++i)
+		Error += ulp(SpecialOut[i], std::pow(static_cast<double>(SpecialBase[i]), static_cast<double>(SpecialExponent[i]))) <= 1.0 ? 0 : 1;
+
+	return Error;
+}
+
+// Every array length gives the values of the full array, whatever the values left over
+static int test_tail()
+{
+	int Error = 0;
+
+	std::size_t const Count = 37;
+	std::vector<float> const In = make_values(0.125f, 9.0f, Count);
+	std::vector<float> Expected(Count);
+	glm::log(In.data(), Expected.data(), Count);
+
+	for(std::size_t Length = 0; Length <= Count; ++Length)
+	{
+		std::vector<float> Out(Count, -1.0f);
+		glm::log(In.data(), Out.data(), Length);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Out[i] == (i < Length ? Expected[i] : -1.0f) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// The vec4 functions of aligned types use the same approximations
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+static int test_aligned_vec4()
+{
+	int Error = 0;
+
+	glm::aligned_vec4 const x(-3.0f, 0.5f, 2.0f, 40.0f);
+	glm::aligned_vec4 const y(0.25f, 1.0f, 3.0f, 7.0f);
+
+	glm::aligned_vec4 const Results[] = {glm::sin(x), glm::cos(x), glm::tan(x), glm::atan(x, y), glm::exp(x), glm::exp2(x), glm::log(y), glm::log2(y), glm::pow(y, x)};
+	double const Bounds[] = {2.5, 2.5, 4.5, 3.5, 1.5, 1.5, 1.0, 1.5, 1.0};
+	for(glm::length_t c = 0; c < 4; ++c)
+	{
+		double const a = static_cast<double>(x[c]);
+		double const b = static_cast<double>(y[c]);
+		double const Exact[] = {std::sin(a), std::cos(a), std::tan(a), std::atan2(a, b), std::exp(a), std::pow(2.0, a), std::log(b), log2_exact(b), std::pow(b, a)};
+		for(std::size_t i = 0; i < sizeof(Exact) / sizeof(Exact[0]); ++i)
+			Error += ulp(Results[i][c], Exact[i]) <= Bounds[i] ? 0 : 1;
+	}
+
+	return Error;
+}
+#endif//GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_trigonometric();
+	Error += test_atan();
+	Error += test_exponential();
+	Error += test_pow();
+	Error += test_tail();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_aligned_vec4();
+#	endif
+
+	return Error;
+}
@@ -0,0 +1,58 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/transform_batch.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
+
+template<typename matType, typename vecType>
+static int test_count(matType const& M, std::size_t Count)
+{
+	typedef typename matType::value_type T;
+
+	int Error = 0;
+
+	std::vector<vecType> In(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = vecType(static_cast<T>(i), static_cast<T>(i) * static_cast<T>(0.5), static_cast<T>(1) - static_cast<T>(i), static_cast<T>(1));
+
+	std::vector<vecType> Out(Count, vecType(static_cast<T>(-1)));
+	glm::transform_batch(M, In.data(), Out.data(), Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], M * In[i], static_cast<T>(0.001))) ? 0 : 1;
+
+	// In place
+	glm::transform_batch(M, In.data(), In.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(In[i], Out[i], static_cast<T>(0.001))) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename matType, typename vecType>
+static int test_transform_batch()
+{
+	int Error = 0;
+
+	matType const M(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+
+	// glm_mat4_mul_vec4_batch runs 8 vectors per iteration with AVX, then 4 with SSE2 or NEON,
+	// then one at a time: take every mix of the three, up to two AVX iterations and a 3 long tail.
+	for(std::size_t Wide = 0; Wide < 3; ++Wide)
+	for(std::size_t Narrow = 0; Narrow < 2; ++Narrow)
+	for(std::size_t Tail = 0; Tail < 4; ++Tail)
+		Error += test_count<matType, vecType>(M, Wide * 8 + Narrow * 4 + Tail);
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_transform_batch<glm::mat4, glm::vec4>();
+	Error += test_transform_batch<glm::dmat4, glm::dvec4>();
+	Error += test_transform_batch<glm::mat<4, 4, float, glm::lowp>, glm::vec<4, float, glm::lowp> >();
+
+	return Error;
+}
@@ -0,0 +1,167 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/vec_soa.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
+
+template<glm::length_t L, typename T>
+static std::vector<glm::vec<L, T, glm::defaultp> > make_vectors(std::size_t Count, T Seed)
+{
+	std::vector<glm::vec<L, T, glm::defaultp> > Result(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		for(glm::length_t c = 0; c < L; ++c)
+			Result[i][c] = glm::sin(Seed + static_cast<T>(i * 7 + static_cast<std::size_t>(c) * 3)) * static_cast<T>(4);
+	return Result;
+}
+
+// The bulk kernels run the widest SIMD pack available for T, then one vector at a time:
+// take every tail length after zero, one and two pack iterations.
+template<typename T>
+static std::vector<std::size_t> tail_counts()
+{
+	std::size_t const Width = glm::detail::soa_native<T>::type::width;
+
+	std::vector<std::size_t> Result;
+	for(std::size_t Packs = 0; Packs < 3; ++Packs)
+		for(std::size_t Tail = 0; Tail < Width; ++Tail)
+			Result.push_back(Packs * Width + Tail);
+	return Result;
+}
+
+template<glm::length_t L, typename T>
+static int test_container()
+{
+	int Error = 0;
+
+	glm::vec_soa<L, T> A(3);
+	Error += A.size() == 3 ? 0 : 1;
+	for(glm::length_t c = 0; c < L; ++c)
+		Error += reinterpret_cast<std::size_t>(A[c]) % 64 == 0 ? 0 : 1;
+
+	glm::vec<L, T, glm::defaultp> V(static_cast<T>(1));
+	A.store(1, V);
+	Error += glm::all(glm::equal(A.load(1), V)) ? 0 : 1;
+	Error += glm::all(glm::equal(A.load(0), glm::vec<L, T, glm::defaultp>(static_cast<T>(0)))) ? 0 : 1;
+
+	// Growing keeps the content and zeroes the new vectors
+	A.resize(100);
+	Error += glm::all(glm::equal(A.load(1), V)) ? 0 : 1;
+	Error += glm::all(glm::equal(A.load(99), glm::vec<L, T, glm::defaultp>(static_cast<T>(0)))) ? 0 : 1;
+
+	glm::vec_soa<L, T> B(A);
+	Error += B.size() == A.size() ? 0 : 1;
+	Error += glm::all(glm::equal(B.load(1), V)) ? 0 : 1;
+
+	glm::vec_soa<L, T> C;
+	C = B;
+	Error += C.size() == B.size() ? 0 : 1;
+	Error += glm::all(glm::equal(C.load(1), V)) ? 0 : 1;
+
+	return Error;
+}
+
+template<glm::length_t L, typename T>
+static int test_bulk()
+{
+	typedef glm::vec<L, T, glm::defaultp> vecType;
+
+	int Error = 0;
+	T const Epsilon = static_cast<T>(0.0001);
+
+	std::vector<std::size_t> const Counts = tail_counts<T>();
+	for(std::size_t n = 0; n < Counts.size(); ++n)
+	{
+		std::size_t const Count = Counts[n];
+		std::vector<vecType> const X = make_vectors<L, T>(Count, static_cast<T>(0));
+		std::vector<vecType> const Y = make_vectors<L, T>(Count, static_cast<T>(1));
+
+		glm::vec_soa<L, T> SX;
+		glm::vec_soa<L, T> SY;
+		glm::aos_to_soa(X.data(), Count, SX);
+		glm::aos_to_soa(Y.data(), Count, SY);
+		Error += SX.size() == Count ? 0 : 1;
+
+		std::vector<vecType> RoundTrip(Count);
+		glm::soa_to_aos(SX, RoundTrip.data());
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(RoundTrip[i], X[i])) ? 0 : 1;
+
+		std::vector<T> Scalars(Count);
+
+		glm::dot(SX, SY, Scalars.data());
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::equal(Scalars[i], glm::dot(X[i], Y[i]), Epsilon) ? 0 : 1;
+
+		glm::length(SX, Scalars.data());
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::equal(Scalars[i], glm::length(X[i]), Epsilon) ? 0 : 1;
+
+		glm::vec_soa<L, T> Out;
+
+		glm::normalize(SX, Out);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out.load(i), glm::normalize(X[i]), Epsilon)) ? 0 : 1;
+
+		glm::mix(SX, SY, static_cast<T>(0.25), Out);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out.load(i), glm::mix(X[i], Y[i], static_cast<T>(0.25)), Epsilon)) ? 0 : 1;
+
+		glm::clamp(SX, static_cast<T>(-1), static_cast<T>(2), Out);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out.load(i), glm::clamp(X[i], static_cast<T>(-1), static_cast<T>(2)), Epsilon)) ? 0 : 1;
+
+		// In place
+		glm::clamp(SX, static_cast<T>(-1), static_cast<T>(2), SX);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(SX.load(i), Out.load(i))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_cross()
+{
+	typedef glm::vec<3, T, glm::defaultp> vecType;
+
+	int Error = 0;
+
+	std::vector<std::size_t> const Counts = tail_counts<T>();
+	for(std::size_t n = 0; n < Counts.size(); ++n)
+	{
+		std::size_t const Count = Counts[n];
+		std::vector<vecType> const X = make_vectors<3, T>(Count, static_cast<T>(0));
+		std::vector<vecType> const Y = make_vectors<3, T>(Count, static_cast<T>(1));
+
+		glm::vec_soa<3, T> SX;
+		glm::vec_soa<3, T> SY;
+		glm::aos_to_soa(X.data(), Count, SX);
+		glm::aos_to_soa(Y.data(), Count, SY);
+
+		glm::cross(SX, SY, SX);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(SX.load(i), glm::cross(X[i], Y[i]), static_cast<T>(0.0001))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_container<2, float>();
+	Error += test_container<3, float>();
+	Error += test_container<4, double>();
+
+	Error += test_bulk<2, float>();
+	Error += test_bulk<3, float>();
+	Error += test_bulk<4, float>();
+	Error += test_bulk<3, double>();
+	Error += test_bulk<4, double>();
+
+	Error += test_cross<float>();
+	Error += test_cross<double>();
+
+	return Error;
+}
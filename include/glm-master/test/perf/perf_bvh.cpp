@@ -0,0 +1,112 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#define GLM_FORCE_INLINE
+#include <glm/gtx/bvh.hpp>
+#include <glm/gtx/intersect.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <limits>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+static int elapsed(clock_type::time_point t1, clock_type::time_point t2)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static float per_ray(clock_type::time_point t1, clock_type::time_point t2, std::size_t Count)
+{
+	return static_cast<float>(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count()) / static_cast<float>(Count) / 1000.0f;
+}
+
+int main()
+{
+	int Error = 0;
+
+	// Terrain of about a million triangles
+	int const Size = 708;
+	std::vector<glm::vec3> Vertices;
+	for(int z = 0; z < Size; ++z)
+	for(int x = 0; x < Size; ++x)
+		Vertices.push_back(glm::vec3(static_cast<float>(x), glm::sin(static_cast<float>(x) * 0.05f) * glm::cos(static_cast<float>(z) * 0.07f) * 20.0f, static_cast<float>(z)));
+
+	std::vector<glm::uint32> Indices;
+	for(int z = 0; z < Size - 1; ++z)
+	for(int x = 0; x < Size - 1; ++x)
+	{
+		glm::uint32 const i = static_cast<glm::uint32>(z * Size + x);
+		glm::uint32 const Quad[6] = {i, i + Size, i + 1, i + 1, i + Size, i + Size + 1};
+		Indices.insert(Indices.end(), Quad, Quad + 6);
+	}
+	std::size_t const TriangleCount = Indices.size() / 3;
+
+	clock_type::time_point const t1 = clock_type::now();
+	glm::bvh<float> Tree;
+	Tree.build(Vertices.data(), Indices.data(), TriangleCount, 1);
+	clock_type::time_point const t2 = clock_type::now();
+	glm::bvh<float> Threaded;
+	Threaded.build(Vertices.data(), Indices.data(), TriangleCount, 0);
+	clock_type::time_point const t3 = clock_type::now();
+
+	std::printf("build %d triangles: %d us\n", static_cast<int>(TriangleCount), elapsed(t1, t2));
+	std::printf("build %d triangles, all threads: %d us\n", static_cast<int>(TriangleCount), elapsed(t2, t3));
+	Error += Tree.node_count() == Threaded.node_count() ? 0 : 1;
+
+	// Picking rays of a camera looking down at the terrain, consecutive rays in the same screen tile
+	int const Width = 256;
+	int const Height = 256;
+	glm::vec3 const Eye(354.0f, 200.0f, -100.0f);
+	std::vector<glm::vec3> Orig;
+	std::vector<glm::vec3> Dir;
+	for(int ty = 0; ty < Height; ty += 4)
+	for(int tx = 0; tx < Width; tx += 2)
+	for(int y = ty; y < ty + 4; ++y)
+	for(int x = tx; x < tx + 2; ++x)
+	{
+		Orig.push_back(Eye);
+		Dir.push_back(glm::vec3(static_cast<float>(x - Width / 2) / static_cast<float>(Width), -0.5f + static_cast<float>(y) / static_cast<float>(Height) * 0.4f, 1.0f));
+	}
+
+	// Testing every triangle
+	std::size_t const BruteCount = 16;
+	std::vector<float> Brute(BruteCount, std::numeric_limits<float>::max());
+	clock_type::time_point const t4 = clock_type::now();
+	for(std::size_t r = 0; r < BruteCount; ++r)
+	{
+		std::size_t const Ray = r * Orig.size() / BruteCount;
+		for(std::size_t i = 0; i < TriangleCount; ++i)
+		{
+			glm::vec2 BaryPosition(0);
+			float Distance = 0.0f;
+			if(glm::intersectRayTriangle(Orig[Ray], Dir[Ray], Vertices[Indices[i * 3]], Vertices[Indices[i * 3 + 1]], Vertices[Indices[i * 3 + 2]], BaryPosition, Distance) && Distance >= 0.0f && Distance < Brute[r])
+				Brute[r] = Distance;
+		}
+	}
+	clock_type::time_point const t5 = clock_type::now();
+
+	std::vector<glm::bvh_hit<float> > Single(Orig.size());
+	for(std::size_t i = 0; i < Orig.size(); ++i)
+	{
+		Single[i].baryPosition = glm::vec2(0);
+		Single[i].distance = std::numeric_limits<float>::max();
+		if(!Tree.intersect(Orig[i], Dir[i], Single[i].baryPosition, Single[i].distance, Single[i].triangle))
+			Single[i].triangle = glm::bvh<float>::none;
+	}
+	clock_type::time_point const t6 = clock_type::now();
+
+	std::vector<glm::bvh_hit<float> > Packet(Orig.size());
+	Tree.intersect(Orig.data(), Dir.data(), Orig.size(), Packet.data());
+	clock_type::time_point const t7 = clock_type::now();
+
+	std::printf("brute force: %.3f us per ray\n", per_ray(t4, t5, BruteCount));
+	std::printf("bvh, single rays: %.3f us per ray\n", per_ray(t5, t6, Orig.size()));
+	std::printf("bvh, packets: %.3f us per ray\n", per_ray(t6, t7, Orig.size()));
+
+	for(std::size_t r = 0; r < BruteCount; ++r)
+		Error += glm::equal(Single[r * Orig.size() / BruteCount].distance, Brute[r], 1e-3f) ? 0 : 1;
+	for(std::size_t i = 0; i < Orig.size(); ++i)
+		Error += glm::equal(Single[i].distance, Packet[i].distance, 0.0f) ? 0 : 1;
+
+	return Error;
+}
@@ -0,0 +1,102 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#define GLM_FORCE_INLINE
+#include <glm/gtx/fast_trigonometry.hpp>
+#include <glm/gtx/fast_exponential.hpp>
+#include <cmath>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+static int elapsed(clock_type::time_point t1, clock_type::time_point t2)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static float fastSin_loop(float x)
+{
+	return glm::fastSin(x);
+}
+
+static float fastCos_loop(float x)
+{
+	return glm::fastCos(x);
+}
+
+static float fastAtan_loop(float x)
+{
+	return glm::fastAtan(x);
+}
+
+static float fastExp_loop(float x)
+{
+	return glm::fastExp(x);
+}
+
+static float fastLog_loop(float x)
+{
+	return glm::fastLog(x);
+}
+
+template<typename function>
+static void perf1(char const* Name, float (*Library)(float), float (*Fast)(float), function Batch, std::vector<float> const& In, std::vector<float>& Out)
+{
+	std::size_t const Count = In.size();
+
+	clock_type::time_point const t1 = clock_type::now();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = Library(In[i]);
+	clock_type::time_point const t2 = clock_type::now();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = Fast(In[i]);
+	clock_type::time_point const t3 = clock_type::now();
+	Batch(In.data(), Out.data(), Count);
+	clock_type::time_point const t4 = clock_type::now();
+
+	std::printf("%s: %d us / %d us / %d us\n", Name, elapsed(t1, t2), elapsed(t2, t3), elapsed(t3, t4));
+}
+
+int main()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1000000;
+	std::vector<float> Angles(Count), Unit(Count), Positives(Count), X(Count), Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Angles[i] = static_cast<float>(i) * 0.0002f - 100.0f;
+		Unit[i] = static_cast<float>(i) * 0.000002f - 1.0f;
+		Positives[i] = static_cast<float>(i) * 0.01f + 0.001f;
+		X[i] = static_cast<float>(i % 7) + 1.0f;
+	}
+
+	std::printf("%d floats: C library loop / GLM_GTX_fast_* scalar loop / GLM_GTX_fast_* array\n", static_cast<int>(Count));
+
+	perf1("fastSin", std::sin, fastSin_loop, static_cast<void(*)(float const*, float*, std::size_t)>(glm::fastSin), Angles, Out);
+	Error += std::fabs(Out[Count - 1] - std::sin(Angles[Count - 1])) < 1.6e-5f ? 0 : 1;
+	perf1("fastCos", std::cos, fastCos_loop, static_cast<void(*)(float const*, float*, std::size_t)>(glm::fastCos), Angles, Out);
+	Error += std::fabs(Out[Count - 1] - std::cos(Angles[Count - 1])) < 1.6e-5f ? 0 : 1;
+	perf1("fastAtan", std::atan, fastAtan_loop, static_cast<void(*)(float const*, float*, std::size_t)>(glm::fastAtan), Unit, Out);
+	perf1("fastExp", std::exp, fastExp_loop, static_cast<void(*)(float const*, float*, std::size_t)>(glm::fastExp), Unit, Out);
+	perf1("fastLog", std::log, fastLog_loop, static_cast<void(*)(float const*, float*, std::size_t)>(glm::fastLog), Positives, Out);
+	Error += std::fabs(Out[Count - 1] - std::log(Positives[Count - 1])) < 1e-5f ? 0 : 1;
+
+	{
+		clock_type::time_point const t1 = clock_type::now();
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = std::atan(Unit[i] * X[i] / X[i]);
+		clock_type::time_point const t2 = clock_type::now();
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = glm::fastAtan(Unit[i] * X[i], X[i]);
+		clock_type::time_point const t3 = clock_type::now();
+		for(std::size_t i = 0; i < Count; ++i)
+			Positives[i] = Unit[i] * X[i];
+		clock_type::time_point const t4 = clock_type::now();
+		glm::fastAtan(Positives.data(), X.data(), Out.data(), Count);
+		clock_type::time_point const t5 = clock_type::now();
+		std::printf("fastAtan(y, x): %d us / %d us / %d us\n", elapsed(t1, t2), elapsed(t2, t3), elapsed(t4, t5));
+	}
+
+	return Error;
+}
@@ -0,0 +1,73 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#define GLM_FORCE_INLINE
+#include <glm/gtx/frustum.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+static int elapsed(clock_type::time_point t1, clock_type::time_point t2)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+int main()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1000000;
+
+	glm::vec4 Planes[6];
+	glm::frustumPlanes(glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f) * glm::lookAt(glm::vec3(0, 20, 0), glm::vec3(100, 0, 100), glm::vec3(0, 1, 0)), Planes);
+
+	// Boxes scattered over a level around the camera
+	glm::vec3_soa Min(Count);
+	glm::vec3_soa Max(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Center(
+			glm::sin(static_cast<float>(i) * 0.37f) * 1000.0f,
+			glm::sin(static_cast<float>(i) * 0.11f) * 50.0f,
+			glm::cos(static_cast<float>(i) * 0.23f) * 1000.0f);
+		glm::vec3 const Extent(1.0f + static_cast<float>(i % 7));
+		Min.store(i, Center - Extent);
+		Max.store(i, Center + Extent);
+	}
+
+	// One box at a time, visible when no plane has all of its corners outside
+	std::vector<glm::uint32> Loop(Count);
+	clock_type::time_point const t1 = clock_type::now();
+	std::size_t LoopCount = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const BoxMin = Min.load(i);
+		glm::vec3 const BoxMax = Max.load(i);
+		bool Visible = true;
+		for(int p = 0; p < 6 && Visible; ++p)
+		{
+			glm::vec3 const Corner(Planes[p].x < 0.0f ? BoxMin.x : BoxMax.x, Planes[p].y < 0.0f ? BoxMin.y : BoxMax.y, Planes[p].z < 0.0f ? BoxMin.z : BoxMax.z);
+			Visible = glm::dot(glm::vec3(Planes[p]), Corner) + Planes[p].w >= 0.0f;
+		}
+		if(Visible)
+			Loop[LoopCount++] = static_cast<glm::uint32>(i);
+	}
+	clock_type::time_point const t2 = clock_type::now();
+
+	std::vector<glm::uint32> Batch(Count);
+	std::size_t const BatchCount = glm::frustumCullBoxes(Planes, Min, Max, Batch.data());
+	clock_type::time_point const t3 = clock_type::now();
+
+	std::printf("cull %d boxes, %d visible\n", static_cast<int>(Count), static_cast<int>(BatchCount));
+	std::printf("loop: %d us\n", elapsed(t1, t2));
+	std::printf("frustumCullBoxes: %d us\n", elapsed(t2, t3));
+
+	// FMA contraction of the loop may flip boxes touching a plane
+	std::size_t const Difference = LoopCount > BatchCount ? LoopCount - BatchCount : BatchCount - LoopCount;
+	Error += Difference * 10000 > Count ? 1 : 0;
+	Error += BatchCount > 0 && BatchCount < Count ? 0 : 1;
+
+	return Error;
+}
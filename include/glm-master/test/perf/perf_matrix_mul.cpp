@@ -165,6 +165,63 @@ static int comp_mat4_mul_mat4(std::size_t Samples)
 	return Error;
 }
 
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+template <void (*Kernel)(glm_vec4 const[4], glm_vec4 const[4], glm_vec4[4])>
+static int launch_mat4_mul_kernel(std::vector<glm::aligned_mat4>& O, glm::aligned_mat4 const& Transform, std::vector<glm::aligned_mat4> const& I)
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	// Small inputs processed several times so that we time the kernel rather than the memory
+	for (std::size_t r = 0; r < 100; ++r)
+	{
+		for (std::size_t i = 0, n = I.size(); i < n; ++i)
+			Kernel(&Transform[0].data, &I[i][0].data, &O[i][0].data);
+	}
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+// Compares the glm_mat4_mul implementations available with the current GLM_ARCH against the SSE2 one
+static int comp_mat4_mul_kernels(std::size_t Samples)
+{
+	int Error = 0;
+
+	glm::aligned_mat4 const Transform(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+	glm::aligned_mat4 const Scale(0.01, 0.02, 0.03, 0.05, 0.01, 0.02, 0.03, 0.05, 0.01, 0.02, 0.03, 0.05, 0.01, 0.02, 0.03, 0.05);
+
+	std::vector<glm::aligned_mat4> I(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = Scale * static_cast<float>(i);
+
+	std::vector<glm::aligned_mat4> SSE2;
+	std::printf("- SSE2: %d us\n", launch_mat4_mul_kernel<glm_mat4_mul_sse2>(SSE2, Transform, I));
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	{
+		std::vector<glm::aligned_mat4> AVX;
+		std::printf("- AVX: %d us\n", launch_mat4_mul_kernel<glm_mat4_mul_avx>(AVX, Transform, I));
+
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += percent_error(SSE2[i], AVX[i], 0.01f) ? 0 : 1;
+	}
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	{
+		std::vector<glm::aligned_mat4> AVX512;
+		std::printf("- AVX512: %d us\n", launch_mat4_mul_kernel<glm_mat4_mul_avx512>(AVX512, Transform, I));
+
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += percent_error(SSE2[i], AVX512[i], 0.01f) ? 0 : 1;
+	}
+#	endif
+
+	return Error;
+}
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
 int main()
 {
 	std::size_t const Samples = 1000;
@@ -189,6 +246,11 @@ int main()
 	std::printf("dmat4 * dmat4:\n");
 	Error += comp_mat4_mul_mat4<glm::dmat4, glm::aligned_dmat4>(Samples);
 
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		std::printf("glm_mat4_mul:\n");
+		Error += comp_mat4_mul_kernels(Samples);
+#	endif
+
 	return Error;
 }
 
@@ -0,0 +1,90 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#define GLM_FORCE_INLINE
+#include <glm/gtx/noise_batch.hpp>
+#include <glm/gtc/noise.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+static int elapsed(clock_type::time_point t1, clock_type::time_point t2)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template<glm::length_t L>
+static int comp_grid(char const* Name, float (*Noise)(glm::vec<L, float> const&), void (*Grid)(glm::vec<L, float> const&, glm::vec<L, float> const&, glm::vec<L, int> const&, float*, int, float, float, unsigned), glm::vec<L, int> const& Size)
+{
+	int Error = 0;
+
+	glm::vec<L, float> const Origin(-10.0f);
+	glm::vec<L, float> const Step(0.01f);
+	int const Octaves = 4;
+
+	std::size_t Count = 1;
+	for(glm::length_t c = 0; c < L; ++c)
+		Count *= static_cast<std::size_t>(Size[c]);
+
+	std::vector<float> Loop(Count);
+	std::vector<float> Batch(Count);
+	std::vector<float> Threaded(Count);
+
+	clock_type::time_point const t1 = clock_type::now();
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec<L, float> Position;
+		std::size_t Coordinate = i;
+		for(glm::length_t c = 0; c < L; ++c)
+		{
+			Position[c] = Origin[c] + static_cast<float>(Coordinate % static_cast<std::size_t>(Size[c])) * Step[c];
+			Coordinate /= static_cast<std::size_t>(Size[c]);
+		}
+
+		float Frequency = 1.0f;
+		float Amplitude = 1.0f;
+		float Sum = 0.0f;
+		for(int o = 0; o < Octaves; ++o)
+		{
+			Sum += Amplitude * Noise(Position * Frequency);
+			Frequency *= 2.0f;
+			Amplitude *= 0.5f;
+		}
+		Loop[i] = Sum;
+	}
+	clock_type::time_point const t2 = clock_type::now();
+
+	Grid(Origin, Step, Size, Batch.data(), Octaves, 2.0f, 0.5f, 1);
+	clock_type::time_point const t3 = clock_type::now();
+
+	Grid(Origin, Step, Size, Threaded.data(), Octaves, 2.0f, 0.5f, 0);
+	clock_type::time_point const t4 = clock_type::now();
+
+	std::printf("%s loop: %d us\n", Name, elapsed(t1, t2));
+	std::printf("%s grid: %d us\n", Name, elapsed(t2, t3));
+	std::printf("%s grid, all threads: %d us\n", Name, elapsed(t3, t4));
+
+	// FMA contraction of the scalar loop may change the gradients of a few points
+	std::size_t Mismatches = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Mismatches += glm::equal(Loop[i], Batch[i], 1e-4f) ? 0 : 1;
+		Error += glm::equal(Batch[i], Threaded[i], 0.0f) ? 0 : 1;
+	}
+	Error += Mismatches * 10 > Count ? 1 : 0;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += comp_grid<2>("perlin 2D", glm::perlin, glm::perlinGrid, glm::ivec2(1024, 512));
+	Error += comp_grid<3>("perlin 3D", glm::perlin, glm::perlinGrid, glm::ivec3(64, 64, 32));
+	Error += comp_grid<2>("simplex 2D", glm::simplex, glm::simplexGrid, glm::ivec2(1024, 512));
+	Error += comp_grid<3>("simplex 3D", glm::simplex, glm::simplexGrid, glm::ivec3(64, 64, 32));
+
+	return Error;
+}
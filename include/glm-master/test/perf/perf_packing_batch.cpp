@@ -0,0 +1,120 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#define GLM_FORCE_INLINE
+#include <glm/gtx/packing_batch.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+static int elapsed(clock_type::time_point t1, clock_type::time_point t2)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int comp_half(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<float> In(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		In[i] = glm::sin(static_cast<float>(i)) * 1000.0f;
+
+	std::vector<glm::uint16> Loop(Samples);
+	std::vector<glm::uint16> Batch(Samples);
+	std::vector<float> UnpackLoop(Samples);
+	std::vector<float> UnpackBatch(Samples);
+
+	clock_type::time_point const t1 = clock_type::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Loop[i] = glm::packHalf1x16(In[i]);
+	clock_type::time_point const t2 = clock_type::now();
+
+	glm::packHalf(In.data(), Batch.data(), Samples);
+	clock_type::time_point const t3 = clock_type::now();
+
+	std::printf("packHalf1x16 loop: %d us\n", elapsed(t1, t2));
+	std::printf("packHalf: %d us\n", elapsed(t2, t3));
+
+	// The batch rounds ties to even: allow one unit in the last place
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += (Loop[i] > Batch[i] ? Loop[i] - Batch[i] : Batch[i] - Loop[i]) <= 1 ? 0 : 1;
+
+	clock_type::time_point const t4 = clock_type::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		UnpackLoop[i] = glm::unpackHalf1x16(Batch[i]);
+	clock_type::time_point const t5 = clock_type::now();
+
+	glm::unpackHalf(Batch.data(), UnpackBatch.data(), Samples);
+	clock_type::time_point const t6 = clock_type::now();
+
+	std::printf("unpackHalf1x16 loop: %d us\n", elapsed(t4, t5));
+	std::printf("unpackHalf: %d us\n", elapsed(t5, t6));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::equal(UnpackLoop[i], UnpackBatch[i], 0.0f) ? 0 : 1;
+
+	return Error;
+}
+
+template<glm::uint32 (*Pack)(glm::vec4 const&), glm::vec4 (*Unpack)(glm::uint32)>
+static int comp_pack(char const* Name, void (*PackBatch)(glm::vec4 const*, glm::uint32*, std::size_t), void (*UnpackBatch)(glm::uint32 const*, glm::vec4*, std::size_t), std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::vec4> In(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		In[i] = glm::vec4(glm::sin(static_cast<float>(i)), glm::cos(static_cast<float>(i)), 0.5f, -0.25f);
+
+	std::vector<glm::uint32> Loop(Samples);
+	std::vector<glm::uint32> Batch(Samples);
+	std::vector<glm::vec4> UnpackLoop(Samples);
+	std::vector<glm::vec4> Unpacked(Samples);
+
+	clock_type::time_point const t1 = clock_type::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Loop[i] = Pack(In[i]);
+	clock_type::time_point const t2 = clock_type::now();
+
+	PackBatch(In.data(), Batch.data(), Samples);
+	clock_type::time_point const t3 = clock_type::now();
+
+	std::printf("pack%s loop: %d us\n", Name, elapsed(t1, t2));
+	std::printf("pack%s batch: %d us\n", Name, elapsed(t2, t3));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += Loop[i] == Batch[i] ? 0 : 1;
+
+	clock_type::time_point const t4 = clock_type::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		UnpackLoop[i] = Unpack(Batch[i]);
+	clock_type::time_point const t5 = clock_type::now();
+
+	UnpackBatch(Batch.data(), Unpacked.data(), Samples);
+	clock_type::time_point const t6 = clock_type::now();
+
+	std::printf("unpack%s loop: %d us\n", Name, elapsed(t4, t5));
+	std::printf("unpack%s batch: %d us\n", Name, elapsed(t5, t6));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(UnpackLoop[i], Unpacked[i], 0.0f)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	std::size_t const Samples = 4000000;
+
+	int Error = 0;
+
+	Error += comp_half(Samples);
+	Error += comp_pack<glm::packUnorm4x8, glm::unpackUnorm4x8>("Unorm4x8", glm::packUnorm4x8, glm::unpackUnorm4x8, Samples / 4);
+	Error += comp_pack<glm::packSnorm4x8, glm::unpackSnorm4x8>("Snorm4x8", glm::packSnorm4x8, glm::unpackSnorm4x8, Samples / 4);
+	Error += comp_pack<glm::packUnorm3x10_1x2, glm::unpackUnorm3x10_1x2>("Unorm3x10_1x2", glm::packUnorm3x10_1x2, glm::unpackUnorm3x10_1x2, Samples / 4);
+	Error += comp_pack<glm::packSnorm3x10_1x2, glm::unpackSnorm3x10_1x2>("Snorm3x10_1x2", glm::packSnorm3x10_1x2, glm::unpackSnorm3x10_1x2, Samples / 4);
+
+	return Error;
+}
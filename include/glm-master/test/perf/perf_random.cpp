@@ -0,0 +1,83 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#define GLM_FORCE_INLINE
+#include <glm/gtx/random.hpp>
+#include <glm/gtc/random.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+static int elapsed(clock_type::time_point t1, clock_type::time_point t2)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+int main()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1000000;
+	std::vector<glm::vec3> Points3(Count, glm::vec3(0));
+	std::vector<glm::vec2> Points2(Count, glm::vec2(0));
+	glm::random_engine Engine(1);
+
+	std::printf("%d samples: GLM_GTC_random loop / GLM_GTX_random\n", static_cast<int>(Count));
+
+	{
+		clock_type::time_point const t1 = clock_type::now();
+		for(std::size_t i = 0; i < Count; ++i)
+			Points3[i] = glm::linearRand(glm::vec3(-1), glm::vec3(1));
+		clock_type::time_point const t2 = clock_type::now();
+		glm::linearRand(Engine, glm::vec3(-1), glm::vec3(1), &Points3[0], Count);
+		clock_type::time_point const t3 = clock_type::now();
+		std::printf("linearRand vec3: %d us / %d us\n", elapsed(t1, t2), elapsed(t2, t3));
+		Error += glm::all(glm::lessThanEqual(glm::abs(Points3[Count - 1]), glm::vec3(1))) ? 0 : 1;
+	}
+
+	{
+		clock_type::time_point const t1 = clock_type::now();
+		for(std::size_t i = 0; i < Count; ++i)
+			Points3[i] = glm::gaussRand(glm::vec3(0), glm::vec3(1));
+		clock_type::time_point const t2 = clock_type::now();
+		glm::gaussRand(Engine, glm::vec3(0), glm::vec3(1), &Points3[0], Count);
+		clock_type::time_point const t3 = clock_type::now();
+		std::printf("gaussRand vec3: %d us / %d us\n", elapsed(t1, t2), elapsed(t2, t3));
+	}
+
+	{
+		clock_type::time_point const t1 = clock_type::now();
+		for(std::size_t i = 0; i < Count; ++i)
+			Points2[i] = glm::diskRand(1.0f);
+		clock_type::time_point const t2 = clock_type::now();
+		glm::diskRand(Engine, 1.0f, &Points2[0], Count);
+		clock_type::time_point const t3 = clock_type::now();
+		std::printf("diskRand: %d us / %d us\n", elapsed(t1, t2), elapsed(t2, t3));
+		Error += glm::length(Points2[Count - 1]) <= 1.0f ? 0 : 1;
+	}
+
+	{
+		clock_type::time_point const t1 = clock_type::now();
+		for(std::size_t i = 0; i < Count; ++i)
+			Points3[i] = glm::sphericalRand(1.0f);
+		clock_type::time_point const t2 = clock_type::now();
+		glm::sphericalRand(Engine, 1.0f, &Points3[0], Count);
+		clock_type::time_point const t3 = clock_type::now();
+		std::printf("sphericalRand: %d us / %d us\n", elapsed(t1, t2), elapsed(t2, t3));
+		Error += glm::abs(glm::length(Points3[Count - 1]) - 1.0f) < 1e-4f ? 0 : 1;
+	}
+
+	{
+		std::vector<float> Values(Count, 0.0f);
+		clock_type::time_point const t1 = clock_type::now();
+		for(std::size_t i = 0; i < Count; ++i)
+			Values[i] = glm::linearRand(0.0f, 1.0f);
+		clock_type::time_point const t2 = clock_type::now();
+		Engine.generate(&Values[0], Count);
+		clock_type::time_point const t3 = clock_type::now();
+		std::printf("float in [0, 1): %d us / %d us\n", elapsed(t1, t2), elapsed(t2, t3));
+		Error += Values[Count - 1] >= 0.0f && Values[Count - 1] < 1.0f ? 0 : 1;
+	}
+
+	return Error;
+}
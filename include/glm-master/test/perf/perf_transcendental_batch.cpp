@@ -0,0 +1,102 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#define GLM_FORCE_INLINE
+#include <glm/gtx/transcendental_batch.hpp>
+#include <cmath>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+static int elapsed(clock_type::time_point t1, clock_type::time_point t2)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static float log2_loop(float x)
+{
+	return std::log2(x);
+}
+
+static float exp2_loop(float x)
+{
+	return std::exp2(x);
+}
+
+template<typename function>
+static void perf1(char const* Name, float (*Loop)(float), function Batch, std::vector<float> const& In, std::vector<float>& Out)
+{
+	std::size_t const Count = In.size();
+
+	clock_type::time_point const t1 = clock_type::now();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = Loop(In[i]);
+	clock_type::time_point const t2 = clock_type::now();
+	Batch(In.data(), Out.data(), Count);
+	clock_type::time_point const t3 = clock_type::now();
+
+	std::printf("%s: %d us / %d us\n", Name, elapsed(t1, t2), elapsed(t2, t3));
+}
+
+int main()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1000000;
+	std::vector<float> Angles(Count), Positives(Count), Exponents(Count), Out(Count), Out2(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Angles[i] = static_cast<float>(i) * 0.001f - 500.0f;
+		Positives[i] = static_cast<float>(i) * 0.01f + 0.001f;
+		Exponents[i] = static_cast<float>(i) * 0.00005f - 25.0f;
+	}
+
+	std::printf("%d floats: C library loop / GLM_GTX_transcendental_batch\n", static_cast<int>(Count));
+
+	perf1("sin", std::sin, static_cast<void(*)(float const*, float*, std::size_t)>(glm::sin), Angles, Out);
+	perf1("cos", std::cos, static_cast<void(*)(float const*, float*, std::size_t)>(glm::cos), Angles, Out);
+	perf1("tan", std::tan, static_cast<void(*)(float const*, float*, std::size_t)>(glm::tan), Angles, Out);
+	perf1("exp", std::exp, static_cast<void(*)(float const*, float*, std::size_t)>(glm::exp), Exponents, Out);
+	perf1("exp2", exp2_loop, static_cast<void(*)(float const*, float*, std::size_t)>(glm::exp2), Exponents, Out);
+	perf1("log", std::log, static_cast<void(*)(float const*, float*, std::size_t)>(glm::log), Positives, Out);
+	perf1("log2", log2_loop, static_cast<void(*)(float const*, float*, std::size_t)>(glm::log2), Positives, Out);
+	Error += std::fabs(Out[Count - 1] - std::log2(Positives[Count - 1])) < 1e-5f ? 0 : 1;
+
+	{
+		clock_type::time_point const t1 = clock_type::now();
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Out[i] = std::sin(Angles[i]);
+			Out2[i] = std::cos(Angles[i]);
+		}
+		clock_type::time_point const t2 = clock_type::now();
+		glm::sincos(Angles.data(), Out.data(), Out2.data(), Count);
+		clock_type::time_point const t3 = clock_type::now();
+		std::printf("sincos: %d us / %d us\n", elapsed(t1, t2), elapsed(t2, t3));
+		Error += std::fabs(Out[Count - 1] * Out[Count - 1] + Out2[Count - 1] * Out2[Count - 1] - 1.0f) < 1e-5f ? 0 : 1;
+	}
+
+	{
+		clock_type::time_point const t1 = clock_type::now();
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = std::atan2(Angles[i], Exponents[i]);
+		clock_type::time_point const t2 = clock_type::now();
+		glm::atan(Angles.data(), Exponents.data(), Out.data(), Count);
+		clock_type::time_point const t3 = clock_type::now();
+		std::printf("atan2: %d us / %d us\n", elapsed(t1, t2), elapsed(t2, t3));
+	}
+
+	{
+		clock_type::time_point const t1 = clock_type::now();
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = std::pow(Positives[i], Exponents[i]);
+		clock_type::time_point const t2 = clock_type::now();
+		glm::pow(Positives.data(), Exponents.data(), Out.data(), Count);
+		clock_type::time_point const t3 = clock_type::now();
+		std::printf("pow: %d us / %d us\n", elapsed(t1, t2), elapsed(t2, t3));
+		std::size_t const i = Count / 2 + 1000;
+		Error += std::fabs(Out[i] - std::pow(Positives[i], Exponents[i])) <= 1e-5f * std::pow(Positives[i], Exponents[i]) ? 0 : 1;
+	}
+
+	return Error;
+}
@@ -0,0 +1,79 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#define GLM_FORCE_INLINE
+#include <glm/gtx/transform_batch.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/common.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+template <typename matType, typename vecType>
+static void test_mat_mul_vec(matType const& M, std::vector<vecType> const& I, std::vector<vecType>& O)
+{
+	for (std::size_t i = 0, n = I.size(); i < n; ++i)
+		O[i] = M * I[i];
+}
+
+template <typename matType, typename vecType>
+static void test_transform_batch(matType const& M, std::vector<vecType> const& I, std::vector<vecType>& O)
+{
+	glm::transform_batch(M, I.data(), O.data(), I.size());
+}
+
+template <typename matType, typename vecType>
+static int launch(void (*Test)(matType const&, std::vector<vecType> const&, std::vector<vecType>&), std::vector<vecType>& O, matType const& Transform, vecType const& Scale, std::size_t Samples)
+{
+	typedef typename matType::value_type T;
+
+	std::vector<vecType> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = Scale * static_cast<T>(i);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	Test(Transform, I, O);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename matType, typename vecType>
+static int comp_transform_batch(std::size_t Samples)
+{
+	typedef typename matType::value_type T;
+
+	int Error = 0;
+
+	matType const Transform(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+	vecType const Scale(0.01, 0.02, 0.03, 0.05);
+
+	std::vector<vecType> Loop;
+	std::printf("- M * v loop: %d us\n", launch<matType, vecType>(test_mat_mul_vec<matType, vecType>, Loop, Transform, Scale, Samples));
+
+	std::vector<vecType> Batch;
+	std::printf("- transform_batch: %d us\n", launch<matType, vecType>(test_transform_batch<matType, vecType>, Batch, Transform, Scale, Samples));
+
+	// Relative tolerance: the batch may use FMA while the loop doesn't
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(Loop[i], Batch[i], glm::abs(Loop[i]) * static_cast<T>(0.00001) + static_cast<T>(0.001))) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	std::size_t const Samples = 1000000;
+
+	int Error = 0;
+
+	std::printf("mat4 * vec4[%d]:\n", static_cast<int>(Samples));
+	Error += comp_transform_batch<glm::mat4, glm::vec4>(Samples);
+
+	std::printf("dmat4 * dvec4[%d]:\n", static_cast<int>(Samples));
+	Error += comp_transform_batch<glm::dmat4, glm::dvec4>(Samples);
+
+	return Error;
+}
@@ -0,0 +1,15 @@
+#version 410 core
+
+layout(location=0)in vec3 position;
+layout(location=1)in vec3 vertexColors;
+layout(location=2)in mat4 instanceTransform; // per instance, see BatchRenderer.hpp
+
+uniform mat4 u_ViewProjection;
+
+out vec3 v_vertexColors;
+
+void main()
+{
+   v_vertexColors = vertexColors;
+   gl_Position = u_ViewProjection * instanceTransform * vec4(position, 1.0f);
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#version 410 core
+
+layout(location=0)in vec3 position;
+layout(location=1)in vec3 vertexColors;
+
+uniform mat4 u_ViewProjection;
+uniform mat4 u_Model; // per draw, see RenderQueue.hpp
+
+out vec3 v_vertexColors;
+
+void main()
+{
+   v_vertexColors = vertexColors;
+   gl_Position = u_ViewProjection * u_Model * vec4(position, 1.0f);
+}
\ No newline at end of file
@@ -783,94 +783,131 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
+/* The extension names, one after the other, each NUL terminated, in a single
+ * allocation. */
+static char *exts_arena = NULL;
+static size_t exts_arena_size = 0;
+static size_t exts_arena_capacity = 0;
+static unsigned exts_count = 0;
 
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        unsigned int index;
+/* Open addressing hash set of the names: each slot holds the offset of a name
+ * in exts_arena plus one, or 0 if it is empty. Its size is a power of two, at
+ * least twice the number of names, so probe sequences stay short. */
+static unsigned *exts_hash = NULL;
+static unsigned exts_hash_mask = 0;
 
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
-        }
+/* FNV-1a over the first len characters of name */
+static unsigned hash_ext(const char *name, size_t len) {
+    unsigned hash = 2166136261u;
+    size_t i;
+    for(i = 0; i < len; i++) {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
 
-        if (exts_i == NULL) {
-            return 0;
-        }
+static int append_ext(const char *name, size_t len) {
+    if(exts_arena_size + len + 1 > exts_arena_capacity) {
+        size_t capacity = exts_arena_capacity != 0 ? exts_arena_capacity : 4096;
+        char *arena;
+        while(exts_arena_size + len + 1 > capacity) capacity *= 2;
+        arena = (char *)realloc(exts_arena, capacity);
+        if(arena == NULL) return 0;
+        exts_arena = arena;
+        exts_arena_capacity = capacity;
+    }
+    memcpy(exts_arena + exts_arena_size, name, len);
+    exts_arena[exts_arena_size + len] = '\0';
+    exts_arena_size += len + 1;
+    exts_count++;
+    return 1;
+}
 
-        for(index = 0; index < (unsigned)num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
+static int build_exts_hash(void) {
+    unsigned size = 16;
+    size_t offset;
+    while(size < exts_count * 2) size *= 2;
 
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
-        }
+    exts_hash = (unsigned *)calloc(size, sizeof *exts_hash);
+    if(exts_hash == NULL) return 0;
+    exts_hash_mask = size - 1;
+
+    for(offset = 0; offset < exts_arena_size; ) {
+        const char *name = exts_arena + offset;
+        const size_t len = strlen(name);
+        unsigned slot = hash_ext(name, len) & exts_hash_mask;
+        while(exts_hash[slot] != 0) slot = (slot + 1) & exts_hash_mask;
+        exts_hash[slot] = (unsigned)offset + 1;
+        offset += len + 1;
     }
-#endif
     return 1;
 }
 
 static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
-    }
+    free(exts_arena);
+    free(exts_hash);
+    exts_arena = NULL;
+    exts_arena_size = 0;
+    exts_arena_capacity = 0;
+    exts_count = 0;
+    exts_hash = NULL;
+    exts_hash_mask = 0;
 }
 
-static int has_ext(const char *ext) {
+static int get_exts(void) {
+    free_exts();
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
-        }
-
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
+        /* One string, names separated by spaces */
+        const char *exts = (const char *)glGetString(GL_EXTENSIONS);
+        while(exts != NULL && *exts != '\0') {
+            const char *end = strchr(exts, ' ');
+            const size_t len = end != NULL ? (size_t)(end - exts) : strlen(exts);
+            if(len != 0 && !append_ext(exts, len)) {
+                free_exts();
                 return 0;
             }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
+            exts = end != NULL ? end + 1 : exts + len;
         }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
+        int num_exts_i = 0;
         int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
 
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
+        for(index = 0; index < num_exts_i; index++) {
+            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, (GLuint)index);
+            if(gl_str_tmp != NULL && !append_ext(gl_str_tmp, strlen(gl_str_tmp))) {
+                free_exts();
+                return 0;
             }
         }
     }
 #endif
 
+    if(!build_exts_hash()) {
+        free_exts();
+        return 0;
+    }
+    return 1;
+}
+
+static int has_ext(const char *ext) {
+    size_t len;
+    unsigned slot;
+    if(exts_hash == NULL || ext == NULL) {
+        return 0;
+    }
+
+    len = strlen(ext);
+    for(slot = hash_ext(ext, len) & exts_hash_mask; exts_hash[slot] != 0; slot = (slot + 1) & exts_hash_mask) {
+        if(strcmp(exts_arena + exts_hash[slot] - 1, ext) == 0) {
+            return 1;
+        }
+    }
+
     return 0;
 }
 int GLAD_GL_VERSION_1_0 = 0;
@@ -9891,3 +9928,707 @@ int gladLoadGLLoader(GLADloadproc load) {
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+/* Scoped loading: only the core versions and the extensions the application
+ * asks for. See gladLoadGLLoaderScoped in glad.h. */
+struct gladGLversionEntry {
+	int major, minor;
+	int *flag;
+	void (*load)(GLADloadproc);
+};
+
+static const struct gladGLversionEntry glad_gl_versions[] = {
+	{ 1, 0, &GLAD_GL_VERSION_1_0, load_GL_VERSION_1_0 },
+	{ 1, 1, &GLAD_GL_VERSION_1_1, load_GL_VERSION_1_1 },
+	{ 1, 2, &GLAD_GL_VERSION_1_2, load_GL_VERSION_1_2 },
+	{ 1, 3, &GLAD_GL_VERSION_1_3, load_GL_VERSION_1_3 },
+	{ 1, 4, &GLAD_GL_VERSION_1_4, load_GL_VERSION_1_4 },
+	{ 1, 5, &GLAD_GL_VERSION_1_5, load_GL_VERSION_1_5 },
+	{ 2, 0, &GLAD_GL_VERSION_2_0, load_GL_VERSION_2_0 },
+	{ 2, 1, &GLAD_GL_VERSION_2_1, load_GL_VERSION_2_1 },
+	{ 3, 0, &GLAD_GL_VERSION_3_0, load_GL_VERSION_3_0 },
+	{ 3, 1, &GLAD_GL_VERSION_3_1, load_GL_VERSION_3_1 },
+	{ 3, 2, &GLAD_GL_VERSION_3_2, load_GL_VERSION_3_2 },
+	{ 3, 3, &GLAD_GL_VERSION_3_3, load_GL_VERSION_3_3 },
+	{ 4, 0, &GLAD_GL_VERSION_4_0, load_GL_VERSION_4_0 },
+	{ 4, 1, &GLAD_GL_VERSION_4_1, load_GL_VERSION_4_1 },
+};
+
+struct gladGLextensionEntry {
+	const char *name;
+	int *flag;
+	void (*load)(GLADloadproc); /* NULL if the extension has no functions */
+};
+
+/* Sorted by name (strcmp order) for the binary search in find_extension */
+static const struct gladGLextensionEntry glad_gl_extensions[] = {
+	{ "GL_3DFX_multisample", &GLAD_GL_3DFX_multisample, NULL },
+	{ "GL_3DFX_tbuffer", &GLAD_GL_3DFX_tbuffer, load_GL_3DFX_tbuffer },
+	{ "GL_3DFX_texture_compression_FXT1", &GLAD_GL_3DFX_texture_compression_FXT1, NULL },
+	{ "GL_AMD_blend_minmax_factor", &GLAD_GL_AMD_blend_minmax_factor, NULL },
+	{ "GL_AMD_conservative_depth", &GLAD_GL_AMD_conservative_depth, NULL },
+	{ "GL_AMD_debug_output", &GLAD_GL_AMD_debug_output, load_GL_AMD_debug_output },
+	{ "GL_AMD_depth_clamp_separate", &GLAD_GL_AMD_depth_clamp_separate, NULL },
+	{ "GL_AMD_draw_buffers_blend", &GLAD_GL_AMD_draw_buffers_blend, load_GL_AMD_draw_buffers_blend },
+	{ "GL_AMD_framebuffer_multisample_advanced", &GLAD_GL_AMD_framebuffer_multisample_advanced, load_GL_AMD_framebuffer_multisample_advanced },
+	{ "GL_AMD_framebuffer_sample_positions", &GLAD_GL_AMD_framebuffer_sample_positions, load_GL_AMD_framebuffer_sample_positions },
+	{ "GL_AMD_gcn_shader", &GLAD_GL_AMD_gcn_shader, NULL },
+	{ "GL_AMD_gpu_shader_half_float", &GLAD_GL_AMD_gpu_shader_half_float, NULL },
+	{ "GL_AMD_gpu_shader_int16", &GLAD_GL_AMD_gpu_shader_int16, NULL },
+	{ "GL_AMD_gpu_shader_int64", &GLAD_GL_AMD_gpu_shader_int64, load_GL_AMD_gpu_shader_int64 },
+	{ "GL_AMD_interleaved_elements", &GLAD_GL_AMD_interleaved_elements, load_GL_AMD_interleaved_elements },
+	{ "GL_AMD_multi_draw_indirect", &GLAD_GL_AMD_multi_draw_indirect, load_GL_AMD_multi_draw_indirect },
+	{ "GL_AMD_name_gen_delete", &GLAD_GL_AMD_name_gen_delete, load_GL_AMD_name_gen_delete },
+	{ "GL_AMD_occlusion_query_event", &GLAD_GL_AMD_occlusion_query_event, load_GL_AMD_occlusion_query_event },
+	{ "GL_AMD_performance_monitor", &GLAD_GL_AMD_performance_monitor, load_GL_AMD_performance_monitor },
+	{ "GL_AMD_pinned_memory", &GLAD_GL_AMD_pinned_memory, NULL },
+	{ "GL_AMD_query_buffer_object", &GLAD_GL_AMD_query_buffer_object, NULL },
+	{ "GL_AMD_sample_positions", &GLAD_GL_AMD_sample_positions, load_GL_AMD_sample_positions },
+	{ "GL_AMD_seamless_cubemap_per_texture", &GLAD_GL_AMD_seamless_cubemap_per_texture, NULL },
+	{ "GL_AMD_shader_atomic_counter_ops", &GLAD_GL_AMD_shader_atomic_counter_ops, NULL },
+	{ "GL_AMD_shader_ballot", &GLAD_GL_AMD_shader_ballot, NULL },
+	{ "GL_AMD_shader_explicit_vertex_parameter", &GLAD_GL_AMD_shader_explicit_vertex_parameter, NULL },
+	{ "GL_AMD_shader_gpu_shader_half_float_fetch", &GLAD_GL_AMD_shader_gpu_shader_half_float_fetch, NULL },
+	{ "GL_AMD_shader_image_load_store_lod", &GLAD_GL_AMD_shader_image_load_store_lod, NULL },
+	{ "GL_AMD_shader_stencil_export", &GLAD_GL_AMD_shader_stencil_export, NULL },
+	{ "GL_AMD_shader_trinary_minmax", &GLAD_GL_AMD_shader_trinary_minmax, NULL },
+	{ "GL_AMD_sparse_texture", &GLAD_GL_AMD_sparse_texture, load_GL_AMD_sparse_texture },
+	{ "GL_AMD_stencil_operation_extended", &GLAD_GL_AMD_stencil_operation_extended, load_GL_AMD_stencil_operation_extended },
+	{ "GL_AMD_texture_gather_bias_lod", &GLAD_GL_AMD_texture_gather_bias_lod, NULL },
+	{ "GL_AMD_texture_texture4", &GLAD_GL_AMD_texture_texture4, NULL },
+	{ "GL_AMD_transform_feedback3_lines_triangles", &GLAD_GL_AMD_transform_feedback3_lines_triangles, NULL },
+	{ "GL_AMD_transform_feedback4", &GLAD_GL_AMD_transform_feedback4, NULL },
+	{ "GL_AMD_vertex_shader_layer", &GLAD_GL_AMD_vertex_shader_layer, NULL },
+	{ "GL_AMD_vertex_shader_tessellator", &GLAD_GL_AMD_vertex_shader_tessellator, load_GL_AMD_vertex_shader_tessellator },
+	{ "GL_AMD_vertex_shader_viewport_index", &GLAD_GL_AMD_vertex_shader_viewport_index, NULL },
+	{ "GL_APPLE_aux_depth_stencil", &GLAD_GL_APPLE_aux_depth_stencil, NULL },
+	{ "GL_APPLE_client_storage", &GLAD_GL_APPLE_client_storage, NULL },
+	{ "GL_APPLE_element_array", &GLAD_GL_APPLE_element_array, load_GL_APPLE_element_array },
+	{ "GL_APPLE_fence", &GLAD_GL_APPLE_fence, load_GL_APPLE_fence },
+	{ "GL_APPLE_float_pixels", &GLAD_GL_APPLE_float_pixels, NULL },
+	{ "GL_APPLE_flush_buffer_range", &GLAD_GL_APPLE_flush_buffer_range, load_GL_APPLE_flush_buffer_range },
+	{ "GL_APPLE_object_purgeable", &GLAD_GL_APPLE_object_purgeable, load_GL_APPLE_object_purgeable },
+	{ "GL_APPLE_rgb_422", &GLAD_GL_APPLE_rgb_422, NULL },
+	{ "GL_APPLE_row_bytes", &GLAD_GL_APPLE_row_bytes, NULL },
+	{ "GL_APPLE_specular_vector", &GLAD_GL_APPLE_specular_vector, NULL },
+	{ "GL_APPLE_texture_range", &GLAD_GL_APPLE_texture_range, load_GL_APPLE_texture_range },
+	{ "GL_APPLE_transform_hint", &GLAD_GL_APPLE_transform_hint, NULL },
+	{ "GL_APPLE_vertex_array_object", &GLAD_GL_APPLE_vertex_array_object, load_GL_APPLE_vertex_array_object },
+	{ "GL_APPLE_vertex_array_range", &GLAD_GL_APPLE_vertex_array_range, load_GL_APPLE_vertex_array_range },
+	{ "GL_APPLE_vertex_program_evaluators", &GLAD_GL_APPLE_vertex_program_evaluators, load_GL_APPLE_vertex_program_evaluators },
+	{ "GL_APPLE_ycbcr_422", &GLAD_GL_APPLE_ycbcr_422, NULL },
+	{ "GL_ARB_ES2_compatibility", &GLAD_GL_ARB_ES2_compatibility, load_GL_ARB_ES2_compatibility },
+	{ "GL_ARB_ES3_1_compatibility", &GLAD_GL_ARB_ES3_1_compatibility, load_GL_ARB_ES3_1_compatibility },
+	{ "GL_ARB_ES3_2_compatibility", &GLAD_GL_ARB_ES3_2_compatibility, load_GL_ARB_ES3_2_compatibility },
+	{ "GL_ARB_ES3_compatibility", &GLAD_GL_ARB_ES3_compatibility, NULL },
+	{ "GL_ARB_arrays_of_arrays", &GLAD_GL_ARB_arrays_of_arrays, NULL },
+	{ "GL_ARB_base_instance", &GLAD_GL_ARB_base_instance, load_GL_ARB_base_instance },
+	{ "GL_ARB_bindless_texture", &GLAD_GL_ARB_bindless_texture, load_GL_ARB_bindless_texture },
+	{ "GL_ARB_blend_func_extended", &GLAD_GL_ARB_blend_func_extended, load_GL_ARB_blend_func_extended },
+	{ "GL_ARB_buffer_storage", &GLAD_GL_ARB_buffer_storage, load_GL_ARB_buffer_storage },
+	{ "GL_ARB_cl_event", &GLAD_GL_ARB_cl_event, load_GL_ARB_cl_event },
+	{ "GL_ARB_clear_buffer_object", &GLAD_GL_ARB_clear_buffer_object, load_GL_ARB_clear_buffer_object },
+	{ "GL_ARB_clear_texture", &GLAD_GL_ARB_clear_texture, load_GL_ARB_clear_texture },
+	{ "GL_ARB_clip_control", &GLAD_GL_ARB_clip_control, load_GL_ARB_clip_control },
+	{ "GL_ARB_color_buffer_float", &GLAD_GL_ARB_color_buffer_float, load_GL_ARB_color_buffer_float },
+	{ "GL_ARB_compatibility", &GLAD_GL_ARB_compatibility, NULL },
+	{ "GL_ARB_compressed_texture_pixel_storage", &GLAD_GL_ARB_compressed_texture_pixel_storage, NULL },
+	{ "GL_ARB_compute_shader", &GLAD_GL_ARB_compute_shader, load_GL_ARB_compute_shader },
+	{ "GL_ARB_compute_variable_group_size", &GLAD_GL_ARB_compute_variable_group_size, load_GL_ARB_compute_variable_group_size },
+	{ "GL_ARB_conditional_render_inverted", &GLAD_GL_ARB_conditional_render_inverted, NULL },
+	{ "GL_ARB_conservative_depth", &GLAD_GL_ARB_conservative_depth, NULL },
+	{ "GL_ARB_copy_buffer", &GLAD_GL_ARB_copy_buffer, load_GL_ARB_copy_buffer },
+	{ "GL_ARB_copy_image", &GLAD_GL_ARB_copy_image, load_GL_ARB_copy_image },
+	{ "GL_ARB_cull_distance", &GLAD_GL_ARB_cull_distance, NULL },
+	{ "GL_ARB_debug_output", &GLAD_GL_ARB_debug_output, load_GL_ARB_debug_output },
+	{ "GL_ARB_depth_buffer_float", &GLAD_GL_ARB_depth_buffer_float, NULL },
+	{ "GL_ARB_depth_clamp", &GLAD_GL_ARB_depth_clamp, NULL },
+	{ "GL_ARB_depth_texture", &GLAD_GL_ARB_depth_texture, NULL },
+	{ "GL_ARB_derivative_control", &GLAD_GL_ARB_derivative_control, NULL },
+	{ "GL_ARB_direct_state_access", &GLAD_GL_ARB_direct_state_access, load_GL_ARB_direct_state_access },
+	{ "GL_ARB_draw_buffers", &GLAD_GL_ARB_draw_buffers, load_GL_ARB_draw_buffers },
+	{ "GL_ARB_draw_buffers_blend", &GLAD_GL_ARB_draw_buffers_blend, load_GL_ARB_draw_buffers_blend },
+	{ "GL_ARB_draw_elements_base_vertex", &GLAD_GL_ARB_draw_elements_base_vertex, load_GL_ARB_draw_elements_base_vertex },
+	{ "GL_ARB_draw_indirect", &GLAD_GL_ARB_draw_indirect, load_GL_ARB_draw_indirect },
+	{ "GL_ARB_draw_instanced", &GLAD_GL_ARB_draw_instanced, load_GL_ARB_draw_instanced },
+	{ "GL_ARB_enhanced_layouts", &GLAD_GL_ARB_enhanced_layouts, NULL },
+	{ "GL_ARB_explicit_attrib_location", &GLAD_GL_ARB_explicit_attrib_location, NULL },
+	{ "GL_ARB_explicit_uniform_location", &GLAD_GL_ARB_explicit_uniform_location, NULL },
+	{ "GL_ARB_fragment_coord_conventions", &GLAD_GL_ARB_fragment_coord_conventions, NULL },
+	{ "GL_ARB_fragment_layer_viewport", &GLAD_GL_ARB_fragment_layer_viewport, NULL },
+	{ "GL_ARB_fragment_program", &GLAD_GL_ARB_fragment_program, load_GL_ARB_fragment_program },
+	{ "GL_ARB_fragment_program_shadow", &GLAD_GL_ARB_fragment_program_shadow, NULL },
+	{ "GL_ARB_fragment_shader", &GLAD_GL_ARB_fragment_shader, NULL },
+	{ "GL_ARB_fragment_shader_interlock", &GLAD_GL_ARB_fragment_shader_interlock, NULL },
+	{ "GL_ARB_framebuffer_no_attachments", &GLAD_GL_ARB_framebuffer_no_attachments, load_GL_ARB_framebuffer_no_attachments },
+	{ "GL_ARB_framebuffer_object", &GLAD_GL_ARB_framebuffer_object, load_GL_ARB_framebuffer_object },
+	{ "GL_ARB_framebuffer_sRGB", &GLAD_GL_ARB_framebuffer_sRGB, NULL },
+	{ "GL_ARB_geometry_shader4", &GLAD_GL_ARB_geometry_shader4, load_GL_ARB_geometry_shader4 },
+	{ "GL_ARB_get_program_binary", &GLAD_GL_ARB_get_program_binary, load_GL_ARB_get_program_binary },
+	{ "GL_ARB_get_texture_sub_image", &GLAD_GL_ARB_get_texture_sub_image, load_GL_ARB_get_texture_sub_image },
+	{ "GL_ARB_gl_spirv", &GLAD_GL_ARB_gl_spirv, load_GL_ARB_gl_spirv },
+	{ "GL_ARB_gpu_shader5", &GLAD_GL_ARB_gpu_shader5, NULL },
+	{ "GL_ARB_gpu_shader_fp64", &GLAD_GL_ARB_gpu_shader_fp64, load_GL_ARB_gpu_shader_fp64 },
+	{ "GL_ARB_gpu_shader_int64", &GLAD_GL_ARB_gpu_shader_int64, load_GL_ARB_gpu_shader_int64 },
+	{ "GL_ARB_half_float_pixel", &GLAD_GL_ARB_half_float_pixel, NULL },
+	{ "GL_ARB_half_float_vertex", &GLAD_GL_ARB_half_float_vertex, NULL },
+	{ "GL_ARB_imaging", &GLAD_GL_ARB_imaging, load_GL_ARB_imaging },
+	{ "GL_ARB_indirect_parameters", &GLAD_GL_ARB_indirect_parameters, load_GL_ARB_indirect_parameters },
+	{ "GL_ARB_instanced_arrays", &GLAD_GL_ARB_instanced_arrays, load_GL_ARB_instanced_arrays },
+	{ "GL_ARB_internalformat_query", &GLAD_GL_ARB_internalformat_query, load_GL_ARB_internalformat_query },
+	{ "GL_ARB_internalformat_query2", &GLAD_GL_ARB_internalformat_query2, load_GL_ARB_internalformat_query2 },
+	{ "GL_ARB_invalidate_subdata", &GLAD_GL_ARB_invalidate_subdata, load_GL_ARB_invalidate_subdata },
+	{ "GL_ARB_map_buffer_alignment", &GLAD_GL_ARB_map_buffer_alignment, NULL },
+	{ "GL_ARB_map_buffer_range", &GLAD_GL_ARB_map_buffer_range, load_GL_ARB_map_buffer_range },
+	{ "GL_ARB_matrix_palette", &GLAD_GL_ARB_matrix_palette, load_GL_ARB_matrix_palette },
+	{ "GL_ARB_multi_bind", &GLAD_GL_ARB_multi_bind, load_GL_ARB_multi_bind },
+	{ "GL_ARB_multi_draw_indirect", &GLAD_GL_ARB_multi_draw_indirect, load_GL_ARB_multi_draw_indirect },
+	{ "GL_ARB_multisample", &GLAD_GL_ARB_multisample, load_GL_ARB_multisample },
+	{ "GL_ARB_multitexture", &GLAD_GL_ARB_multitexture, load_GL_ARB_multitexture },
+	{ "GL_ARB_occlusion_query", &GLAD_GL_ARB_occlusion_query, load_GL_ARB_occlusion_query },
+	{ "GL_ARB_occlusion_query2", &GLAD_GL_ARB_occlusion_query2, NULL },
+	{ "GL_ARB_parallel_shader_compile", &GLAD_GL_ARB_parallel_shader_compile, load_GL_ARB_parallel_shader_compile },
+	{ "GL_ARB_pipeline_statistics_query", &GLAD_GL_ARB_pipeline_statistics_query, NULL },
+	{ "GL_ARB_pixel_buffer_object", &GLAD_GL_ARB_pixel_buffer_object, NULL },
+	{ "GL_ARB_point_parameters", &GLAD_GL_ARB_point_parameters, load_GL_ARB_point_parameters },
+	{ "GL_ARB_point_sprite", &GLAD_GL_ARB_point_sprite, NULL },
+	{ "GL_ARB_polygon_offset_clamp", &GLAD_GL_ARB_polygon_offset_clamp, load_GL_ARB_polygon_offset_clamp },
+	{ "GL_ARB_post_depth_coverage", &GLAD_GL_ARB_post_depth_coverage, NULL },
+	{ "GL_ARB_program_interface_query", &GLAD_GL_ARB_program_interface_query, load_GL_ARB_program_interface_query },
+	{ "GL_ARB_provoking_vertex", &GLAD_GL_ARB_provoking_vertex, load_GL_ARB_provoking_vertex },
+	{ "GL_ARB_query_buffer_object", &GLAD_GL_ARB_query_buffer_object, NULL },
+	{ "GL_ARB_robust_buffer_access_behavior", &GLAD_GL_ARB_robust_buffer_access_behavior, NULL },
+	{ "GL_ARB_robustness", &GLAD_GL_ARB_robustness, load_GL_ARB_robustness },
+	{ "GL_ARB_robustness_isolation", &GLAD_GL_ARB_robustness_isolation, NULL },
+	{ "GL_ARB_sample_locations", &GLAD_GL_ARB_sample_locations, load_GL_ARB_sample_locations },
+	{ "GL_ARB_sample_shading", &GLAD_GL_ARB_sample_shading, load_GL_ARB_sample_shading },
+	{ "GL_ARB_sampler_objects", &GLAD_GL_ARB_sampler_objects, load_GL_ARB_sampler_objects },
+	{ "GL_ARB_seamless_cube_map", &GLAD_GL_ARB_seamless_cube_map, NULL },
+	{ "GL_ARB_seamless_cubemap_per_texture", &GLAD_GL_ARB_seamless_cubemap_per_texture, NULL },
+	{ "GL_ARB_separate_shader_objects", &GLAD_GL_ARB_separate_shader_objects, load_GL_ARB_separate_shader_objects },
+	{ "GL_ARB_shader_atomic_counter_ops", &GLAD_GL_ARB_shader_atomic_counter_ops, NULL },
+	{ "GL_ARB_shader_atomic_counters", &GLAD_GL_ARB_shader_atomic_counters, load_GL_ARB_shader_atomic_counters },
+	{ "GL_ARB_shader_ballot", &GLAD_GL_ARB_shader_ballot, NULL },
+	{ "GL_ARB_shader_bit_encoding", &GLAD_GL_ARB_shader_bit_encoding, NULL },
+	{ "GL_ARB_shader_clock", &GLAD_GL_ARB_shader_clock, NULL },
+	{ "GL_ARB_shader_draw_parameters", &GLAD_GL_ARB_shader_draw_parameters, NULL },
+	{ "GL_ARB_shader_group_vote", &GLAD_GL_ARB_shader_group_vote, NULL },
+	{ "GL_ARB_shader_image_load_store", &GLAD_GL_ARB_shader_image_load_store, load_GL_ARB_shader_image_load_store },
+	{ "GL_ARB_shader_image_size", &GLAD_GL_ARB_shader_image_size, NULL },
+	{ "GL_ARB_shader_objects", &GLAD_GL_ARB_shader_objects, load_GL_ARB_shader_objects },
+	{ "GL_ARB_shader_precision", &GLAD_GL_ARB_shader_precision, NULL },
+	{ "GL_ARB_shader_stencil_export", &GLAD_GL_ARB_shader_stencil_export, NULL },
+	{ "GL_ARB_shader_storage_buffer_object", &GLAD_GL_ARB_shader_storage_buffer_object, load_GL_ARB_shader_storage_buffer_object },
+	{ "GL_ARB_shader_subroutine", &GLAD_GL_ARB_shader_subroutine, load_GL_ARB_shader_subroutine },
+	{ "GL_ARB_shader_texture_image_samples", &GLAD_GL_ARB_shader_texture_image_samples, NULL },
+	{ "GL_ARB_shader_texture_lod", &GLAD_GL_ARB_shader_texture_lod, NULL },
+	{ "GL_ARB_shader_viewport_layer_array", &GLAD_GL_ARB_shader_viewport_layer_array, NULL },
+	{ "GL_ARB_shading_language_100", &GLAD_GL_ARB_shading_language_100, NULL },
+	{ "GL_ARB_shading_language_420pack", &GLAD_GL_ARB_shading_language_420pack, NULL },
+	{ "GL_ARB_shading_language_include", &GLAD_GL_ARB_shading_language_include, load_GL_ARB_shading_language_include },
+	{ "GL_ARB_shading_language_packing", &GLAD_GL_ARB_shading_language_packing, NULL },
+	{ "GL_ARB_shadow", &GLAD_GL_ARB_shadow, NULL },
+	{ "GL_ARB_shadow_ambient", &GLAD_GL_ARB_shadow_ambient, NULL },
+	{ "GL_ARB_sparse_buffer", &GLAD_GL_ARB_sparse_buffer, load_GL_ARB_sparse_buffer },
+	{ "GL_ARB_sparse_texture", &GLAD_GL_ARB_sparse_texture, load_GL_ARB_sparse_texture },
+	{ "GL_ARB_sparse_texture2", &GLAD_GL_ARB_sparse_texture2, NULL },
+	{ "GL_ARB_sparse_texture_clamp", &GLAD_GL_ARB_sparse_texture_clamp, NULL },
+	{ "GL_ARB_spirv_extensions", &GLAD_GL_ARB_spirv_extensions, NULL },
+	{ "GL_ARB_stencil_texturing", &GLAD_GL_ARB_stencil_texturing, NULL },
+	{ "GL_ARB_sync", &GLAD_GL_ARB_sync, load_GL_ARB_sync },
+	{ "GL_ARB_tessellation_shader", &GLAD_GL_ARB_tessellation_shader, load_GL_ARB_tessellation_shader },
+	{ "GL_ARB_texture_barrier", &GLAD_GL_ARB_texture_barrier, load_GL_ARB_texture_barrier },
+	{ "GL_ARB_texture_border_clamp", &GLAD_GL_ARB_texture_border_clamp, NULL },
+	{ "GL_ARB_texture_buffer_object", &GLAD_GL_ARB_texture_buffer_object, load_GL_ARB_texture_buffer_object },
+	{ "GL_ARB_texture_buffer_object_rgb32", &GLAD_GL_ARB_texture_buffer_object_rgb32, NULL },
+	{ "GL_ARB_texture_buffer_range", &GLAD_GL_ARB_texture_buffer_range, load_GL_ARB_texture_buffer_range },
+	{ "GL_ARB_texture_compression", &GLAD_GL_ARB_texture_compression, load_GL_ARB_texture_compression },
+	{ "GL_ARB_texture_compression_bptc", &GLAD_GL_ARB_texture_compression_bptc, NULL },
+	{ "GL_ARB_texture_compression_rgtc", &GLAD_GL_ARB_texture_compression_rgtc, NULL },
+	{ "GL_ARB_texture_cube_map", &GLAD_GL_ARB_texture_cube_map, NULL },
+	{ "GL_ARB_texture_cube_map_array", &GLAD_GL_ARB_texture_cube_map_array, NULL },
+	{ "GL_ARB_texture_env_add", &GLAD_GL_ARB_texture_env_add, NULL },
+	{ "GL_ARB_texture_env_combine", &GLAD_GL_ARB_texture_env_combine, NULL },
+	{ "GL_ARB_texture_env_crossbar", &GLAD_GL_ARB_texture_env_crossbar, NULL },
+	{ "GL_ARB_texture_env_dot3", &GLAD_GL_ARB_texture_env_dot3, NULL },
+	{ "GL_ARB_texture_filter_anisotropic", &GLAD_GL_ARB_texture_filter_anisotropic, NULL },
+	{ "GL_ARB_texture_filter_minmax", &GLAD_GL_ARB_texture_filter_minmax, NULL },
+	{ "GL_ARB_texture_float", &GLAD_GL_ARB_texture_float, NULL },
+	{ "GL_ARB_texture_gather", &GLAD_GL_ARB_texture_gather, NULL },
+	{ "GL_ARB_texture_mirror_clamp_to_edge", &GLAD_GL_ARB_texture_mirror_clamp_to_edge, NULL },
+	{ "GL_ARB_texture_mirrored_repeat", &GLAD_GL_ARB_texture_mirrored_repeat, NULL },
+	{ "GL_ARB_texture_multisample", &GLAD_GL_ARB_texture_multisample, load_GL_ARB_texture_multisample },
+	{ "GL_ARB_texture_non_power_of_two", &GLAD_GL_ARB_texture_non_power_of_two, NULL },
+	{ "GL_ARB_texture_query_levels", &GLAD_GL_ARB_texture_query_levels, NULL },
+	{ "GL_ARB_texture_query_lod", &GLAD_GL_ARB_texture_query_lod, NULL },
+	{ "GL_ARB_texture_rectangle", &GLAD_GL_ARB_texture_rectangle, NULL },
+	{ "GL_ARB_texture_rg", &GLAD_GL_ARB_texture_rg, NULL },
+	{ "GL_ARB_texture_rgb10_a2ui", &GLAD_GL_ARB_texture_rgb10_a2ui, NULL },
+	{ "GL_ARB_texture_stencil8", &GLAD_GL_ARB_texture_stencil8, NULL },
+	{ "GL_ARB_texture_storage", &GLAD_GL_ARB_texture_storage, load_GL_ARB_texture_storage },
+	{ "GL_ARB_texture_storage_multisample", &GLAD_GL_ARB_texture_storage_multisample, load_GL_ARB_texture_storage_multisample },
+	{ "GL_ARB_texture_swizzle", &GLAD_GL_ARB_texture_swizzle, NULL },
+	{ "GL_ARB_texture_view", &GLAD_GL_ARB_texture_view, load_GL_ARB_texture_view },
+	{ "GL_ARB_timer_query", &GLAD_GL_ARB_timer_query, load_GL_ARB_timer_query },
+	{ "GL_ARB_transform_feedback2", &GLAD_GL_ARB_transform_feedback2, load_GL_ARB_transform_feedback2 },
+	{ "GL_ARB_transform_feedback3", &GLAD_GL_ARB_transform_feedback3, load_GL_ARB_transform_feedback3 },
+	{ "GL_ARB_transform_feedback_instanced", &GLAD_GL_ARB_transform_feedback_instanced, load_GL_ARB_transform_feedback_instanced },
+	{ "GL_ARB_transform_feedback_overflow_query", &GLAD_GL_ARB_transform_feedback_overflow_query, NULL },
+	{ "GL_ARB_transpose_matrix", &GLAD_GL_ARB_transpose_matrix, load_GL_ARB_transpose_matrix },
+	{ "GL_ARB_uniform_buffer_object", &GLAD_GL_ARB_uniform_buffer_object, load_GL_ARB_uniform_buffer_object },
+	{ "GL_ARB_vertex_array_bgra", &GLAD_GL_ARB_vertex_array_bgra, NULL },
+	{ "GL_ARB_vertex_array_object", &GLAD_GL_ARB_vertex_array_object, load_GL_ARB_vertex_array_object },
+	{ "GL_ARB_vertex_attrib_64bit", &GLAD_GL_ARB_vertex_attrib_64bit, load_GL_ARB_vertex_attrib_64bit },
+	{ "GL_ARB_vertex_attrib_binding", &GLAD_GL_ARB_vertex_attrib_binding, load_GL_ARB_vertex_attrib_binding },
+	{ "GL_ARB_vertex_blend", &GLAD_GL_ARB_vertex_blend, load_GL_ARB_vertex_blend },
+	{ "GL_ARB_vertex_buffer_object", &GLAD_GL_ARB_vertex_buffer_object, load_GL_ARB_vertex_buffer_object },
+	{ "GL_ARB_vertex_program", &GLAD_GL_ARB_vertex_program, load_GL_ARB_vertex_program },
+	{ "GL_ARB_vertex_shader", &GLAD_GL_ARB_vertex_shader, load_GL_ARB_vertex_shader },
+	{ "GL_ARB_vertex_type_10f_11f_11f_rev", &GLAD_GL_ARB_vertex_type_10f_11f_11f_rev, NULL },
+	{ "GL_ARB_vertex_type_2_10_10_10_rev", &GLAD_GL_ARB_vertex_type_2_10_10_10_rev, load_GL_ARB_vertex_type_2_10_10_10_rev },
+	{ "GL_ARB_viewport_array", &GLAD_GL_ARB_viewport_array, load_GL_ARB_viewport_array },
+	{ "GL_ARB_window_pos", &GLAD_GL_ARB_window_pos, load_GL_ARB_window_pos },
+	{ "GL_ATI_draw_buffers", &GLAD_GL_ATI_draw_buffers, load_GL_ATI_draw_buffers },
+	{ "GL_ATI_element_array", &GLAD_GL_ATI_element_array, load_GL_ATI_element_array },
+	{ "GL_ATI_envmap_bumpmap", &GLAD_GL_ATI_envmap_bumpmap, load_GL_ATI_envmap_bumpmap },
+	{ "GL_ATI_fragment_shader", &GLAD_GL_ATI_fragment_shader, load_GL_ATI_fragment_shader },
+	{ "GL_ATI_map_object_buffer", &GLAD_GL_ATI_map_object_buffer, load_GL_ATI_map_object_buffer },
+	{ "GL_ATI_meminfo", &GLAD_GL_ATI_meminfo, NULL },
+	{ "GL_ATI_pixel_format_float", &GLAD_GL_ATI_pixel_format_float, NULL },
+	{ "GL_ATI_pn_triangles", &GLAD_GL_ATI_pn_triangles, load_GL_ATI_pn_triangles },
+	{ "GL_ATI_separate_stencil", &GLAD_GL_ATI_separate_stencil, load_GL_ATI_separate_stencil },
+	{ "GL_ATI_text_fragment_shader", &GLAD_GL_ATI_text_fragment_shader, NULL },
+	{ "GL_ATI_texture_env_combine3", &GLAD_GL_ATI_texture_env_combine3, NULL },
+	{ "GL_ATI_texture_float", &GLAD_GL_ATI_texture_float, NULL },
+	{ "GL_ATI_texture_mirror_once", &GLAD_GL_ATI_texture_mirror_once, NULL },
+	{ "GL_ATI_vertex_array_object", &GLAD_GL_ATI_vertex_array_object, load_GL_ATI_vertex_array_object },
+	{ "GL_ATI_vertex_attrib_array_object", &GLAD_GL_ATI_vertex_attrib_array_object, load_GL_ATI_vertex_attrib_array_object },
+	{ "GL_ATI_vertex_streams", &GLAD_GL_ATI_vertex_streams, load_GL_ATI_vertex_streams },
+	{ "GL_EXT_422_pixels", &GLAD_GL_EXT_422_pixels, NULL },
+	{ "GL_EXT_EGL_image_storage", &GLAD_GL_EXT_EGL_image_storage, load_GL_EXT_EGL_image_storage },
+	{ "GL_EXT_EGL_sync", &GLAD_GL_EXT_EGL_sync, NULL },
+	{ "GL_EXT_abgr", &GLAD_GL_EXT_abgr, NULL },
+	{ "GL_EXT_bgra", &GLAD_GL_EXT_bgra, NULL },
+	{ "GL_EXT_bindable_uniform", &GLAD_GL_EXT_bindable_uniform, load_GL_EXT_bindable_uniform },
+	{ "GL_EXT_blend_color", &GLAD_GL_EXT_blend_color, load_GL_EXT_blend_color },
+	{ "GL_EXT_blend_equation_separate", &GLAD_GL_EXT_blend_equation_separate, load_GL_EXT_blend_equation_separate },
+	{ "GL_EXT_blend_func_separate", &GLAD_GL_EXT_blend_func_separate, load_GL_EXT_blend_func_separate },
+	{ "GL_EXT_blend_logic_op", &GLAD_GL_EXT_blend_logic_op, NULL },
+	{ "GL_EXT_blend_minmax", &GLAD_GL_EXT_blend_minmax, load_GL_EXT_blend_minmax },
+	{ "GL_EXT_blend_subtract", &GLAD_GL_EXT_blend_subtract, NULL },
+	{ "GL_EXT_clip_volume_hint", &GLAD_GL_EXT_clip_volume_hint, NULL },
+	{ "GL_EXT_cmyka", &GLAD_GL_EXT_cmyka, NULL },
+	{ "GL_EXT_color_subtable", &GLAD_GL_EXT_color_subtable, load_GL_EXT_color_subtable },
+	{ "GL_EXT_compiled_vertex_array", &GLAD_GL_EXT_compiled_vertex_array, load_GL_EXT_compiled_vertex_array },
+	{ "GL_EXT_convolution", &GLAD_GL_EXT_convolution, load_GL_EXT_convolution },
+	{ "GL_EXT_coordinate_frame", &GLAD_GL_EXT_coordinate_frame, load_GL_EXT_coordinate_frame },
+	{ "GL_EXT_copy_texture", &GLAD_GL_EXT_copy_texture, load_GL_EXT_copy_texture },
+	{ "GL_EXT_cull_vertex", &GLAD_GL_EXT_cull_vertex, load_GL_EXT_cull_vertex },
+	{ "GL_EXT_debug_label", &GLAD_GL_EXT_debug_label, load_GL_EXT_debug_label },
+	{ "GL_EXT_debug_marker", &GLAD_GL_EXT_debug_marker, load_GL_EXT_debug_marker },
+	{ "GL_EXT_depth_bounds_test", &GLAD_GL_EXT_depth_bounds_test, load_GL_EXT_depth_bounds_test },
+	{ "GL_EXT_direct_state_access", &GLAD_GL_EXT_direct_state_access, load_GL_EXT_direct_state_access },
+	{ "GL_EXT_draw_buffers2", &GLAD_GL_EXT_draw_buffers2, load_GL_EXT_draw_buffers2 },
+	{ "GL_EXT_draw_instanced", &GLAD_GL_EXT_draw_instanced, load_GL_EXT_draw_instanced },
+	{ "GL_EXT_draw_range_elements", &GLAD_GL_EXT_draw_range_elements, load_GL_EXT_draw_range_elements },
+	{ "GL_EXT_external_buffer", &GLAD_GL_EXT_external_buffer, load_GL_EXT_external_buffer },
+	{ "GL_EXT_fog_coord", &GLAD_GL_EXT_fog_coord, load_GL_EXT_fog_coord },
+	{ "GL_EXT_framebuffer_blit", &GLAD_GL_EXT_framebuffer_blit, load_GL_EXT_framebuffer_blit },
+	{ "GL_EXT_framebuffer_blit_layers", &GLAD_GL_EXT_framebuffer_blit_layers, load_GL_EXT_framebuffer_blit_layers },
+	{ "GL_EXT_framebuffer_multisample", &GLAD_GL_EXT_framebuffer_multisample, load_GL_EXT_framebuffer_multisample },
+	{ "GL_EXT_framebuffer_multisample_blit_scaled", &GLAD_GL_EXT_framebuffer_multisample_blit_scaled, NULL },
+	{ "GL_EXT_framebuffer_object", &GLAD_GL_EXT_framebuffer_object, load_GL_EXT_framebuffer_object },
+	{ "GL_EXT_framebuffer_sRGB", &GLAD_GL_EXT_framebuffer_sRGB, NULL },
+	{ "GL_EXT_geometry_shader4", &GLAD_GL_EXT_geometry_shader4, load_GL_EXT_geometry_shader4 },
+	{ "GL_EXT_gpu_program_parameters", &GLAD_GL_EXT_gpu_program_parameters, load_GL_EXT_gpu_program_parameters },
+	{ "GL_EXT_gpu_shader4", &GLAD_GL_EXT_gpu_shader4, load_GL_EXT_gpu_shader4 },
+	{ "GL_EXT_histogram", &GLAD_GL_EXT_histogram, load_GL_EXT_histogram },
+	{ "GL_EXT_index_array_formats", &GLAD_GL_EXT_index_array_formats, NULL },
+	{ "GL_EXT_index_func", &GLAD_GL_EXT_index_func, load_GL_EXT_index_func },
+	{ "GL_EXT_index_material", &GLAD_GL_EXT_index_material, load_GL_EXT_index_material },
+	{ "GL_EXT_index_texture", &GLAD_GL_EXT_index_texture, NULL },
+	{ "GL_EXT_light_texture", &GLAD_GL_EXT_light_texture, load_GL_EXT_light_texture },
+	{ "GL_EXT_memory_object", &GLAD_GL_EXT_memory_object, load_GL_EXT_memory_object },
+	{ "GL_EXT_memory_object_fd", &GLAD_GL_EXT_memory_object_fd, load_GL_EXT_memory_object_fd },
+	{ "GL_EXT_memory_object_win32", &GLAD_GL_EXT_memory_object_win32, load_GL_EXT_memory_object_win32 },
+	{ "GL_EXT_misc_attribute", &GLAD_GL_EXT_misc_attribute, NULL },
+	{ "GL_EXT_multi_draw_arrays", &GLAD_GL_EXT_multi_draw_arrays, load_GL_EXT_multi_draw_arrays },
+	{ "GL_EXT_multisample", &GLAD_GL_EXT_multisample, load_GL_EXT_multisample },
+	{ "GL_EXT_multiview_tessellation_geometry_shader", &GLAD_GL_EXT_multiview_tessellation_geometry_shader, NULL },
+	{ "GL_EXT_multiview_texture_multisample", &GLAD_GL_EXT_multiview_texture_multisample, NULL },
+	{ "GL_EXT_multiview_timer_query", &GLAD_GL_EXT_multiview_timer_query, NULL },
+	{ "GL_EXT_packed_depth_stencil", &GLAD_GL_EXT_packed_depth_stencil, NULL },
+	{ "GL_EXT_packed_float", &GLAD_GL_EXT_packed_float, NULL },
+	{ "GL_EXT_packed_pixels", &GLAD_GL_EXT_packed_pixels, NULL },
+	{ "GL_EXT_paletted_texture", &GLAD_GL_EXT_paletted_texture, load_GL_EXT_paletted_texture },
+	{ "GL_EXT_pixel_buffer_object", &GLAD_GL_EXT_pixel_buffer_object, NULL },
+	{ "GL_EXT_pixel_transform", &GLAD_GL_EXT_pixel_transform, load_GL_EXT_pixel_transform },
+	{ "GL_EXT_pixel_transform_color_table", &GLAD_GL_EXT_pixel_transform_color_table, NULL },
+	{ "GL_EXT_point_parameters", &GLAD_GL_EXT_point_parameters, load_GL_EXT_point_parameters },
+	{ "GL_EXT_polygon_offset", &GLAD_GL_EXT_polygon_offset, load_GL_EXT_polygon_offset },
+	{ "GL_EXT_polygon_offset_clamp", &GLAD_GL_EXT_polygon_offset_clamp, load_GL_EXT_polygon_offset_clamp },
+	{ "GL_EXT_post_depth_coverage", &GLAD_GL_EXT_post_depth_coverage, NULL },
+	{ "GL_EXT_provoking_vertex", &GLAD_GL_EXT_provoking_vertex, load_GL_EXT_provoking_vertex },
+	{ "GL_EXT_raster_multisample", &GLAD_GL_EXT_raster_multisample, load_GL_EXT_raster_multisample },
+	{ "GL_EXT_rescale_normal", &GLAD_GL_EXT_rescale_normal, NULL },
+	{ "GL_EXT_secondary_color", &GLAD_GL_EXT_secondary_color, load_GL_EXT_secondary_color },
+	{ "GL_EXT_semaphore", &GLAD_GL_EXT_semaphore, load_GL_EXT_semaphore },
+	{ "GL_EXT_semaphore_fd", &GLAD_GL_EXT_semaphore_fd, load_GL_EXT_semaphore_fd },
+	{ "GL_EXT_semaphore_win32", &GLAD_GL_EXT_semaphore_win32, load_GL_EXT_semaphore_win32 },
+	{ "GL_EXT_separate_shader_objects", &GLAD_GL_EXT_separate_shader_objects, load_GL_EXT_separate_shader_objects },
+	{ "GL_EXT_separate_specular_color", &GLAD_GL_EXT_separate_specular_color, NULL },
+	{ "GL_EXT_shader_framebuffer_fetch", &GLAD_GL_EXT_shader_framebuffer_fetch, NULL },
+	{ "GL_EXT_shader_framebuffer_fetch_non_coherent", &GLAD_GL_EXT_shader_framebuffer_fetch_non_coherent, load_GL_EXT_shader_framebuffer_fetch_non_coherent },
+	{ "GL_EXT_shader_image_load_formatted", &GLAD_GL_EXT_shader_image_load_formatted, NULL },
+	{ "GL_EXT_shader_image_load_store", &GLAD_GL_EXT_shader_image_load_store, load_GL_EXT_shader_image_load_store },
+	{ "GL_EXT_shader_integer_mix", &GLAD_GL_EXT_shader_integer_mix, NULL },
+	{ "GL_EXT_shader_samples_identical", &GLAD_GL_EXT_shader_samples_identical, NULL },
+	{ "GL_EXT_shadow_funcs", &GLAD_GL_EXT_shadow_funcs, NULL },
+	{ "GL_EXT_shared_texture_palette", &GLAD_GL_EXT_shared_texture_palette, NULL },
+	{ "GL_EXT_sparse_texture2", &GLAD_GL_EXT_sparse_texture2, NULL },
+	{ "GL_EXT_stencil_clear_tag", &GLAD_GL_EXT_stencil_clear_tag, load_GL_EXT_stencil_clear_tag },
+	{ "GL_EXT_stencil_two_side", &GLAD_GL_EXT_stencil_two_side, load_GL_EXT_stencil_two_side },
+	{ "GL_EXT_stencil_wrap", &GLAD_GL_EXT_stencil_wrap, NULL },
+	{ "GL_EXT_subtexture", &GLAD_GL_EXT_subtexture, load_GL_EXT_subtexture },
+	{ "GL_EXT_texture", &GLAD_GL_EXT_texture, NULL },
+	{ "GL_EXT_texture3D", &GLAD_GL_EXT_texture3D, load_GL_EXT_texture3D },
+	{ "GL_EXT_texture_array", &GLAD_GL_EXT_texture_array, load_GL_EXT_texture_array },
+	{ "GL_EXT_texture_buffer_object", &GLAD_GL_EXT_texture_buffer_object, load_GL_EXT_texture_buffer_object },
+	{ "GL_EXT_texture_compression_latc", &GLAD_GL_EXT_texture_compression_latc, NULL },
+	{ "GL_EXT_texture_compression_rgtc", &GLAD_GL_EXT_texture_compression_rgtc, NULL },
+	{ "GL_EXT_texture_compression_s3tc", &GLAD_GL_EXT_texture_compression_s3tc, NULL },
+	{ "GL_EXT_texture_cube_map", &GLAD_GL_EXT_texture_cube_map, NULL },
+	{ "GL_EXT_texture_env_add", &GLAD_GL_EXT_texture_env_add, NULL },
+	{ "GL_EXT_texture_env_combine", &GLAD_GL_EXT_texture_env_combine, NULL },
+	{ "GL_EXT_texture_env_dot3", &GLAD_GL_EXT_texture_env_dot3, NULL },
+	{ "GL_EXT_texture_filter_anisotropic", &GLAD_GL_EXT_texture_filter_anisotropic, NULL },
+	{ "GL_EXT_texture_filter_minmax", &GLAD_GL_EXT_texture_filter_minmax, NULL },
+	{ "GL_EXT_texture_integer", &GLAD_GL_EXT_texture_integer, load_GL_EXT_texture_integer },
+	{ "GL_EXT_texture_lod_bias", &GLAD_GL_EXT_texture_lod_bias, NULL },
+	{ "GL_EXT_texture_mirror_clamp", &GLAD_GL_EXT_texture_mirror_clamp, NULL },
+	{ "GL_EXT_texture_object", &GLAD_GL_EXT_texture_object, load_GL_EXT_texture_object },
+	{ "GL_EXT_texture_perturb_normal", &GLAD_GL_EXT_texture_perturb_normal, load_GL_EXT_texture_perturb_normal },
+	{ "GL_EXT_texture_sRGB", &GLAD_GL_EXT_texture_sRGB, NULL },
+	{ "GL_EXT_texture_sRGB_R8", &GLAD_GL_EXT_texture_sRGB_R8, NULL },
+	{ "GL_EXT_texture_sRGB_RG8", &GLAD_GL_EXT_texture_sRGB_RG8, NULL },
+	{ "GL_EXT_texture_sRGB_decode", &GLAD_GL_EXT_texture_sRGB_decode, NULL },
+	{ "GL_EXT_texture_shadow_lod", &GLAD_GL_EXT_texture_shadow_lod, NULL },
+	{ "GL_EXT_texture_shared_exponent", &GLAD_GL_EXT_texture_shared_exponent, NULL },
+	{ "GL_EXT_texture_snorm", &GLAD_GL_EXT_texture_snorm, NULL },
+	{ "GL_EXT_texture_storage", &GLAD_GL_EXT_texture_storage, load_GL_EXT_texture_storage },
+	{ "GL_EXT_texture_swizzle", &GLAD_GL_EXT_texture_swizzle, NULL },
+	{ "GL_EXT_timer_query", &GLAD_GL_EXT_timer_query, load_GL_EXT_timer_query },
+	{ "GL_EXT_transform_feedback", &GLAD_GL_EXT_transform_feedback, load_GL_EXT_transform_feedback },
+	{ "GL_EXT_vertex_array", &GLAD_GL_EXT_vertex_array, load_GL_EXT_vertex_array },
+	{ "GL_EXT_vertex_array_bgra", &GLAD_GL_EXT_vertex_array_bgra, NULL },
+	{ "GL_EXT_vertex_attrib_64bit", &GLAD_GL_EXT_vertex_attrib_64bit, load_GL_EXT_vertex_attrib_64bit },
+	{ "GL_EXT_vertex_shader", &GLAD_GL_EXT_vertex_shader, load_GL_EXT_vertex_shader },
+	{ "GL_EXT_vertex_weighting", &GLAD_GL_EXT_vertex_weighting, load_GL_EXT_vertex_weighting },
+	{ "GL_EXT_win32_keyed_mutex", &GLAD_GL_EXT_win32_keyed_mutex, load_GL_EXT_win32_keyed_mutex },
+	{ "GL_EXT_window_rectangles", &GLAD_GL_EXT_window_rectangles, load_GL_EXT_window_rectangles },
+	{ "GL_EXT_x11_sync_object", &GLAD_GL_EXT_x11_sync_object, load_GL_EXT_x11_sync_object },
+	{ "GL_GREMEDY_frame_terminator", &GLAD_GL_GREMEDY_frame_terminator, load_GL_GREMEDY_frame_terminator },
+	{ "GL_GREMEDY_string_marker", &GLAD_GL_GREMEDY_string_marker, load_GL_GREMEDY_string_marker },
+	{ "GL_HP_convolution_border_modes", &GLAD_GL_HP_convolution_border_modes, NULL },
+	{ "GL_HP_image_transform", &GLAD_GL_HP_image_transform, load_GL_HP_image_transform },
+	{ "GL_HP_occlusion_test", &GLAD_GL_HP_occlusion_test, NULL },
+	{ "GL_HP_texture_lighting", &GLAD_GL_HP_texture_lighting, NULL },
+	{ "GL_IBM_cull_vertex", &GLAD_GL_IBM_cull_vertex, NULL },
+	{ "GL_IBM_multimode_draw_arrays", &GLAD_GL_IBM_multimode_draw_arrays, load_GL_IBM_multimode_draw_arrays },
+	{ "GL_IBM_rasterpos_clip", &GLAD_GL_IBM_rasterpos_clip, NULL },
+	{ "GL_IBM_static_data", &GLAD_GL_IBM_static_data, load_GL_IBM_static_data },
+	{ "GL_IBM_texture_mirrored_repeat", &GLAD_GL_IBM_texture_mirrored_repeat, NULL },
+	{ "GL_IBM_vertex_array_lists", &GLAD_GL_IBM_vertex_array_lists, load_GL_IBM_vertex_array_lists },
+	{ "GL_INGR_blend_func_separate", &GLAD_GL_INGR_blend_func_separate, load_GL_INGR_blend_func_separate },
+	{ "GL_INGR_color_clamp", &GLAD_GL_INGR_color_clamp, NULL },
+	{ "GL_INGR_interlace_read", &GLAD_GL_INGR_interlace_read, NULL },
+	{ "GL_INTEL_blackhole_render", &GLAD_GL_INTEL_blackhole_render, NULL },
+	{ "GL_INTEL_conservative_rasterization", &GLAD_GL_INTEL_conservative_rasterization, NULL },
+	{ "GL_INTEL_fragment_shader_ordering", &GLAD_GL_INTEL_fragment_shader_ordering, NULL },
+	{ "GL_INTEL_framebuffer_CMAA", &GLAD_GL_INTEL_framebuffer_CMAA, load_GL_INTEL_framebuffer_CMAA },
+	{ "GL_INTEL_map_texture", &GLAD_GL_INTEL_map_texture, load_GL_INTEL_map_texture },
+	{ "GL_INTEL_parallel_arrays", &GLAD_GL_INTEL_parallel_arrays, load_GL_INTEL_parallel_arrays },
+	{ "GL_INTEL_performance_query", &GLAD_GL_INTEL_performance_query, load_GL_INTEL_performance_query },
+	{ "GL_KHR_blend_equation_advanced", &GLAD_GL_KHR_blend_equation_advanced, load_GL_KHR_blend_equation_advanced },
+	{ "GL_KHR_blend_equation_advanced_coherent", &GLAD_GL_KHR_blend_equation_advanced_coherent, NULL },
+	{ "GL_KHR_context_flush_control", &GLAD_GL_KHR_context_flush_control, NULL },
+	{ "GL_KHR_debug", &GLAD_GL_KHR_debug, load_GL_KHR_debug },
+	{ "GL_KHR_no_error", &GLAD_GL_KHR_no_error, NULL },
+	{ "GL_KHR_parallel_shader_compile", &GLAD_GL_KHR_parallel_shader_compile, load_GL_KHR_parallel_shader_compile },
+	{ "GL_KHR_robust_buffer_access_behavior", &GLAD_GL_KHR_robust_buffer_access_behavior, NULL },
+	{ "GL_KHR_robustness", &GLAD_GL_KHR_robustness, load_GL_KHR_robustness },
+	{ "GL_KHR_shader_subgroup", &GLAD_GL_KHR_shader_subgroup, NULL },
+	{ "GL_KHR_texture_compression_astc_hdr", &GLAD_GL_KHR_texture_compression_astc_hdr, NULL },
+	{ "GL_KHR_texture_compression_astc_ldr", &GLAD_GL_KHR_texture_compression_astc_ldr, NULL },
+	{ "GL_KHR_texture_compression_astc_sliced_3d", &GLAD_GL_KHR_texture_compression_astc_sliced_3d, NULL },
+	{ "GL_MESAX_texture_stack", &GLAD_GL_MESAX_texture_stack, NULL },
+	{ "GL_MESA_framebuffer_flip_x", &GLAD_GL_MESA_framebuffer_flip_x, NULL },
+	{ "GL_MESA_framebuffer_flip_y", &GLAD_GL_MESA_framebuffer_flip_y, load_GL_MESA_framebuffer_flip_y },
+	{ "GL_MESA_framebuffer_swap_xy", &GLAD_GL_MESA_framebuffer_swap_xy, NULL },
+	{ "GL_MESA_pack_invert", &GLAD_GL_MESA_pack_invert, NULL },
+	{ "GL_MESA_program_binary_formats", &GLAD_GL_MESA_program_binary_formats, NULL },
+	{ "GL_MESA_resize_buffers", &GLAD_GL_MESA_resize_buffers, load_GL_MESA_resize_buffers },
+	{ "GL_MESA_shader_integer_functions", &GLAD_GL_MESA_shader_integer_functions, NULL },
+	{ "GL_MESA_tile_raster_order", &GLAD_GL_MESA_tile_raster_order, NULL },
+	{ "GL_MESA_window_pos", &GLAD_GL_MESA_window_pos, load_GL_MESA_window_pos },
+	{ "GL_MESA_ycbcr_texture", &GLAD_GL_MESA_ycbcr_texture, NULL },
+	{ "GL_NVX_blend_equation_advanced_multi_draw_buffers", &GLAD_GL_NVX_blend_equation_advanced_multi_draw_buffers, NULL },
+	{ "GL_NVX_conditional_render", &GLAD_GL_NVX_conditional_render, load_GL_NVX_conditional_render },
+	{ "GL_NVX_gpu_memory_info", &GLAD_GL_NVX_gpu_memory_info, NULL },
+	{ "GL_NVX_gpu_multicast2", &GLAD_GL_NVX_gpu_multicast2, load_GL_NVX_gpu_multicast2 },
+	{ "GL_NVX_linked_gpu_multicast", &GLAD_GL_NVX_linked_gpu_multicast, load_GL_NVX_linked_gpu_multicast },
+	{ "GL_NVX_progress_fence", &GLAD_GL_NVX_progress_fence, load_GL_NVX_progress_fence },
+	{ "GL_NV_alpha_to_coverage_dither_control", &GLAD_GL_NV_alpha_to_coverage_dither_control, load_GL_NV_alpha_to_coverage_dither_control },
+	{ "GL_NV_bindless_multi_draw_indirect", &GLAD_GL_NV_bindless_multi_draw_indirect, load_GL_NV_bindless_multi_draw_indirect },
+	{ "GL_NV_bindless_multi_draw_indirect_count", &GLAD_GL_NV_bindless_multi_draw_indirect_count, load_GL_NV_bindless_multi_draw_indirect_count },
+	{ "GL_NV_bindless_texture", &GLAD_GL_NV_bindless_texture, load_GL_NV_bindless_texture },
+	{ "GL_NV_blend_equation_advanced", &GLAD_GL_NV_blend_equation_advanced, load_GL_NV_blend_equation_advanced },
+	{ "GL_NV_blend_equation_advanced_coherent", &GLAD_GL_NV_blend_equation_advanced_coherent, NULL },
+	{ "GL_NV_blend_minmax_factor", &GLAD_GL_NV_blend_minmax_factor, NULL },
+	{ "GL_NV_blend_square", &GLAD_GL_NV_blend_square, NULL },
+	{ "GL_NV_clip_space_w_scaling", &GLAD_GL_NV_clip_space_w_scaling, load_GL_NV_clip_space_w_scaling },
+	{ "GL_NV_command_list", &GLAD_GL_NV_command_list, load_GL_NV_command_list },
+	{ "GL_NV_compute_program5", &GLAD_GL_NV_compute_program5, NULL },
+	{ "GL_NV_compute_shader_derivatives", &GLAD_GL_NV_compute_shader_derivatives, NULL },
+	{ "GL_NV_conditional_render", &GLAD_GL_NV_conditional_render, load_GL_NV_conditional_render },
+	{ "GL_NV_conservative_raster", &GLAD_GL_NV_conservative_raster, load_GL_NV_conservative_raster },
+	{ "GL_NV_conservative_raster_dilate", &GLAD_GL_NV_conservative_raster_dilate, load_GL_NV_conservative_raster_dilate },
+	{ "GL_NV_conservative_raster_pre_snap", &GLAD_GL_NV_conservative_raster_pre_snap, NULL },
+	{ "GL_NV_conservative_raster_pre_snap_triangles", &GLAD_GL_NV_conservative_raster_pre_snap_triangles, load_GL_NV_conservative_raster_pre_snap_triangles },
+	{ "GL_NV_conservative_raster_underestimation", &GLAD_GL_NV_conservative_raster_underestimation, NULL },
+	{ "GL_NV_copy_depth_to_color", &GLAD_GL_NV_copy_depth_to_color, NULL },
+	{ "GL_NV_copy_image", &GLAD_GL_NV_copy_image, load_GL_NV_copy_image },
+	{ "GL_NV_deep_texture3D", &GLAD_GL_NV_deep_texture3D, NULL },
+	{ "GL_NV_depth_buffer_float", &GLAD_GL_NV_depth_buffer_float, load_GL_NV_depth_buffer_float },
+	{ "GL_NV_depth_clamp", &GLAD_GL_NV_depth_clamp, NULL },
+	{ "GL_NV_draw_texture", &GLAD_GL_NV_draw_texture, load_GL_NV_draw_texture },
+	{ "GL_NV_draw_vulkan_image", &GLAD_GL_NV_draw_vulkan_image, load_GL_NV_draw_vulkan_image },
+	{ "GL_NV_evaluators", &GLAD_GL_NV_evaluators, load_GL_NV_evaluators },
+	{ "GL_NV_explicit_multisample", &GLAD_GL_NV_explicit_multisample, load_GL_NV_explicit_multisample },
+	{ "GL_NV_fence", &GLAD_GL_NV_fence, load_GL_NV_fence },
+	{ "GL_NV_fill_rectangle", &GLAD_GL_NV_fill_rectangle, NULL },
+	{ "GL_NV_float_buffer", &GLAD_GL_NV_float_buffer, NULL },
+	{ "GL_NV_fog_distance", &GLAD_GL_NV_fog_distance, NULL },
+	{ "GL_NV_fragment_coverage_to_color", &GLAD_GL_NV_fragment_coverage_to_color, load_GL_NV_fragment_coverage_to_color },
+	{ "GL_NV_fragment_program", &GLAD_GL_NV_fragment_program, load_GL_NV_fragment_program },
+	{ "GL_NV_fragment_program2", &GLAD_GL_NV_fragment_program2, NULL },
+	{ "GL_NV_fragment_program4", &GLAD_GL_NV_fragment_program4, NULL },
+	{ "GL_NV_fragment_program_option", &GLAD_GL_NV_fragment_program_option, NULL },
+	{ "GL_NV_fragment_shader_barycentric", &GLAD_GL_NV_fragment_shader_barycentric, NULL },
+	{ "GL_NV_fragment_shader_interlock", &GLAD_GL_NV_fragment_shader_interlock, NULL },
+	{ "GL_NV_framebuffer_mixed_samples", &GLAD_GL_NV_framebuffer_mixed_samples, load_GL_NV_framebuffer_mixed_samples },
+	{ "GL_NV_framebuffer_multisample_coverage", &GLAD_GL_NV_framebuffer_multisample_coverage, load_GL_NV_framebuffer_multisample_coverage },
+	{ "GL_NV_geometry_program4", &GLAD_GL_NV_geometry_program4, load_GL_NV_geometry_program4 },
+	{ "GL_NV_geometry_shader4", &GLAD_GL_NV_geometry_shader4, NULL },
+	{ "GL_NV_geometry_shader_passthrough", &GLAD_GL_NV_geometry_shader_passthrough, NULL },
+	{ "GL_NV_gpu_multicast", &GLAD_GL_NV_gpu_multicast, load_GL_NV_gpu_multicast },
+	{ "GL_NV_gpu_program4", &GLAD_GL_NV_gpu_program4, load_GL_NV_gpu_program4 },
+	{ "GL_NV_gpu_program5", &GLAD_GL_NV_gpu_program5, load_GL_NV_gpu_program5 },
+	{ "GL_NV_gpu_program5_mem_extended", &GLAD_GL_NV_gpu_program5_mem_extended, NULL },
+	{ "GL_NV_gpu_shader5", &GLAD_GL_NV_gpu_shader5, load_GL_NV_gpu_shader5 },
+	{ "GL_NV_half_float", &GLAD_GL_NV_half_float, load_GL_NV_half_float },
+	{ "GL_NV_internalformat_sample_query", &GLAD_GL_NV_internalformat_sample_query, load_GL_NV_internalformat_sample_query },
+	{ "GL_NV_light_max_exponent", &GLAD_GL_NV_light_max_exponent, NULL },
+	{ "GL_NV_memory_attachment", &GLAD_GL_NV_memory_attachment, load_GL_NV_memory_attachment },
+	{ "GL_NV_memory_object_sparse", &GLAD_GL_NV_memory_object_sparse, load_GL_NV_memory_object_sparse },
+	{ "GL_NV_mesh_shader", &GLAD_GL_NV_mesh_shader, load_GL_NV_mesh_shader },
+	{ "GL_NV_multisample_coverage", &GLAD_GL_NV_multisample_coverage, NULL },
+	{ "GL_NV_multisample_filter_hint", &GLAD_GL_NV_multisample_filter_hint, NULL },
+	{ "GL_NV_occlusion_query", &GLAD_GL_NV_occlusion_query, load_GL_NV_occlusion_query },
+	{ "GL_NV_packed_depth_stencil", &GLAD_GL_NV_packed_depth_stencil, NULL },
+	{ "GL_NV_parameter_buffer_object", &GLAD_GL_NV_parameter_buffer_object, load_GL_NV_parameter_buffer_object },
+	{ "GL_NV_parameter_buffer_object2", &GLAD_GL_NV_parameter_buffer_object2, NULL },
+	{ "GL_NV_path_rendering", &GLAD_GL_NV_path_rendering, load_GL_NV_path_rendering },
+	{ "GL_NV_path_rendering_shared_edge", &GLAD_GL_NV_path_rendering_shared_edge, NULL },
+	{ "GL_NV_pixel_data_range", &GLAD_GL_NV_pixel_data_range, load_GL_NV_pixel_data_range },
+	{ "GL_NV_point_sprite", &GLAD_GL_NV_point_sprite, load_GL_NV_point_sprite },
+	{ "GL_NV_present_video", &GLAD_GL_NV_present_video, load_GL_NV_present_video },
+	{ "GL_NV_primitive_restart", &GLAD_GL_NV_primitive_restart, load_GL_NV_primitive_restart },
+	{ "GL_NV_primitive_shading_rate", &GLAD_GL_NV_primitive_shading_rate, NULL },
+	{ "GL_NV_query_resource", &GLAD_GL_NV_query_resource, load_GL_NV_query_resource },
+	{ "GL_NV_query_resource_tag", &GLAD_GL_NV_query_resource_tag, load_GL_NV_query_resource_tag },
+	{ "GL_NV_register_combiners", &GLAD_GL_NV_register_combiners, load_GL_NV_register_combiners },
+	{ "GL_NV_register_combiners2", &GLAD_GL_NV_register_combiners2, load_GL_NV_register_combiners2 },
+	{ "GL_NV_representative_fragment_test", &GLAD_GL_NV_representative_fragment_test, NULL },
+	{ "GL_NV_robustness_video_memory_purge", &GLAD_GL_NV_robustness_video_memory_purge, NULL },
+	{ "GL_NV_sample_locations", &GLAD_GL_NV_sample_locations, load_GL_NV_sample_locations },
+	{ "GL_NV_sample_mask_override_coverage", &GLAD_GL_NV_sample_mask_override_coverage, NULL },
+	{ "GL_NV_scissor_exclusive", &GLAD_GL_NV_scissor_exclusive, load_GL_NV_scissor_exclusive },
+	{ "GL_NV_shader_atomic_counters", &GLAD_GL_NV_shader_atomic_counters, NULL },
+	{ "GL_NV_shader_atomic_float", &GLAD_GL_NV_shader_atomic_float, NULL },
+	{ "GL_NV_shader_atomic_float64", &GLAD_GL_NV_shader_atomic_float64, NULL },
+	{ "GL_NV_shader_atomic_fp16_vector", &GLAD_GL_NV_shader_atomic_fp16_vector, NULL },
+	{ "GL_NV_shader_atomic_int64", &GLAD_GL_NV_shader_atomic_int64, NULL },
+	{ "GL_NV_shader_buffer_load", &GLAD_GL_NV_shader_buffer_load, load_GL_NV_shader_buffer_load },
+	{ "GL_NV_shader_buffer_store", &GLAD_GL_NV_shader_buffer_store, NULL },
+	{ "GL_NV_shader_storage_buffer_object", &GLAD_GL_NV_shader_storage_buffer_object, NULL },
+	{ "GL_NV_shader_subgroup_partitioned", &GLAD_GL_NV_shader_subgroup_partitioned, NULL },
+	{ "GL_NV_shader_texture_footprint", &GLAD_GL_NV_shader_texture_footprint, NULL },
+	{ "GL_NV_shader_thread_group", &GLAD_GL_NV_shader_thread_group, NULL },
+	{ "GL_NV_shader_thread_shuffle", &GLAD_GL_NV_shader_thread_shuffle, NULL },
+	{ "GL_NV_shading_rate_image", &GLAD_GL_NV_shading_rate_image, load_GL_NV_shading_rate_image },
+	{ "GL_NV_stereo_view_rendering", &GLAD_GL_NV_stereo_view_rendering, NULL },
+	{ "GL_NV_tessellation_program5", &GLAD_GL_NV_tessellation_program5, NULL },
+	{ "GL_NV_texgen_emboss", &GLAD_GL_NV_texgen_emboss, NULL },
+	{ "GL_NV_texgen_reflection", &GLAD_GL_NV_texgen_reflection, NULL },
+	{ "GL_NV_texture_barrier", &GLAD_GL_NV_texture_barrier, load_GL_NV_texture_barrier },
+	{ "GL_NV_texture_compression_vtc", &GLAD_GL_NV_texture_compression_vtc, NULL },
+	{ "GL_NV_texture_env_combine4", &GLAD_GL_NV_texture_env_combine4, NULL },
+	{ "GL_NV_texture_expand_normal", &GLAD_GL_NV_texture_expand_normal, NULL },
+	{ "GL_NV_texture_multisample", &GLAD_GL_NV_texture_multisample, load_GL_NV_texture_multisample },
+	{ "GL_NV_texture_rectangle", &GLAD_GL_NV_texture_rectangle, NULL },
+	{ "GL_NV_texture_rectangle_compressed", &GLAD_GL_NV_texture_rectangle_compressed, NULL },
+	{ "GL_NV_texture_shader", &GLAD_GL_NV_texture_shader, NULL },
+	{ "GL_NV_texture_shader2", &GLAD_GL_NV_texture_shader2, NULL },
+	{ "GL_NV_texture_shader3", &GLAD_GL_NV_texture_shader3, NULL },
+	{ "GL_NV_timeline_semaphore", &GLAD_GL_NV_timeline_semaphore, load_GL_NV_timeline_semaphore },
+	{ "GL_NV_transform_feedback", &GLAD_GL_NV_transform_feedback, load_GL_NV_transform_feedback },
+	{ "GL_NV_transform_feedback2", &GLAD_GL_NV_transform_feedback2, load_GL_NV_transform_feedback2 },
+	{ "GL_NV_uniform_buffer_std430_layout", &GLAD_GL_NV_uniform_buffer_std430_layout, NULL },
+	{ "GL_NV_uniform_buffer_unified_memory", &GLAD_GL_NV_uniform_buffer_unified_memory, NULL },
+	{ "GL_NV_vdpau_interop", &GLAD_GL_NV_vdpau_interop, load_GL_NV_vdpau_interop },
+	{ "GL_NV_vdpau_interop2", &GLAD_GL_NV_vdpau_interop2, load_GL_NV_vdpau_interop2 },
+	{ "GL_NV_vertex_array_range", &GLAD_GL_NV_vertex_array_range, load_GL_NV_vertex_array_range },
+	{ "GL_NV_vertex_array_range2", &GLAD_GL_NV_vertex_array_range2, NULL },
+	{ "GL_NV_vertex_attrib_integer_64bit", &GLAD_GL_NV_vertex_attrib_integer_64bit, load_GL_NV_vertex_attrib_integer_64bit },
+	{ "GL_NV_vertex_buffer_unified_memory", &GLAD_GL_NV_vertex_buffer_unified_memory, load_GL_NV_vertex_buffer_unified_memory },
+	{ "GL_NV_vertex_program", &GLAD_GL_NV_vertex_program, load_GL_NV_vertex_program },
+	{ "GL_NV_vertex_program1_1", &GLAD_GL_NV_vertex_program1_1, NULL },
+	{ "GL_NV_vertex_program2", &GLAD_GL_NV_vertex_program2, NULL },
+	{ "GL_NV_vertex_program2_option", &GLAD_GL_NV_vertex_program2_option, NULL },
+	{ "GL_NV_vertex_program3", &GLAD_GL_NV_vertex_program3, NULL },
+	{ "GL_NV_vertex_program4", &GLAD_GL_NV_vertex_program4, load_GL_NV_vertex_program4 },
+	{ "GL_NV_video_capture", &GLAD_GL_NV_video_capture, load_GL_NV_video_capture },
+	{ "GL_NV_viewport_array2", &GLAD_GL_NV_viewport_array2, NULL },
+	{ "GL_NV_viewport_swizzle", &GLAD_GL_NV_viewport_swizzle, load_GL_NV_viewport_swizzle },
+	{ "GL_OES_byte_coordinates", &GLAD_GL_OES_byte_coordinates, load_GL_OES_byte_coordinates },
+	{ "GL_OES_compressed_paletted_texture", &GLAD_GL_OES_compressed_paletted_texture, NULL },
+	{ "GL_OES_fixed_point", &GLAD_GL_OES_fixed_point, load_GL_OES_fixed_point },
+	{ "GL_OES_query_matrix", &GLAD_GL_OES_query_matrix, load_GL_OES_query_matrix },
+	{ "GL_OES_read_format", &GLAD_GL_OES_read_format, NULL },
+	{ "GL_OES_single_precision", &GLAD_GL_OES_single_precision, load_GL_OES_single_precision },
+	{ "GL_OML_interlace", &GLAD_GL_OML_interlace, NULL },
+	{ "GL_OML_resample", &GLAD_GL_OML_resample, NULL },
+	{ "GL_OML_subsample", &GLAD_GL_OML_subsample, NULL },
+	{ "GL_OVR_multiview", &GLAD_GL_OVR_multiview, load_GL_OVR_multiview },
+	{ "GL_OVR_multiview2", &GLAD_GL_OVR_multiview2, NULL },
+	{ "GL_PGI_misc_hints", &GLAD_GL_PGI_misc_hints, load_GL_PGI_misc_hints },
+	{ "GL_PGI_vertex_hints", &GLAD_GL_PGI_vertex_hints, NULL },
+	{ "GL_REND_screen_coordinates", &GLAD_GL_REND_screen_coordinates, NULL },
+	{ "GL_S3_s3tc", &GLAD_GL_S3_s3tc, NULL },
+	{ "GL_SGIS_detail_texture", &GLAD_GL_SGIS_detail_texture, load_GL_SGIS_detail_texture },
+	{ "GL_SGIS_fog_function", &GLAD_GL_SGIS_fog_function, load_GL_SGIS_fog_function },
+	{ "GL_SGIS_generate_mipmap", &GLAD_GL_SGIS_generate_mipmap, NULL },
+	{ "GL_SGIS_multisample", &GLAD_GL_SGIS_multisample, load_GL_SGIS_multisample },
+	{ "GL_SGIS_pixel_texture", &GLAD_GL_SGIS_pixel_texture, load_GL_SGIS_pixel_texture },
+	{ "GL_SGIS_point_line_texgen", &GLAD_GL_SGIS_point_line_texgen, NULL },
+	{ "GL_SGIS_point_parameters", &GLAD_GL_SGIS_point_parameters, load_GL_SGIS_point_parameters },
+	{ "GL_SGIS_sharpen_texture", &GLAD_GL_SGIS_sharpen_texture, load_GL_SGIS_sharpen_texture },
+	{ "GL_SGIS_texture4D", &GLAD_GL_SGIS_texture4D, load_GL_SGIS_texture4D },
+	{ "GL_SGIS_texture_border_clamp", &GLAD_GL_SGIS_texture_border_clamp, NULL },
+	{ "GL_SGIS_texture_color_mask", &GLAD_GL_SGIS_texture_color_mask, load_GL_SGIS_texture_color_mask },
+	{ "GL_SGIS_texture_edge_clamp", &GLAD_GL_SGIS_texture_edge_clamp, NULL },
+	{ "GL_SGIS_texture_filter4", &GLAD_GL_SGIS_texture_filter4, load_GL_SGIS_texture_filter4 },
+	{ "GL_SGIS_texture_lod", &GLAD_GL_SGIS_texture_lod, NULL },
+	{ "GL_SGIS_texture_select", &GLAD_GL_SGIS_texture_select, NULL },
+	{ "GL_SGIX_async", &GLAD_GL_SGIX_async, load_GL_SGIX_async },
+	{ "GL_SGIX_async_histogram", &GLAD_GL_SGIX_async_histogram, NULL },
+	{ "GL_SGIX_async_pixel", &GLAD_GL_SGIX_async_pixel, NULL },
+	{ "GL_SGIX_blend_alpha_minmax", &GLAD_GL_SGIX_blend_alpha_minmax, NULL },
+	{ "GL_SGIX_calligraphic_fragment", &GLAD_GL_SGIX_calligraphic_fragment, NULL },
+	{ "GL_SGIX_clipmap", &GLAD_GL_SGIX_clipmap, NULL },
+	{ "GL_SGIX_convolution_accuracy", &GLAD_GL_SGIX_convolution_accuracy, NULL },
+	{ "GL_SGIX_depth_pass_instrument", &GLAD_GL_SGIX_depth_pass_instrument, NULL },
+	{ "GL_SGIX_depth_texture", &GLAD_GL_SGIX_depth_texture, NULL },
+	{ "GL_SGIX_flush_raster", &GLAD_GL_SGIX_flush_raster, load_GL_SGIX_flush_raster },
+	{ "GL_SGIX_fog_offset", &GLAD_GL_SGIX_fog_offset, NULL },
+	{ "GL_SGIX_fragment_lighting", &GLAD_GL_SGIX_fragment_lighting, load_GL_SGIX_fragment_lighting },
+	{ "GL_SGIX_framezoom", &GLAD_GL_SGIX_framezoom, load_GL_SGIX_framezoom },
+	{ "GL_SGIX_igloo_interface", &GLAD_GL_SGIX_igloo_interface, load_GL_SGIX_igloo_interface },
+	{ "GL_SGIX_instruments", &GLAD_GL_SGIX_instruments, load_GL_SGIX_instruments },
+	{ "GL_SGIX_interlace", &GLAD_GL_SGIX_interlace, NULL },
+	{ "GL_SGIX_ir_instrument1", &GLAD_GL_SGIX_ir_instrument1, NULL },
+	{ "GL_SGIX_list_priority", &GLAD_GL_SGIX_list_priority, load_GL_SGIX_list_priority },
+	{ "GL_SGIX_pixel_texture", &GLAD_GL_SGIX_pixel_texture, load_GL_SGIX_pixel_texture },
+	{ "GL_SGIX_pixel_tiles", &GLAD_GL_SGIX_pixel_tiles, NULL },
+	{ "GL_SGIX_polynomial_ffd", &GLAD_GL_SGIX_polynomial_ffd, load_GL_SGIX_polynomial_ffd },
+	{ "GL_SGIX_reference_plane", &GLAD_GL_SGIX_reference_plane, load_GL_SGIX_reference_plane },
+	{ "GL_SGIX_resample", &GLAD_GL_SGIX_resample, NULL },
+	{ "GL_SGIX_scalebias_hint", &GLAD_GL_SGIX_scalebias_hint, NULL },
+	{ "GL_SGIX_shadow", &GLAD_GL_SGIX_shadow, NULL },
+	{ "GL_SGIX_shadow_ambient", &GLAD_GL_SGIX_shadow_ambient, NULL },
+	{ "GL_SGIX_sprite", &GLAD_GL_SGIX_sprite, load_GL_SGIX_sprite },
+	{ "GL_SGIX_subsample", &GLAD_GL_SGIX_subsample, NULL },
+	{ "GL_SGIX_tag_sample_buffer", &GLAD_GL_SGIX_tag_sample_buffer, load_GL_SGIX_tag_sample_buffer },
+	{ "GL_SGIX_texture_add_env", &GLAD_GL_SGIX_texture_add_env, NULL },
+	{ "GL_SGIX_texture_coordinate_clamp", &GLAD_GL_SGIX_texture_coordinate_clamp, NULL },
+	{ "GL_SGIX_texture_lod_bias", &GLAD_GL_SGIX_texture_lod_bias, NULL },
+	{ "GL_SGIX_texture_multi_buffer", &GLAD_GL_SGIX_texture_multi_buffer, NULL },
+	{ "GL_SGIX_texture_scale_bias", &GLAD_GL_SGIX_texture_scale_bias, NULL },
+	{ "GL_SGIX_vertex_preclip", &GLAD_GL_SGIX_vertex_preclip, NULL },
+	{ "GL_SGIX_ycrcb", &GLAD_GL_SGIX_ycrcb, NULL },
+	{ "GL_SGIX_ycrcb_subsample", &GLAD_GL_SGIX_ycrcb_subsample, NULL },
+	{ "GL_SGIX_ycrcba", &GLAD_GL_SGIX_ycrcba, NULL },
+	{ "GL_SGI_color_matrix", &GLAD_GL_SGI_color_matrix, NULL },
+	{ "GL_SGI_color_table", &GLAD_GL_SGI_color_table, load_GL_SGI_color_table },
+	{ "GL_SGI_texture_color_table", &GLAD_GL_SGI_texture_color_table, NULL },
+	{ "GL_SUNX_constant_data", &GLAD_GL_SUNX_constant_data, load_GL_SUNX_constant_data },
+	{ "GL_SUN_convolution_border_modes", &GLAD_GL_SUN_convolution_border_modes, NULL },
+	{ "GL_SUN_global_alpha", &GLAD_GL_SUN_global_alpha, load_GL_SUN_global_alpha },
+	{ "GL_SUN_mesh_array", &GLAD_GL_SUN_mesh_array, load_GL_SUN_mesh_array },
+	{ "GL_SUN_slice_accum", &GLAD_GL_SUN_slice_accum, NULL },
+	{ "GL_SUN_triangle_list", &GLAD_GL_SUN_triangle_list, load_GL_SUN_triangle_list },
+	{ "GL_SUN_vertex", &GLAD_GL_SUN_vertex, load_GL_SUN_vertex },
+	{ "GL_WIN_phong_shading", &GLAD_GL_WIN_phong_shading, NULL },
+	{ "GL_WIN_specular_fog", &GLAD_GL_WIN_specular_fog, NULL },
+};
+
+static const struct gladGLextensionEntry *find_extension(const char *name) {
+	size_t first = 0;
+	size_t last = sizeof(glad_gl_extensions) / sizeof(glad_gl_extensions[0]);
+	while (first < last) {
+		const size_t middle = first + (last - first) / 2;
+		const int order = strcmp(glad_gl_extensions[middle].name, name);
+		if (order == 0) return &glad_gl_extensions[middle];
+		if (order < 0) first = middle + 1;
+		else last = middle;
+	}
+	return NULL;
+}
+
+int gladLoadGLLoaderScoped(GLADloadproc load, int major, int minor, const char * const *extensions) {
+	size_t i;
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+
+	/* Versions past the requested one keep their functions NULL and report 0,
+	 * as if the context did not support them */
+	for (i = 0; i < sizeof(glad_gl_versions) / sizeof(glad_gl_versions[0]); i++) {
+		const struct gladGLversionEntry *version = &glad_gl_versions[i];
+		if (version->major > major || (version->major == major && version->minor > minor)) {
+			*version->flag = 0;
+		} else {
+			version->load(load);
+		}
+	}
+
+	/* Extensions that were not asked for report 0 */
+	for (i = 0; i < sizeof(glad_gl_extensions) / sizeof(glad_gl_extensions[0]); i++) {
+		*glad_gl_extensions[i].flag = 0;
+	}
+	if (extensions == NULL || extensions[0] == NULL) {
+		return GLVersion.major != 0 || GLVersion.minor != 0;
+	}
+
+	if (!get_exts()) return 0;
+	for (i = 0; extensions[i] != NULL; i++) {
+		const struct gladGLextensionEntry *extension = find_extension(extensions[i]);
+		if (extension == NULL) continue; /* not generated into this loader */
+		*extension->flag = has_ext(extension->name);
+		if (extension->load != NULL) extension->load(load);
+	}
+	free_exts();
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}